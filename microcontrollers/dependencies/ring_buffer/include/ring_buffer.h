@@ -0,0 +1,89 @@
+/*
+ * Author: Jakub Standarski
+ * Email: jstand.jakub.standarski@gmail.com
+ *
+ * Date: 17.10.2026
+ *
+ */
+
+#ifndef RING_BUFFER_H
+    #define RING_BUFFER_H
+
+/*****************************************************************************/
+/* HEADERS */
+/*****************************************************************************/
+
+#include <stdatomic.h>
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/* PUBLIC ENUMS */
+/*****************************************************************************/
+
+typedef enum ring_buffer_status {
+    RING_BUFFER_STATUS_OK,
+    RING_BUFFER_STATUS_INVALID_SIZE
+}ring_buffer_status_t;
+
+
+
+/*****************************************************************************/
+/* PUBLIC DEFINES */
+/*****************************************************************************/
+
+#define RING_BUFFER_SIZE_MAX (uint32_t)0x80000000
+
+
+
+/*****************************************************************************/
+/* PUBLIC STRUCTURES */
+/*****************************************************************************/
+
+/*
+ * Single producer, single consumer ring buffer. Exactly one context (task or
+ * interrupt) writes and exactly one context reads, then no locks are needed:
+ * write_index is only stored by the producer, read_index only by the
+ * consumer, both count bytes since initialisation and wrap at 2^32.
+ * Do not access the members directly.
+ */
+typedef struct ring_buffer {
+    uint8_t *storage;
+    uint32_t size;
+    uint32_t mask;
+    _Atomic uint32_t write_index;
+    _Atomic uint32_t read_index;
+}ring_buffer_t;
+
+
+
+/*****************************************************************************/
+/* PUBLIC FUNCTIONS PROTOTYPES */
+/*****************************************************************************/
+
+ring_buffer_status_t ring_buffer_init(ring_buffer_t *ring_buffer,
+    uint8_t *storage, uint32_t size);
+
+uint32_t ring_buffer_get_used_space(ring_buffer_t *ring_buffer);
+uint32_t ring_buffer_get_free_space(ring_buffer_t *ring_buffer);
+
+/* Producer side */
+uint32_t ring_buffer_write(ring_buffer_t *ring_buffer, const uint8_t *data,
+    uint32_t length);
+uint32_t ring_buffer_reserve_write_span(ring_buffer_t *ring_buffer,
+    uint8_t **span);
+void ring_buffer_commit_write_span(ring_buffer_t *ring_buffer,
+    uint32_t length);
+
+/* Consumer side */
+uint32_t ring_buffer_read(ring_buffer_t *ring_buffer, uint8_t *data,
+    uint32_t length);
+uint32_t ring_buffer_get_read_span(ring_buffer_t *ring_buffer,
+    const uint8_t **span);
+void ring_buffer_release_read_span(ring_buffer_t *ring_buffer,
+    uint32_t length);
+
+
+
+#endif /* RING_BUFFER_H */
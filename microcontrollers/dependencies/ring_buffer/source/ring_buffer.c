@@ -0,0 +1,218 @@
+/*
+ * Author: Jakub Standarski
+ * Email: jstand.jakub.standarski@gmail.com
+ *
+ * Date: 17.10.2026
+ *
+ */
+
+/*****************************************************************************/
+/* HEADERS */
+/*****************************************************************************/
+
+#include "ring_buffer.h"
+
+#include <string.h>
+
+
+
+/*****************************************************************************/
+/* PRIVATE FUNCTIONS PROTOTYPES */
+/*****************************************************************************/
+
+static uint32_t get_contiguous_length(ring_buffer_t *ring_buffer,
+    uint32_t index, uint32_t length);
+
+
+
+/*****************************************************************************/
+/* PUBLIC FUNCTIONS DEFINITIONS */
+/*****************************************************************************/
+
+/*
+ * size must be a power of two, so an index is turned into an offset with a
+ * mask and the byte counters wrap at 2^32 without a discontinuity.
+ */
+ring_buffer_status_t ring_buffer_init(ring_buffer_t *ring_buffer,
+    uint8_t *storage, uint32_t size)
+{
+    if ((size == 0) || ((size & (size - 1)) != 0) ||
+        (size > RING_BUFFER_SIZE_MAX)) {
+            return RING_BUFFER_STATUS_INVALID_SIZE;
+    }
+
+    ring_buffer->storage = storage;
+    ring_buffer->size = size;
+    ring_buffer->mask = size - 1;
+    atomic_init(&ring_buffer->write_index, 0);
+    atomic_init(&ring_buffer->read_index, 0);
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+
+
+/*
+ * Only meaningful from the producer or the consumer: the other side can move
+ * its index between the two loads.
+ */
+uint32_t ring_buffer_get_used_space(ring_buffer_t *ring_buffer)
+{
+    uint32_t write_index = atomic_load_explicit(&ring_buffer->write_index,
+        memory_order_acquire);
+    uint32_t read_index = atomic_load_explicit(&ring_buffer->read_index,
+        memory_order_acquire);
+
+    return write_index - read_index;
+}
+
+
+
+uint32_t ring_buffer_get_free_space(ring_buffer_t *ring_buffer)
+{
+    return ring_buffer->size - ring_buffer_get_used_space(ring_buffer);
+}
+
+
+
+/*
+ * Copies as much of the data as fits and returns the number of bytes
+ * written.
+ */
+uint32_t ring_buffer_write(ring_buffer_t *ring_buffer, const uint8_t *data,
+    uint32_t length)
+{
+    uint32_t written_length = 0;
+
+    while (written_length < length) {
+        uint8_t *span;
+        uint32_t span_length = ring_buffer_reserve_write_span(ring_buffer,
+            &span);
+        if (span_length == 0) {
+            break;
+        }
+
+        if (span_length > length - written_length) {
+            span_length = length - written_length;
+        }
+        memcpy(span, &data[written_length], span_length);
+        ring_buffer_commit_write_span(ring_buffer, span_length);
+        written_length += span_length;
+    }
+
+    return written_length;
+}
+
+
+
+/*
+ * Returns the length of the free space starting at *span, up to the end of
+ * the storage. The producer (or a DMA stream it starts) fills it and then
+ * commits the bytes written, in one or more steps. The acquire load pairs
+ * with the release in ring_buffer_release_read_span, so the consumer is done
+ * with the span before it is handed out again.
+ */
+uint32_t ring_buffer_reserve_write_span(ring_buffer_t *ring_buffer,
+    uint8_t **span)
+{
+    uint32_t write_index = atomic_load_explicit(&ring_buffer->write_index,
+        memory_order_relaxed);
+    uint32_t read_index = atomic_load_explicit(&ring_buffer->read_index,
+        memory_order_acquire);
+    uint32_t free_length = ring_buffer->size - (write_index - read_index);
+
+    *span = &ring_buffer->storage[write_index & ring_buffer->mask];
+
+    return get_contiguous_length(ring_buffer, write_index, free_length);
+}
+
+
+
+/*
+ * The release store publishes the bytes of the span before the new index,
+ * the consumer sees either neither or both.
+ */
+void ring_buffer_commit_write_span(ring_buffer_t *ring_buffer,
+    uint32_t length)
+{
+    uint32_t write_index = atomic_load_explicit(&ring_buffer->write_index,
+        memory_order_relaxed);
+
+    atomic_store_explicit(&ring_buffer->write_index, write_index + length,
+        memory_order_release);
+}
+
+
+
+/*
+ * Copies up to length bytes out and returns the number of bytes read.
+ */
+uint32_t ring_buffer_read(ring_buffer_t *ring_buffer, uint8_t *data,
+    uint32_t length)
+{
+    uint32_t read_length = 0;
+
+    while (read_length < length) {
+        const uint8_t *span;
+        uint32_t span_length = ring_buffer_get_read_span(ring_buffer, &span);
+        if (span_length == 0) {
+            break;
+        }
+
+        if (span_length > length - read_length) {
+            span_length = length - read_length;
+        }
+        memcpy(&data[read_length], span, span_length);
+        ring_buffer_release_read_span(ring_buffer, span_length);
+        read_length += span_length;
+    }
+
+    return read_length;
+}
+
+
+
+/*
+ * Returns the length of the data starting at *span, up to the end of the
+ * storage. The span stays valid until it is released, so the consumer can
+ * parse it in place.
+ */
+uint32_t ring_buffer_get_read_span(ring_buffer_t *ring_buffer,
+    const uint8_t **span)
+{
+    uint32_t read_index = atomic_load_explicit(&ring_buffer->read_index,
+        memory_order_relaxed);
+    uint32_t write_index = atomic_load_explicit(&ring_buffer->write_index,
+        memory_order_acquire);
+
+    *span = &ring_buffer->storage[read_index & ring_buffer->mask];
+
+    return get_contiguous_length(ring_buffer, read_index,
+        write_index - read_index);
+}
+
+
+
+void ring_buffer_release_read_span(ring_buffer_t *ring_buffer,
+    uint32_t length)
+{
+    uint32_t read_index = atomic_load_explicit(&ring_buffer->read_index,
+        memory_order_relaxed);
+
+    atomic_store_explicit(&ring_buffer->read_index, read_index + length,
+        memory_order_release);
+}
+
+
+
+/*****************************************************************************/
+/* PRIVATE FUNCTIONS DEFINITIONS */
+/*****************************************************************************/
+
+static uint32_t get_contiguous_length(ring_buffer_t *ring_buffer,
+    uint32_t index, uint32_t length)
+{
+    uint32_t length_to_end = ring_buffer->size - (index & ring_buffer->mask);
+
+    return (length < length_to_end) ? length : length_to_end;
+}
@@ -0,0 +1,215 @@
+/*
+ * Author: Jakub Standarski
+ * Email: jstand.jakub.standarski@gmail.com
+ *
+ * Date: 17.10.2026
+ *
+ */
+
+/*****************************************************************************/
+/* HEADERS */
+/*****************************************************************************/
+
+#include "ring_buffer.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+
+/*****************************************************************************/
+/* PRIVATE DEFINES */
+/*****************************************************************************/
+
+#define STORAGE_SIZE (uint32_t)4096
+
+#define TRANSFER_LENGTH (uint64_t)256 * 1024 * 1024
+
+#define CHUNK_LENGTH_MAX (uint32_t)1024
+
+#define SPAN_ROUND_TRIPS_COUNT (uint32_t)100000000
+
+
+
+/*****************************************************************************/
+/* PRIVATE VARIABLES */
+/*****************************************************************************/
+
+static ring_buffer_t benchmark_ring_buffer;
+static uint8_t benchmark_storage[STORAGE_SIZE];
+
+static const uint32_t benchmark_chunk_lengths[] = {1, 16, 256, 1024};
+
+static uint32_t benchmark_chunk_length;
+
+
+
+/*****************************************************************************/
+/* PRIVATE FUNCTIONS PROTOTYPES */
+/*****************************************************************************/
+
+static double measure_single_thread(void);
+static double measure_two_threads(void);
+static double measure_spans(void);
+static void *run_producer(void *argument);
+static void *run_consumer(void *argument);
+static double get_seconds(void);
+
+
+
+/*****************************************************************************/
+/* MAIN */
+/*****************************************************************************/
+
+/*
+ * Throughput of a 4 KiB ring buffer in MB/s, for several chunk lengths:
+ * write and read alternating in one thread (cost of the calls alone), a
+ * producer and a consumer thread (cost including the cache line traffic
+ * between cores, on a single core host mostly scheduling). Then the cost
+ * of one reserve, commit, get and release round trip, the bookkeeping a DMA
+ * stream and an in place parser pay per span.
+ */
+int main(void)
+{
+    uint32_t lengths_count = sizeof(benchmark_chunk_lengths) /
+        sizeof(benchmark_chunk_lengths[0]);
+
+    ring_buffer_init(&benchmark_ring_buffer, benchmark_storage, STORAGE_SIZE);
+
+    printf("chunk    one thread   two threads\n");
+    for (uint32_t length = 0; length < lengths_count; ++length) {
+        benchmark_chunk_length = benchmark_chunk_lengths[length];
+        double single_thread_seconds = measure_single_thread();
+        double two_threads_seconds = measure_two_threads();
+
+        printf("%5u %10.1f MB/s %8.1f MB/s\n", benchmark_chunk_length,
+            (double)TRANSFER_LENGTH / single_thread_seconds / 1e6,
+            (double)TRANSFER_LENGTH / two_threads_seconds / 1e6);
+    }
+
+    printf("span round trip %.1f ns\n",
+        1e9 * measure_spans() / SPAN_ROUND_TRIPS_COUNT);
+
+    return EXIT_SUCCESS;
+}
+
+
+
+/*****************************************************************************/
+/* PRIVATE FUNCTIONS DEFINITIONS */
+/*****************************************************************************/
+
+static double measure_single_thread(void)
+{
+    uint8_t chunk[CHUNK_LENGTH_MAX] = {0};
+    uint64_t transferred_length = 0;
+
+    double start = get_seconds();
+    while (transferred_length < TRANSFER_LENGTH) {
+        ring_buffer_write(&benchmark_ring_buffer, chunk,
+            benchmark_chunk_length);
+        transferred_length += ring_buffer_read(&benchmark_ring_buffer, chunk,
+            benchmark_chunk_length);
+    }
+
+    return get_seconds() - start;
+}
+
+
+
+static double measure_two_threads(void)
+{
+    pthread_t producer_thread;
+    pthread_t consumer_thread;
+
+    double start = get_seconds();
+    pthread_create(&producer_thread, NULL, run_producer, NULL);
+    pthread_create(&consumer_thread, NULL, run_consumer, NULL);
+    pthread_join(producer_thread, NULL);
+    pthread_join(consumer_thread, NULL);
+
+    return get_seconds() - start;
+}
+
+
+
+static double measure_spans(void)
+{
+    uint32_t checksum = 0;
+
+    double start = get_seconds();
+    for (uint32_t trip = 0; trip < SPAN_ROUND_TRIPS_COUNT; ++trip) {
+        uint8_t *write_span;
+        uint32_t write_length = ring_buffer_reserve_write_span(
+            &benchmark_ring_buffer, &write_span);
+        write_span[0] = (uint8_t)trip;
+        ring_buffer_commit_write_span(&benchmark_ring_buffer, write_length);
+
+        const uint8_t *read_span;
+        uint32_t read_length = ring_buffer_get_read_span(
+            &benchmark_ring_buffer, &read_span);
+        checksum += read_span[0];
+        ring_buffer_release_read_span(&benchmark_ring_buffer, read_length);
+    }
+    double seconds = get_seconds() - start;
+
+    if (checksum == 1) {
+        printf("\n");
+    }
+
+    return seconds;
+}
+
+
+
+static void *run_producer(void *argument)
+{
+    uint8_t chunk[CHUNK_LENGTH_MAX] = {0};
+    uint64_t transferred_length = 0;
+    (void)argument;
+
+    while (transferred_length < TRANSFER_LENGTH) {
+        uint32_t length = ring_buffer_write(&benchmark_ring_buffer, chunk,
+            benchmark_chunk_length);
+        if (length == 0) {
+            sched_yield();
+        }
+        transferred_length += length;
+    }
+
+    return NULL;
+}
+
+
+
+static void *run_consumer(void *argument)
+{
+    uint8_t chunk[CHUNK_LENGTH_MAX];
+    uint64_t transferred_length = 0;
+    (void)argument;
+
+    while (transferred_length < TRANSFER_LENGTH) {
+        uint32_t length = ring_buffer_read(&benchmark_ring_buffer, chunk,
+            benchmark_chunk_length);
+        if (length == 0) {
+            sched_yield();
+        }
+        transferred_length += length;
+    }
+
+    return NULL;
+}
+
+
+
+static double get_seconds(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double)now.tv_sec + 1e-9 * (double)now.tv_nsec;
+}
@@ -0,0 +1,265 @@
+/*
+ * Author: Jakub Standarski
+ * Email: jstand.jakub.standarski@gmail.com
+ *
+ * Date: 17.10.2026
+ *
+ */
+
+/*****************************************************************************/
+/* HEADERS */
+/*****************************************************************************/
+
+#include "ring_buffer.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+
+/*****************************************************************************/
+/* PRIVATE DEFINES */
+/*****************************************************************************/
+
+#define STORAGE_SIZE_MAX (uint32_t)4096
+
+#define CHUNK_LENGTH_MAX (uint32_t)300
+
+
+
+/*****************************************************************************/
+/* PRIVATE STRUCTURES */
+/*****************************************************************************/
+
+typedef struct stress_test_case {
+    uint32_t size;
+    uint32_t initial_index;
+    uint64_t stream_length;
+}stress_test_case_t;
+
+
+
+typedef struct stress_test_side {
+    uint64_t stream_length;
+    uint32_t random_state;
+    uint64_t errors_count;
+}stress_test_side_t;
+
+
+
+/*****************************************************************************/
+/* PRIVATE VARIABLES */
+/*****************************************************************************/
+
+static ring_buffer_t stress_test_ring_buffer;
+static uint8_t stress_test_storage[STORAGE_SIZE_MAX];
+
+/*
+ * The last case starts the indices just below 2^32, so they wrap during the
+ * test.
+ */
+static const stress_test_case_t stress_test_cases[] = {
+    {1, 0, 1024 * 1024},
+    {2, 0, 1024 * 1024},
+    {64, 0, 16 * 1024 * 1024},
+    {256, 0, 16 * 1024 * 1024},
+    {4096, 0, 64 * 1024 * 1024},
+    {64, 0xFFFFF000, 16 * 1024 * 1024}
+};
+
+
+
+/*****************************************************************************/
+/* PRIVATE FUNCTIONS PROTOTYPES */
+/*****************************************************************************/
+
+static int run_test_case(const stress_test_case_t *test_case);
+static void *run_producer(void *argument);
+static void *run_consumer(void *argument);
+static uint8_t get_stream_byte(uint64_t position);
+static uint32_t get_random_number(uint32_t *state);
+
+
+
+/*****************************************************************************/
+/* MAIN */
+/*****************************************************************************/
+
+/*
+ * A producer thread writes a known byte stream in random chunks, a consumer
+ * thread reads it back in random chunks and checks every byte. Both sides
+ * alternate between the copying calls and the span calls. Any lost,
+ * repeated or torn byte is an error.
+ */
+int main(void)
+{
+    int failures_count = 0;
+    uint32_t cases_count = sizeof(stress_test_cases) /
+        sizeof(stress_test_cases[0]);
+
+    if (ring_buffer_init(&stress_test_ring_buffer, stress_test_storage, 3) !=
+        RING_BUFFER_STATUS_INVALID_SIZE) {
+            printf("size 3 accepted\n");
+            ++failures_count;
+    }
+
+    for (uint32_t test_case = 0; test_case < cases_count; ++test_case) {
+        failures_count += run_test_case(&stress_test_cases[test_case]);
+    }
+
+    return (failures_count == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+
+
+/*****************************************************************************/
+/* PRIVATE FUNCTIONS DEFINITIONS */
+/*****************************************************************************/
+
+static int run_test_case(const stress_test_case_t *test_case)
+{
+    pthread_t producer_thread;
+    pthread_t consumer_thread;
+    stress_test_side_t producer = {
+        .stream_length = test_case->stream_length,
+        .random_state = 1
+    };
+    stress_test_side_t consumer = {
+        .stream_length = test_case->stream_length,
+        .random_state = 2
+    };
+
+    ring_buffer_init(&stress_test_ring_buffer, stress_test_storage,
+        test_case->size);
+    atomic_store(&stress_test_ring_buffer.write_index,
+        test_case->initial_index);
+    atomic_store(&stress_test_ring_buffer.read_index,
+        test_case->initial_index);
+
+    pthread_create(&producer_thread, NULL, run_producer, &producer);
+    pthread_create(&consumer_thread, NULL, run_consumer, &consumer);
+    pthread_join(producer_thread, NULL);
+    pthread_join(consumer_thread, NULL);
+
+    printf("size %4u, start 0x%08X: %llu bytes, %llu errors\n",
+        test_case->size, test_case->initial_index,
+        (unsigned long long)test_case->stream_length,
+        (unsigned long long)consumer.errors_count);
+
+    return (consumer.errors_count == 0) ? 0 : 1;
+}
+
+
+
+static void *run_producer(void *argument)
+{
+    stress_test_side_t *producer = argument;
+    uint8_t chunk[CHUNK_LENGTH_MAX];
+    uint64_t position = 0;
+
+    while (position < producer->stream_length) {
+        uint64_t previous_position = position;
+        uint32_t random_number = get_random_number(&producer->random_state);
+        uint32_t length = 1 + (random_number % CHUNK_LENGTH_MAX);
+        if (length > producer->stream_length - position) {
+            length = (uint32_t)(producer->stream_length - position);
+        }
+
+        if ((random_number & 0x10000) != 0) {
+            for (uint32_t byte = 0; byte < length; ++byte) {
+                chunk[byte] = get_stream_byte(position + byte);
+            }
+            position += ring_buffer_write(&stress_test_ring_buffer, chunk,
+                length);
+        } else {
+            uint8_t *span;
+            uint32_t span_length = ring_buffer_reserve_write_span(
+                &stress_test_ring_buffer, &span);
+            if (span_length > length) {
+                span_length = length;
+            }
+            for (uint32_t byte = 0; byte < span_length; ++byte) {
+                span[byte] = get_stream_byte(position + byte);
+            }
+            ring_buffer_commit_write_span(&stress_test_ring_buffer,
+                span_length);
+            position += span_length;
+        }
+
+        /* Lets the consumer run on a host with a single core. */
+        if (position == previous_position) {
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+
+
+static void *run_consumer(void *argument)
+{
+    stress_test_side_t *consumer = argument;
+    uint8_t chunk[CHUNK_LENGTH_MAX];
+    uint64_t position = 0;
+
+    while (position < consumer->stream_length) {
+        uint64_t previous_position = position;
+        uint32_t random_number = get_random_number(&consumer->random_state);
+        uint32_t length = 1 + (random_number % CHUNK_LENGTH_MAX);
+
+        if ((random_number & 0x10000) != 0) {
+            uint32_t read_length = ring_buffer_read(&stress_test_ring_buffer,
+                chunk, length);
+            for (uint32_t byte = 0; byte < read_length; ++byte) {
+                if (chunk[byte] != get_stream_byte(position + byte)) {
+                    ++consumer->errors_count;
+                }
+            }
+            position += read_length;
+        } else {
+            const uint8_t *span;
+            uint32_t span_length = ring_buffer_get_read_span(
+                &stress_test_ring_buffer, &span);
+            if (span_length > length) {
+                span_length = length;
+            }
+            for (uint32_t byte = 0; byte < span_length; ++byte) {
+                if (span[byte] != get_stream_byte(position + byte)) {
+                    ++consumer->errors_count;
+                }
+            }
+            ring_buffer_release_read_span(&stress_test_ring_buffer,
+                span_length);
+            position += span_length;
+        }
+
+        if (position == previous_position) {
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+
+
+/* Not periodic in any buffer size, so a slipped byte shows. */
+static uint8_t get_stream_byte(uint64_t position)
+{
+    return (uint8_t)((position * 2654435761u) >> 13);
+}
+
+
+
+static uint32_t get_random_number(uint32_t *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+
+    return *state;
+}
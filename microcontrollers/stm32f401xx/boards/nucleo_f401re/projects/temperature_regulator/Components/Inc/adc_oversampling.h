@@ -0,0 +1,49 @@
+#ifndef ADC_OVERSAMPLING_H
+#define ADC_OVERSAMPLING_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/*                             PUBLIC DEFINES                                */
+/*****************************************************************************/
+
+/*
+  Every extra bit of resolution needs four times more samples, so a block of
+  4^n samples is reduced to a single reading with n fractional bits.
+*/
+#define ADC_OVERSAMPLING_EXTRA_BITS 4
+#define ADC_OVERSAMPLING_BLOCK_SIZE (1U << (2 * ADC_OVERSAMPLING_EXTRA_BITS))
+
+
+
+/*****************************************************************************/
+/*                              PUBLIC MACROS                                */
+/*****************************************************************************/
+
+#define ADC_OVERSAMPLING_TO_ADC_CODE(reading) \
+  ((reading) >> ADC_OVERSAMPLING_EXTRA_BITS)
+
+
+
+/*****************************************************************************/
+/*                      PUBLIC FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+uint32_t ADC_OVERSAMPLING_ReduceBlock(const uint16_t *samples);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* ADC_OVERSAMPLING_H */
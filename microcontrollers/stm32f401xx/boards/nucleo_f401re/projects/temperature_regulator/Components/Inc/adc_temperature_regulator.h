@@ -8,12 +8,61 @@ extern "C"
 
 
 
+#include "pid_controller.h"
+
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/*                           PUBLIC STRUCTURES                               */
+/*****************************************************************************/
+
+/*
+  Spacing of the filtered readings measured with the DWT cycle counter.
+  Jitter is the largest deviation of a single period from the expected one.
+*/
+typedef struct adc1SamplingStatistics {
+  uint32_t readingsCount;
+  uint32_t expectedPeriodCycles;
+  uint32_t lastPeriodCycles;
+  uint32_t minPeriodCycles;
+  uint32_t maxPeriodCycles;
+  uint32_t maxJitterCycles;
+}adc1SamplingStatistics_t;
+
+
+
+/*
+  PID gains are in per mille of heater power (see pid_controller.h for the
+  units), the relay window is the period of the time-proportional output.
+*/
+typedef struct temperatureControlSettings {
+  pidSettings_t pid;
+  uint32_t relayWindowMs;
+}temperatureControlSettings_t;
+
+
+
 /*****************************************************************************/
 /*                      PUBLIC FUNCTIONS PROTOTYPES                          */
 /*****************************************************************************/
 
 void ADC1_TEMPERATURE_REGULATOR_Clock_Config(void);
 void ADC1_TEMPERATURE_REGULATOR_Settings_Config(void);
+void ADC1_TEMPERATURE_REGULATOR_DMA_Config(void);
+void ADC1_TEMPERATURE_REGULATOR_GetSamplingStatistics(
+  adc1SamplingStatistics_t *statistics);
+void ADC1_TEMPERATURE_REGULATOR_UpdateClock(void);
+void ADC1_TEMPERATURE_REGULATOR_DMA_HalfTransfer_Callback(void);
+void ADC1_TEMPERATURE_REGULATOR_DMA_TransferComplete_Callback(void);
+int32_t ADC1_TEMPERATURE_REGULATOR_SetControlSettings(
+  const temperatureControlSettings_t *settings);
+int32_t ADC1_TEMPERATURE_REGULATOR_StartAutotune(uint32_t hysteresisTenths,
+  uint32_t cyclesCount);
+void ADC1_TEMPERATURE_REGULATOR_RegisterCommands(void);
+void ADC1_TEMPERATURE_REGULATOR_RunConversionBenchmark(void);
+void ADC1_TEMPERATURE_REGULATOR_AnalogWatchdog_Callback(void);
 
 
 
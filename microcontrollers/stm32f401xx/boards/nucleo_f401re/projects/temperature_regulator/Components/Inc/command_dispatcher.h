@@ -0,0 +1,73 @@
+#ifndef COMMAND_DISPATCHER_H
+#define COMMAND_DISPATCHER_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include "command_frame.h"
+
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/*                             PUBLIC DEFINES                                */
+/*****************************************************************************/
+
+#define COMMAND_DISPATCHER_ROUTES_MAX 8U
+
+/*
+  Handler results: executed or queued for the owner, payload refused, or
+  queued in place of an earlier command the owner had not taken yet.
+*/
+#define COMMAND_DISPATCHER_EXECUTED 0
+#define COMMAND_DISPATCHER_REJECTED (-1)
+#define COMMAND_DISPATCHER_REPLACED 1
+
+
+
+/*****************************************************************************/
+/*                           PUBLIC STRUCTURES                               */
+/*****************************************************************************/
+
+/*
+  dispatchedCount    commands handed to the handler
+  rejectedCount      commands whose payload the handler refused
+  droppedCount       commands replaced by a newer one before the owner took
+                     them
+  lastLatencyCycles  DWT cycles from the decoded frame to the handler
+  maxLatencyCycles   returning
+*/
+typedef struct commandDispatchStatistics {
+  volatile uint32_t dispatchedCount;
+  volatile uint32_t rejectedCount;
+  volatile uint32_t droppedCount;
+  volatile uint32_t lastLatencyCycles;
+  volatile uint32_t maxLatencyCycles;
+}commandDispatchStatistics_t;
+
+
+
+/*****************************************************************************/
+/*                      PUBLIC FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+int32_t COMMAND_DISPATCHER_RegisterHandler(uint8_t commandId,
+  uint8_t payloadLength, const char *name,
+  int32_t (*Handle)(const uint8_t *payload));
+const char *COMMAND_DISPATCHER_Dispatch(const commandFrame_t *frame,
+  uint32_t receivedCycles, uint32_t *isRejected);
+const char *COMMAND_DISPATCHER_GetStatistics(uint32_t route,
+  commandDispatchStatistics_t *statistics);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* COMMAND_DISPATCHER_H */
@@ -0,0 +1,104 @@
+#ifndef COMMAND_FRAME_H
+#define COMMAND_FRAME_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/*                             PUBLIC DEFINES                                */
+/*****************************************************************************/
+
+/*
+  Command frame before COBS encoding, little-endian:
+
+  offset  size  field
+       0     1  command ID
+       1     1  payload length n
+       2     n  payload
+     2+n     4  CRC32_Calculate of bytes 0 to 1+n
+
+  On the line the frame is COBS encoded, so it contains no zero byte, and
+  is followed by a zero delimiter.
+*/
+#define COMMAND_FRAME_PAYLOAD_SIZE_MAX 16U
+#define COMMAND_FRAME_HEADER_SIZE      2U
+#define COMMAND_FRAME_CRC_SIZE         4U
+
+#define COMMAND_FRAME_DECODED_SIZE_MAX (COMMAND_FRAME_HEADER_SIZE + \
+  COMMAND_FRAME_PAYLOAD_SIZE_MAX + COMMAND_FRAME_CRC_SIZE)
+
+/* One COBS code byte per 254 bytes, plus the delimiter. */
+#define COMMAND_FRAME_ENCODED_SIZE_MAX (COMMAND_FRAME_DECODED_SIZE_MAX + \
+  COMMAND_FRAME_DECODED_SIZE_MAX / 254U + 2U)
+
+#define COMMAND_FRAME_DELIMITER 0x00U
+
+#define COMMAND_FRAME_ID_LED2_BLINKS       0x01U
+#define COMMAND_FRAME_ID_AUTOTUNE         0x02U
+#define COMMAND_FRAME_ID_CPU_REPORT       0x03U
+#define COMMAND_FRAME_ID_TRACE_DUMP       0x04U
+#define COMMAND_FRAME_ID_FLASH_BENCHMARK  0x05U
+#define COMMAND_FRAME_ID_CONTROL_SETTINGS 0x06U
+
+
+
+/*****************************************************************************/
+/*                              PUBLIC ENUMS                                 */
+/*****************************************************************************/
+
+typedef enum commandFrameStatus {
+  CommandFrame_Incomplete  = 0,
+  CommandFrame_Received    = 1,
+  CommandFrame_FormatError = -1,
+  CommandFrame_CrcError    = -2
+}commandFrameStatus_t;
+
+
+
+/*****************************************************************************/
+/*                           PUBLIC STRUCTURES                               */
+/*****************************************************************************/
+
+typedef struct commandFrame {
+  uint8_t commandId;
+  uint8_t payloadLength;
+  uint8_t payload[COMMAND_FRAME_PAYLOAD_SIZE_MAX];
+}commandFrame_t;
+
+
+
+typedef struct commandFrameDecoder {
+  uint8_t data[COMMAND_FRAME_DECODED_SIZE_MAX];
+  uint32_t length;
+  uint8_t blockCode;
+  uint8_t blockBytesLeft;
+  uint8_t isOverflowed;
+}commandFrameDecoder_t;
+
+
+
+/*****************************************************************************/
+/*                      PUBLIC FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+uint32_t COMMAND_FRAME_Encode(const commandFrame_t *frame,
+  uint8_t encoded[COMMAND_FRAME_ENCODED_SIZE_MAX]);
+void COMMAND_FRAME_InitDecoder(commandFrameDecoder_t *decoder);
+commandFrameStatus_t COMMAND_FRAME_FeedByte(commandFrameDecoder_t *decoder,
+  uint8_t byte, commandFrame_t *frame);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* COMMAND_FRAME_H */
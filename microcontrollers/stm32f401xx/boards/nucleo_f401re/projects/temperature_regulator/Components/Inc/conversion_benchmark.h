@@ -0,0 +1,46 @@
+#ifndef CONVERSION_BENCHMARK_H
+#define CONVERSION_BENCHMARK_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/*                           PUBLIC STRUCTURES                               */
+/*****************************************************************************/
+
+/*
+  Average DWT cycles spent converting one filtered reading to a temperature,
+  with the fixed-point path used by the regulator and with the equivalent
+  float path, together with the FPU setup the float path was measured with.
+*/
+typedef struct conversionBenchmarkResults {
+  uint32_t samplesCount;
+  uint32_t fixedPointCyclesPerSample;
+  uint32_t floatCyclesPerSample;
+  uint32_t isHardwareFpuUsed;
+  uint32_t isLazyStackingEnabled;
+}conversionBenchmarkResults_t;
+
+
+
+/*****************************************************************************/
+/*                      PUBLIC FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+void CONVERSION_BENCHMARK_Run(conversionBenchmarkResults_t *results);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* CONVERSION_BENCHMARK_H */
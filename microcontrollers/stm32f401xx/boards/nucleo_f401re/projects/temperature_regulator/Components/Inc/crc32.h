@@ -0,0 +1,28 @@
+#ifndef CRC32_H
+#define CRC32_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/*                      PUBLIC FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+void CRC32_Clock_Config(void);
+uint32_t CRC32_Calculate(const uint8_t *data, uint32_t length);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* CRC32_H */
@@ -10,6 +10,51 @@ extern "C"
 
 #include "cmsis_os2.h"
 
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/*                           PUBLIC STRUCTURES                               */
+/*****************************************************************************/
+
+/*
+  queuedFramesCount    messages copied into the TX ring buffer
+  overflowFramesCount  messages dropped because the TX ring buffer was full
+  droppedFramesCount   messages dropped because they were longer than it
+  transfersCount       DMA2 Stream7 transfers, one per contiguous span
+  maxQueuedBytesCount  most bytes ever waiting in the TX ring buffer
+*/
+typedef struct dma2Usart1TxStatistics
+{
+  volatile uint32_t queuedFramesCount;
+  volatile uint32_t overflowFramesCount;
+  volatile uint32_t droppedFramesCount;
+  volatile uint32_t transfersCount;
+  volatile uint32_t maxQueuedBytesCount;
+}dma2Usart1TxStatistics_t;
+
+
+
+/*
+  formatErrorsCount     frames with a wrong length or COBS encoding
+  crcErrorsCount        frames with a wrong CRC
+  unknownCommandsCount  valid frames with an unknown ID or payload length
+  overrunsCount         times DMA2 Stream2 came back to the bank being read
+  lostBytesCount        bytes overwritten before the RX task read them
+  maxPendingBytesCount  most bytes ever waiting for the RX task
+*/
+typedef struct dma2Usart1RxStatistics
+{
+  volatile uint32_t receivedFramesCount;
+  volatile uint32_t formatErrorsCount;
+  volatile uint32_t crcErrorsCount;
+  volatile uint32_t unknownCommandsCount;
+  volatile uint32_t overrunsCount;
+  volatile uint32_t lostBytesCount;
+  volatile uint32_t maxPendingBytesCount;
+}dma2Usart1RxStatistics_t;
+
 
 
 /*****************************************************************************/
@@ -21,8 +66,15 @@ void DMA2_USART1_RX_Config(void);
 void DMA2_USART1_TX_Config(void);
 void DMA2_USART1_TX_SendFeedbackMessage(void *objectAddress,
                                         size_t objectSize);
-
-osMessageQueueId_t GetQueueHandleForLed2Task(void);
+uint32_t DMA2_USART1_TX_GetFreeBytesCount(void);
+void DMA2_USART1_TX_Hold(void);
+void DMA2_USART1_TX_Release(void);
+void DMA2_USART1_TX_TransferComplete_Callback(void);
+void DMA2_USART1_RX_Callback(void);
+void DMA2_USART1_RX_TransferComplete_Callback(void);
+void DMA2_USART1_TX_GetStatistics(dma2Usart1TxStatistics_t *statistics);
+void DMA2_USART1_RX_GetStatistics(dma2Usart1RxStatistics_t *statistics);
+uint32_t DMA2_USART1_RX_EncodeStatistics(uint8_t *frame);
 
 
 
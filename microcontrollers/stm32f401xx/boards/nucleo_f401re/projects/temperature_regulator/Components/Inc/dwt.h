@@ -0,0 +1,29 @@
+#ifndef DWT_H
+#define DWT_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/*                      PUBLIC FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+void DWT_CycleCounter_Config(void);
+uint32_t DWT_GetCycleCount(void);
+void DWT_AdvanceCycleCount(uint32_t cycles);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+ 
+#endif  /* DWT_H */
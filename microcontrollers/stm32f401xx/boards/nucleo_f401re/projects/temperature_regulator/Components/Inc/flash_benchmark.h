@@ -0,0 +1,47 @@
+#ifndef FLASH_BENCHMARK_H
+#define FLASH_BENCHMARK_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/*                           PUBLIC STRUCTURES                               */
+/*****************************************************************************/
+
+/*
+  DWT cycles a reference loop run from flash took over bytesCount bytes of
+  a bitwise CRC-32, with the ART accelerator off (no prefetch, no caches)
+  and as configured, at the core clock and flash wait states it was
+  measured with.
+*/
+typedef struct flashBenchmarkResults {
+  uint32_t frequencyHz;
+  uint32_t waitStatesCount;
+  uint32_t bytesCount;
+  uint32_t acceleratorOffCycles;
+  uint32_t acceleratorOnCycles;
+}flashBenchmarkResults_t;
+
+
+
+/*****************************************************************************/
+/*                      PUBLIC FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+void FLASH_BENCHMARK_Run(flashBenchmarkResults_t *results);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* FLASH_BENCHMARK_H */
@@ -0,0 +1,44 @@
+#ifndef HEATER_RELAY_H
+#define HEATER_RELAY_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/*                             PUBLIC ENUMS                                  */
+/*****************************************************************************/
+
+typedef enum heaterState {
+  Heater_On  = 0,
+  Heater_Off = 1
+}heaterState_t;
+
+
+
+/*****************************************************************************/
+/*                      PUBLIC FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+void HEATER_RELAY_Start(uint32_t windowMs);
+void HEATER_RELAY_SetWindow(uint32_t windowMs);
+void HEATER_RELAY_SetDuty(uint32_t dutyPerMille);
+void HEATER_RELAY_TurnOff(void);
+void HEATER_RELAY_Disable(void);
+void HEATER_RELAY_Enable(void);
+heaterState_t HEATER_RELAY_GetState(void);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* HEATER_RELAY_H */
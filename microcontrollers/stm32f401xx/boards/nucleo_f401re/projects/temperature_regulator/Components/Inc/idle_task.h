@@ -8,6 +8,18 @@ extern "C"
 
 
 
+#include "cmsis_os2.h"
+
+
+
+/*****************************************************************************/
+/*                       PUBLIC FUNCTIONS PROTOTYPES                         */
+/*****************************************************************************/
+
+void IDLE_TASK_RegisterCommands(osThreadId_t idleTaskHandle);
+
+
+
 /*****************************************************************************/
 /*                            RTOS TASK PROTOTYPE                            */
 /*****************************************************************************/
@@ -16,16 +16,11 @@ extern "C"
 /*                       PUBLIC FUNCTIONS PROTOTYPES                         */
 /*****************************************************************************/
 
+void LED2_Start(void);
 void LED2_UpdateBlinkPattern(const uint8_t newLongBlinksAmount, 
                              const uint8_t newShortBlinksAmount);
-
-
-
-/*****************************************************************************/
-/*                           RTOS TASK PROTOTYPE                             */
-/*****************************************************************************/
-
-void StartLed2Task(void *argument);
+void LED2_RegisterCommands(void);
+void LED2_PatternTimer_Callback(void);
 
 
 
@@ -0,0 +1,43 @@
+#ifndef LOW_POWER_H
+#define LOW_POWER_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/*                           PUBLIC STRUCTURES                               */
+/*****************************************************************************/
+
+/*
+  sleepsCount  tickless idle periods spent in sleep mode
+  sleepTimeMs  time spent asleep, measured with the RTC
+*/
+typedef struct lowPowerStatistics {
+  uint32_t sleepsCount;
+  uint32_t sleepTimeMs;
+}lowPowerStatistics_t;
+
+
+
+/*****************************************************************************/
+/*                      PUBLIC FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+void LOW_POWER_SuppressTicksAndSleep(uint32_t expectedIdleTicks);
+void LOW_POWER_GetStatistics(lowPowerStatistics_t *statistics);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* LOW_POWER_H */
@@ -0,0 +1,79 @@
+#ifndef PID_CONTROLLER_H
+#define PID_CONTROLLER_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/*                             PUBLIC DEFINES                                */
+/*****************************************************************************/
+
+/*
+  Gains, set point and measurement are fixed-point numbers with
+  PID_CONTROLLER_FRACTIONAL_BITS fractional bits. The output is an integer
+  in the units of the [outputMin, outputMax] range given at initialization.
+*/
+#define PID_CONTROLLER_FRACTIONAL_BITS 8
+
+
+
+/*****************************************************************************/
+/*                           PUBLIC STRUCTURES                               */
+/*****************************************************************************/
+
+/*
+  proportionalGain  output per unit of error
+  integralGain      output per unit of error and second
+  derivativeGain    output seconds per unit of error
+  derivativeFilterShift  the derivative is low-pass filtered with
+                         a smoothing factor of 1 / 2^shift
+*/
+typedef struct pidSettings {
+  int32_t proportionalGain;
+  int32_t integralGain;
+  int32_t derivativeGain;
+  uint32_t derivativeFilterShift;
+}pidSettings_t;
+
+
+
+typedef struct pidController {
+  pidSettings_t settings;
+  uint32_t samplePeriodMs;
+  int32_t outputMin;
+  int32_t outputMax;
+  int64_t integralTerm;
+  int32_t previousMeasurement;
+  int32_t filteredDerivative;
+  uint32_t isPreviousMeasurementValid;
+}pidController_t;
+
+
+
+/*****************************************************************************/
+/*                      PUBLIC FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+void PID_CONTROLLER_Init(pidController_t *pid, const pidSettings_t *settings,
+  uint32_t samplePeriodMs, int32_t outputMin, int32_t outputMax);
+void PID_CONTROLLER_SetSettings(pidController_t *pid,
+  const pidSettings_t *settings);
+void PID_CONTROLLER_Reset(pidController_t *pid);
+int32_t PID_CONTROLLER_Update(pidController_t *pid, int32_t setPoint,
+  int32_t measurement);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* PID_CONTROLLER_H */
@@ -0,0 +1,100 @@
+#ifndef RELAY_AUTOTUNER_H
+#define RELAY_AUTOTUNER_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include "pid_controller.h"
+
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/*                             PUBLIC ENUMS                                  */
+/*****************************************************************************/
+
+typedef enum relayAutotunerStatus {
+  RelayAutotuner_Running  = 0,
+  RelayAutotuner_Finished = 1,
+  RelayAutotuner_Failed   = -1
+}relayAutotunerStatus_t;
+
+
+
+/*****************************************************************************/
+/*                           PUBLIC STRUCTURES                               */
+/*****************************************************************************/
+
+/*
+  setPoint and hysteresis use PID_CONTROLLER_FRACTIONAL_BITS fractional bits,
+  relayAmplitude is half of the output span the relay switches over, in the
+  output units of the PID controller. The first cycle is discarded as
+  transient, the next cyclesCount cycles are averaged.
+*/
+typedef struct relayAutotunerSettings {
+  int32_t setPoint;
+  int32_t hysteresis;
+  int32_t relayAmplitude;
+  uint32_t cyclesCount;
+  uint32_t timeoutMs;
+  uint32_t derivativeFilterShift;
+}relayAutotunerSettings_t;
+
+
+
+typedef struct relayAutotuner {
+  relayAutotunerSettings_t settings;
+  uint32_t startTimeMs;
+  uint32_t isRelayOn;
+  uint32_t switchOnsCount;
+  uint32_t isUpperBandCrossed;
+  uint32_t lastSwitchOnTimeMs;
+  int32_t cycleMaxTemperature;
+  int32_t cycleMinTemperature;
+  uint32_t measuredCyclesCount;
+  uint64_t periodsSumMs;
+  int64_t peakToPeakSum;
+}relayAutotuner_t;
+
+
+
+/*
+  ultimateGain is in output units per degree with
+  PID_CONTROLLER_FRACTIONAL_BITS fractional bits, ultimatePeriodMs is the
+  period of the sustained oscillation. The PID settings follow the classic
+  Ziegler-Nichols rules for the ultimate point.
+*/
+typedef struct relayAutotunerResults {
+  int32_t ultimateGain;
+  uint32_t ultimatePeriodMs;
+  int32_t oscillationAmplitude;
+  pidSettings_t pid;
+}relayAutotunerResults_t;
+
+
+
+/*****************************************************************************/
+/*                      PUBLIC FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+void RELAY_AUTOTUNER_Init(relayAutotuner_t *tuner,
+  const relayAutotunerSettings_t *settings, uint32_t timeMs);
+uint32_t RELAY_AUTOTUNER_GetRelayCommand(relayAutotuner_t *tuner,
+  int32_t temperature);
+relayAutotunerStatus_t RELAY_AUTOTUNER_Observe(relayAutotuner_t *tuner,
+  uint32_t timeMs, int32_t temperature, uint32_t isRelayOn);
+void RELAY_AUTOTUNER_GetResults(const relayAutotuner_t *tuner,
+  relayAutotunerResults_t *results);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* RELAY_AUTOTUNER_H */
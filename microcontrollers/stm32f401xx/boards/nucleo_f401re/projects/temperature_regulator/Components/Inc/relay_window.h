@@ -0,0 +1,45 @@
+#ifndef RELAY_WINDOW_H
+#define RELAY_WINDOW_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/*                             PUBLIC DEFINES                                */
+/*****************************************************************************/
+
+/* Duty cycle of the relay within one time window, in per mille. */
+#define RELAY_WINDOW_DUTY_MAX 1000
+
+#define RELAY_WINDOW_MS_DEFAULT 10000
+
+/*
+  Pulses shorter than this are dropped and gaps shorter than this are
+  filled, the mechanical relay would only chatter on them.
+*/
+#define RELAY_WINDOW_MIN_SWITCH_TIME_MS 200
+
+
+
+/*****************************************************************************/
+/*                      PUBLIC FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+uint32_t RELAY_WINDOW_CalculatePulseTime(uint32_t windowMs,
+  uint32_t dutyPerMille);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* RELAY_WINDOW_H */
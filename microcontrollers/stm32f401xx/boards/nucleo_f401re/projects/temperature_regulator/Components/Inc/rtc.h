@@ -8,10 +8,22 @@ extern "C"
 
 
 
+#include <stdint.h>
 #include <time.h>
 
 
 
+/*****************************************************************************/
+/*                             PUBLIC DEFINES                                */
+/*****************************************************************************/
+
+#define RTC_SUBSECONDS_PER_SECOND 4096U
+#define RTC_SUBSECONDS_PER_DAY    (24U * 3600U * RTC_SUBSECONDS_PER_SECOND)
+
+#define RTC_WAKEUP_PERIOD_MAX_US  4000000U
+
+
+
 /*****************************************************************************/
 /*                       PUBLIC FUNCTIONS PROTOTYPES                         */
 /*****************************************************************************/
@@ -19,6 +31,10 @@ extern "C"
 void RTC_Clock_Config(void);
 void RTC_InitialSettings_Config(void);
 time_t RTC_GetTimeInSeconds(void);
+void RTC_WakeupTimer_Config(void);
+void RTC_WakeupTimer_Start(uint32_t periodUs);
+void RTC_WakeupTimer_Stop(void);
+uint32_t RTC_GetTimeOfDayInSubseconds(void);
 
 
 
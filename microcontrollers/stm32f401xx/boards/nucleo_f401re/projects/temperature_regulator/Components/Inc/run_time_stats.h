@@ -0,0 +1,54 @@
+#ifndef RUN_TIME_STATS_H
+#define RUN_TIME_STATS_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/*                             PUBLIC DEFINES                                */
+/*****************************************************************************/
+
+#define RUN_TIME_STATS_TASKS_MAX 8U
+
+
+
+/*****************************************************************************/
+/*                           PUBLIC STRUCTURES                               */
+/*****************************************************************************/
+
+/*
+  cpuPerMille      share of the CPU time since the previous call
+  maxActivationUs  longest time the task ran between being switched in and
+                   switched out since the previous call
+*/
+typedef struct runTimeTaskStatistics {
+  const char *name;
+  uint32_t cpuPerMille;
+  uint32_t maxActivationUs;
+}runTimeTaskStatistics_t;
+
+
+
+/*****************************************************************************/
+/*                      PUBLIC FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+void RUN_TIME_STATS_TaskSwitchedIn(uint32_t taskNumber);
+uint32_t RUN_TIME_STATS_GetTaskStatistics(
+  runTimeTaskStatistics_t statistics[RUN_TIME_STATS_TASKS_MAX]);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* RUN_TIME_STATS_H */
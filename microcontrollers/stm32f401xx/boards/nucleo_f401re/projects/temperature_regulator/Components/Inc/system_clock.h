@@ -0,0 +1,65 @@
+#ifndef SYSTEM_CLOCK_H
+#define SYSTEM_CLOCK_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/*                              PUBLIC ENUMS                                 */
+/*****************************************************************************/
+
+/* Ordered by core clock frequency, the governor steps one profile at once. */
+typedef enum systemClockProfile {
+  SystemClockProfile_Hsi16MHz = 0,
+  SystemClockProfile_Pll42MHz = 1,
+  SystemClockProfile_Pll84MHz = 2
+}systemClockProfile_t;
+
+#define SYSTEM_CLOCK_PROFILES_COUNT 3U
+
+
+
+/*****************************************************************************/
+/*                           PUBLIC STRUCTURES                               */
+/*****************************************************************************/
+
+/*
+  profile         profile the core runs on
+  frequencyHz     its core clock frequency
+  switchesCount   profile switches since reset
+  busyPerMille    share of the last governor period not spent in the RTOS
+                  idle task
+*/
+typedef struct systemClockStatistics {
+  systemClockProfile_t profile;
+  uint32_t frequencyHz;
+  uint32_t switchesCount;
+  uint32_t busyPerMille;
+}systemClockStatistics_t;
+
+
+
+/*****************************************************************************/
+/*                      PUBLIC FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+void SYSTEM_CLOCK_Config(void);
+void SYSTEM_CLOCK_SetProfile(systemClockProfile_t profile);
+void SYSTEM_CLOCK_Governor_Update(void);
+void SYSTEM_CLOCK_GetStatistics(systemClockStatistics_t *statistics);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* SYSTEM_CLOCK_H */
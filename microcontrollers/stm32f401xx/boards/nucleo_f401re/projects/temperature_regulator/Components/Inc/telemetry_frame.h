@@ -0,0 +1,330 @@
+#ifndef TELEMETRY_FRAME_H
+#define TELEMETRY_FRAME_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/*                             PUBLIC DEFINES                                */
+/*****************************************************************************/
+
+/*
+  Everything the device sends on USART1 is a little-endian frame:
+
+  offset  size  field
+       0     1  TELEMETRY_FRAME_SYNC_BYTE
+       1     1  TELEMETRY_FRAME_VERSION
+       2     1  type, telemetryFrameType_t
+       3     1  payload length n
+       4     n  payload
+     4+n     2  CRC-16/CCITT-FALSE of bytes 0 to 3+n
+
+  Payloads, in order:
+
+  Reading             sequence number (2, wraps around), flags (1,
+                      TELEMETRY_FRAME_FLAG_HEATER_ON), ADC code (2),
+                      temperature (2, signed with
+                      TEMPERATURE_FRACTIONAL_BITS), RTC time in seconds (4)
+  Fault               fault (1, telemetryFault_t), RTC time in seconds (4)
+  ConversionBenchmark fixed-point and float cycles per sample (4 each),
+                      hardware FPU used (1), lazy stacking enabled (1)
+  Autotune            finished (1, 0 when the experiment failed), ultimate
+                      gain (4), ultimate period in ms (4), proportional,
+                      integral and derivative gains (4 each), all gains in
+                      the pidSettings_t format
+  LowPower            share of the period asleep in per mille (2), wakeups
+                      in the period (4)
+  Clock               core clock in Hz (4), profile switches since reset
+                      (4), governor load in per mille (2)
+  CpuTask             task name (TELEMETRY_FRAME_NAME_SIZE, NUL padded),
+                      CPU share in per mille (2), longest activation in us
+                      (4)
+  FlashBenchmark      core clock in Hz (4), wait states (1), hundredths of
+                      cycle per byte with the accelerator off and on (4
+                      each)
+  CommandEcho         command name (TELEMETRY_FRAME_COMMAND_NAME_SIZE),
+                      rejected (1, 0 when executed), RTC time in seconds (4)
+  TraceHeader         records (4), overwritten records (4), cycles per
+                      second now (4)
+  TraceTask           task number (1), name (TELEMETRY_FRAME_NAME_SIZE)
+  TraceQueue          queue number (1), name (TELEMETRY_FRAME_NAME_SIZE)
+  TraceRecords        1 to TELEMETRY_FRAME_TRACE_RECORDS_MAX records of DWT
+                      cycles (4), event (1), object (1) and data (2)
+  TraceEnd            nothing
+  Sampling            readings (4), expected, last, shortest and longest
+                      reading period (4 each), largest deviation from the
+                      expected period (4), all in core clock cycles, cycles
+                      per second now (4)
+  TxStatistics        USART1 TX messages queued, dropped for a full ring
+                      buffer and dropped for being longer than it, DMA
+                      transfers and most bytes ever queued (4 each)
+  RxStatistics        USART1 RX command frames received, rejected for
+                      their format, their CRC and an unknown command,
+                      overruns, bytes lost to them and most bytes ever
+                      pending (4 each)
+  CommandStatistics   command name (TELEMETRY_FRAME_COMMAND_NAME_SIZE),
+                      commands dispatched, rejected and replaced before
+                      their owner took them, last and longest latency in
+                      core clock cycles (4 each), cycles per second now (4)
+*/
+#define TELEMETRY_FRAME_SYNC_BYTE 0xA5U
+#define TELEMETRY_FRAME_VERSION   2U
+
+#define TELEMETRY_FRAME_HEADER_SIZE      4U
+#define TELEMETRY_FRAME_CRC_SIZE         2U
+#define TELEMETRY_FRAME_PAYLOAD_SIZE_MAX 32U
+#define TELEMETRY_FRAME_SIZE_MAX (TELEMETRY_FRAME_HEADER_SIZE + \
+  TELEMETRY_FRAME_PAYLOAD_SIZE_MAX + TELEMETRY_FRAME_CRC_SIZE)
+
+#define TELEMETRY_FRAME_NAME_SIZE         24U
+#define TELEMETRY_FRAME_COMMAND_NAME_SIZE 4U
+#define TELEMETRY_FRAME_TRACE_RECORD_SIZE 8U
+#define TELEMETRY_FRAME_TRACE_RECORDS_MAX \
+  (TELEMETRY_FRAME_PAYLOAD_SIZE_MAX / TELEMETRY_FRAME_TRACE_RECORD_SIZE)
+
+#define TELEMETRY_FRAME_FLAG_HEATER_ON 0x01U
+
+
+
+/*****************************************************************************/
+/*                              PUBLIC ENUMS                                 */
+/*****************************************************************************/
+
+typedef enum telemetryFrameType {
+  TelemetryFrame_Reading             = 0x01,
+  TelemetryFrame_Fault               = 0x02,
+  TelemetryFrame_ConversionBenchmark = 0x03,
+  TelemetryFrame_Autotune            = 0x04,
+  TelemetryFrame_LowPower            = 0x05,
+  TelemetryFrame_Clock               = 0x06,
+  TelemetryFrame_CpuTask             = 0x07,
+  TelemetryFrame_FlashBenchmark      = 0x08,
+  TelemetryFrame_CommandEcho         = 0x09,
+  TelemetryFrame_TraceHeader         = 0x0A,
+  TelemetryFrame_TraceTask           = 0x0B,
+  TelemetryFrame_TraceQueue          = 0x0C,
+  TelemetryFrame_TraceRecords        = 0x0D,
+  TelemetryFrame_TraceEnd            = 0x0E,
+  TelemetryFrame_Sampling            = 0x0F,
+  TelemetryFrame_TxStatistics        = 0x10,
+  TelemetryFrame_RxStatistics        = 0x11,
+  TelemetryFrame_CommandStatistics   = 0x12
+}telemetryFrameType_t;
+
+
+
+typedef enum telemetryFault {
+  TelemetryFault_AdcWatchdog = 0x01
+}telemetryFault_t;
+
+
+
+/*****************************************************************************/
+/*                           PUBLIC STRUCTURES                               */
+/*****************************************************************************/
+
+typedef struct telemetrySample {
+  uint16_t sequence;
+  uint8_t flags;
+  uint16_t adcCode;
+  int16_t temperature;
+  uint32_t timeInSeconds;
+}telemetrySample_t;
+
+
+
+typedef struct telemetryFaultReport {
+  uint8_t fault;
+  uint32_t timeInSeconds;
+}telemetryFaultReport_t;
+
+
+
+typedef struct telemetryConversionBenchmark {
+  uint32_t fixedPointCyclesPerSample;
+  uint32_t floatCyclesPerSample;
+  uint8_t isHardwareFpuUsed;
+  uint8_t isLazyStackingEnabled;
+}telemetryConversionBenchmark_t;
+
+
+
+typedef struct telemetryAutotune {
+  uint8_t isFinished;
+  int32_t ultimateGain;
+  uint32_t ultimatePeriodMs;
+  int32_t proportionalGain;
+  int32_t integralGain;
+  int32_t derivativeGain;
+}telemetryAutotune_t;
+
+
+
+typedef struct telemetryLowPower {
+  uint16_t sleepPerMille;
+  uint32_t wakeupsCount;
+}telemetryLowPower_t;
+
+
+
+typedef struct telemetryClock {
+  uint32_t frequencyHz;
+  uint32_t switchesCount;
+  uint16_t busyPerMille;
+}telemetryClock_t;
+
+
+
+typedef struct telemetryCpuTask {
+  char name[TELEMETRY_FRAME_NAME_SIZE + 1];
+  uint16_t cpuPerMille;
+  uint32_t maxActivationUs;
+}telemetryCpuTask_t;
+
+
+
+typedef struct telemetryFlashBenchmark {
+  uint32_t frequencyHz;
+  uint8_t waitStatesCount;
+  uint32_t acceleratorOffCentiCycles;
+  uint32_t acceleratorOnCentiCycles;
+}telemetryFlashBenchmark_t;
+
+
+
+typedef struct telemetryCommandEcho {
+  char name[TELEMETRY_FRAME_COMMAND_NAME_SIZE + 1];
+  uint8_t isRejected;
+  uint32_t timeInSeconds;
+}telemetryCommandEcho_t;
+
+
+
+typedef struct telemetryTraceHeader {
+  uint32_t recordsCount;
+  uint32_t overwrittenCount;
+  uint32_t cyclesPerSecond;
+}telemetryTraceHeader_t;
+
+
+
+/* A task for TraceTask frames, a queue for TraceQueue frames. */
+typedef struct telemetryTraceName {
+  uint8_t number;
+  char name[TELEMETRY_FRAME_NAME_SIZE + 1];
+}telemetryTraceName_t;
+
+
+
+typedef struct telemetryTraceRecords {
+  uint8_t recordsCount;
+  struct {
+    uint32_t cycles;
+    uint8_t event;
+    uint8_t object;
+    uint16_t data;
+  }records[TELEMETRY_FRAME_TRACE_RECORDS_MAX];
+}telemetryTraceRecords_t;
+
+
+
+typedef struct telemetrySampling {
+  uint32_t readingsCount;
+  uint32_t expectedPeriodCycles;
+  uint32_t lastPeriodCycles;
+  uint32_t minPeriodCycles;
+  uint32_t maxPeriodCycles;
+  uint32_t maxJitterCycles;
+  uint32_t cyclesPerSecond;
+}telemetrySampling_t;
+
+
+
+typedef struct telemetryTxStatistics {
+  uint32_t queuedFramesCount;
+  uint32_t overflowFramesCount;
+  uint32_t droppedFramesCount;
+  uint32_t transfersCount;
+  uint32_t maxQueuedBytesCount;
+}telemetryTxStatistics_t;
+
+
+
+typedef struct telemetryRxStatistics {
+  uint32_t receivedFramesCount;
+  uint32_t formatErrorsCount;
+  uint32_t crcErrorsCount;
+  uint32_t unknownCommandsCount;
+  uint32_t overrunsCount;
+  uint32_t lostBytesCount;
+  uint32_t maxPendingBytesCount;
+}telemetryRxStatistics_t;
+
+
+
+typedef struct telemetryCommandStatistics {
+  char name[TELEMETRY_FRAME_COMMAND_NAME_SIZE + 1];
+  uint32_t dispatchedCount;
+  uint32_t rejectedCount;
+  uint32_t droppedCount;
+  uint32_t lastLatencyCycles;
+  uint32_t maxLatencyCycles;
+  uint32_t cyclesPerSecond;
+}telemetryCommandStatistics_t;
+
+
+
+/*
+  type selects the member of the union, TraceEnd has none. Names are NUL
+  terminated, the one extra byte is not sent.
+*/
+typedef struct telemetryMessage {
+  telemetryFrameType_t type;
+  union {
+    telemetrySample_t sample;
+    telemetryFaultReport_t fault;
+    telemetryConversionBenchmark_t conversionBenchmark;
+    telemetryAutotune_t autotune;
+    telemetryLowPower_t lowPower;
+    telemetryClock_t clock;
+    telemetryCpuTask_t cpuTask;
+    telemetryFlashBenchmark_t flashBenchmark;
+    telemetryCommandEcho_t commandEcho;
+    telemetryTraceHeader_t traceHeader;
+    telemetryTraceName_t traceName;
+    telemetryTraceRecords_t traceRecords;
+    telemetrySampling_t sampling;
+    telemetryTxStatistics_t txStatistics;
+    telemetryRxStatistics_t rxStatistics;
+    telemetryCommandStatistics_t commandStatistics;
+  };
+}telemetryMessage_t;
+
+
+
+/*****************************************************************************/
+/*                      PUBLIC FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+uint32_t TELEMETRY_FRAME_Encode(const telemetryMessage_t *message,
+  uint8_t frame[TELEMETRY_FRAME_SIZE_MAX]);
+uint32_t TELEMETRY_FRAME_GetSize(const uint8_t *header);
+int32_t TELEMETRY_FRAME_Decode(const uint8_t *frame, uint32_t size,
+  telemetryMessage_t *message);
+uint16_t TELEMETRY_FRAME_CalculateCrc(const uint8_t *data, uint32_t length);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* TELEMETRY_FRAME_H */
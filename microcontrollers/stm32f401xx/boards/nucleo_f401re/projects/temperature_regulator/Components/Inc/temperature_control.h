@@ -0,0 +1,46 @@
+#ifndef TEMPERATURE_CONTROL_H
+#define TEMPERATURE_CONTROL_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include "pid_controller.h"
+
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/*                           PUBLIC STRUCTURES                               */
+/*****************************************************************************/
+
+/* setPoint and temperature use TEMPERATURE_FRACTIONAL_BITS fractional bits. */
+typedef struct temperatureControl {
+  pidController_t pid;
+  int32_t setPoint;
+  int32_t temperature;
+}temperatureControl_t;
+
+
+
+/*****************************************************************************/
+/*                      PUBLIC FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+void TEMPERATURE_CONTROL_Init(temperatureControl_t *control, int32_t setPoint,
+  uint32_t samplePeriodMs);
+int32_t TEMPERATURE_CONTROL_IsReadingValid(uint32_t filteredReading);
+int32_t TEMPERATURE_CONTROL_Update(temperatureControl_t *control,
+  uint32_t filteredReading);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* TEMPERATURE_CONTROL_H */
@@ -0,0 +1,27 @@
+#ifndef TEMPERATURE_CONVERSION_H
+#define TEMPERATURE_CONVERSION_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/*                      PUBLIC FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+int32_t TEMPERATURE_CONVERSION_ReadingToTemperature(uint32_t filteredReading);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* TEMPERATURE_CONVERSION_H */
@@ -0,0 +1,58 @@
+#ifndef THERMISTOR_LOOKUP_TABLE_H
+#define THERMISTOR_LOOKUP_TABLE_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/*                             PUBLIC DEFINES                                */
+/*****************************************************************************/
+
+#define THERMISTOR_LOOKUP_TABLE_SIZE 4096
+
+#define ADC_MEASUREMENT_MIN  201
+#define ADC_MEASUREMENT_MAX  3975
+
+/*
+  Temperatures are signed Q-format numbers with TEMPERATURE_FRACTIONAL_BITS
+  fractional bits, table entries fit Q7.8 (-128.0 to 127.996 degree Celsius).
+*/
+#define TEMPERATURE_FRACTIONAL_BITS 8
+
+
+
+/*****************************************************************************/
+/*                              PUBLIC MACROS                                */
+/*****************************************************************************/
+
+#define TEMPERATURE_FROM_DEGREES(degrees) \
+  ((degrees) * (1 << TEMPERATURE_FRACTIONAL_BITS))
+
+
+
+/*****************************************************************************/
+/*                         PUBLIC LOOKUP TABLE                               */
+/*****************************************************************************/
+
+/*
+  Generated by Tools/thermistor_lookup_table_generator.c, one entry for each
+  12-bit ADC code. Codes outside [ADC_MEASUREMENT_MIN, ADC_MEASUREMENT_MAX]
+  hold the value of the nearest valid code.
+*/
+extern const int16_t thermistorLookupTable[THERMISTOR_LOOKUP_TABLE_SIZE];
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* THERMISTOR_LOOKUP_TABLE_H */
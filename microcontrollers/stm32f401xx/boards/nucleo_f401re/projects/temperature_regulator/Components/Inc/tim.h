@@ -0,0 +1,34 @@
+#ifndef TIM_H
+#define TIM_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/*                      PUBLIC FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+void TIM2_Clock_Config(void);
+void TIM2_ADC1_Trigger_Config(uint32_t triggerFrequencyHz);
+void TIM2_ADC1_Trigger_Start(void);
+void TIM2_ADC1_Trigger_UpdateClock(void);
+void TIM3_Clock_Config(void);
+void TIM3_LED2_Pattern_Config(uint32_t slotFrequencyHz);
+void TIM3_LED2_Pattern_Start(void);
+void TIM3_LED2_Pattern_UpdateClock(void);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+ 
+#endif  /* TIM_H */
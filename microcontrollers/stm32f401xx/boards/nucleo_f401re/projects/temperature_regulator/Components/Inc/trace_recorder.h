@@ -0,0 +1,111 @@
+#ifndef TRACE_RECORDER_H
+#define TRACE_RECORDER_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/*                             PUBLIC DEFINES                                */
+/*****************************************************************************/
+
+/* 8 bytes per record. Override with -DTRACE_RECORDER_RECORDS_COUNT=<n>. */
+#ifndef TRACE_RECORDER_RECORDS_COUNT
+#define TRACE_RECORDER_RECORDS_COUNT 512U
+#endif
+
+/* Queue numbers 1 to TRACE_RECORDER_QUEUES_MAX, 0 for queues beyond. */
+#define TRACE_RECORDER_QUEUES_MAX 8U
+
+/*
+  Dump sent by the report task on the trace command as TraceHeader,
+  TraceTask, TraceQueue, TraceRecords and TraceEnd telemetry frames, which
+  telemetry_decoder prints one text line each:
+
+    TRACE <records> <overwritten records> <cycles per second now>
+    TASK <task number> <name>
+    QUEUE <queue number> <name>
+    TR <record> [<record> ...]
+    TRACE END
+
+  A record is 16 hex digits: the DWT cycle count (8), the event (2), the
+  object (2) and the data (4).
+*/
+#define TRACE_RECORDER_RECORD_HEX_DIGITS 16U
+
+
+
+/*****************************************************************************/
+/*                              PUBLIC ENUMS                                 */
+/*****************************************************************************/
+
+/*
+  object  task number for the task events, queue number for the queue
+          events, exception number (IRQ number + 16) for the ISR events,
+          core clock in MHz before the switch for the clock event
+  data    messages waiting before the operation for the queue events, core
+          clock in MHz after the switch for the clock event
+*/
+typedef enum traceEvent {
+  TraceEvent_TaskSwitchedIn      = 0x01,
+  TraceEvent_TaskNotify          = 0x02,
+  TraceEvent_TaskNotifyWaitBlock = 0x03,
+  TraceEvent_QueueSend           = 0x10,
+  TraceEvent_QueueSendFailed     = 0x11,
+  TraceEvent_QueueSendBlock      = 0x12,
+  TraceEvent_QueueReceive        = 0x13,
+  TraceEvent_QueueReceiveFailed  = 0x14,
+  TraceEvent_QueueReceiveBlock   = 0x15,
+  TraceEvent_IsrEnter            = 0x20,
+  TraceEvent_IsrExit             = 0x21,
+  TraceEvent_ClockSwitch         = 0x30
+}traceEvent_t;
+
+
+
+/*****************************************************************************/
+/*                           PUBLIC STRUCTURES                               */
+/*****************************************************************************/
+
+typedef struct traceRecord {
+  uint32_t cycles;
+  uint8_t event;
+  uint8_t object;
+  uint16_t data;
+}traceRecord_t;
+
+
+
+/*****************************************************************************/
+/*                      PUBLIC FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+void TRACE_RECORDER_TaskSwitchedIn(uint32_t taskNumber);
+void TRACE_RECORDER_TaskEvent(uint32_t event, uint32_t taskNumber);
+void TRACE_RECORDER_QueueCreated(void *queue);
+void TRACE_RECORDER_QueueEvent(uint32_t event, uint32_t queueNumber,
+  uint32_t messagesWaiting);
+void TRACE_RECORDER_IsrEnter(void);
+void TRACE_RECORDER_IsrExit(void);
+void TRACE_RECORDER_ClockSwitch(uint32_t previousFrequencyMHz,
+  uint32_t frequencyMHz);
+
+uint32_t TRACE_RECORDER_Freeze(uint32_t *overwrittenCount);
+void TRACE_RECORDER_GetRecord(uint32_t index, traceRecord_t *record);
+const char *TRACE_RECORDER_GetQueueName(uint32_t queueNumber);
+void TRACE_RECORDER_Restart(void);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* TRACE_RECORDER_H */
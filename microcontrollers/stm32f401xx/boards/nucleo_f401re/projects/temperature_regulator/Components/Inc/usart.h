@@ -18,6 +18,7 @@ extern "C"
 
 void USART1_Clock_Config(void);
 void USART1_TX_RX_Config(void);
+void USART1_UpdateBaudRate(void);
 
 
 
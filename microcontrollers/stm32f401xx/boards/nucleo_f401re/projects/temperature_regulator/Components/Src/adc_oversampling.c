@@ -0,0 +1,23 @@
+#include "adc_oversampling.h"
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+/*
+  Returns the block average with ADC_OVERSAMPLING_EXTRA_BITS fractional bits.
+  The module has no hardware dependencies, so recorded ADC streams can be fed
+  to it on the host.
+*/
+uint32_t ADC_OVERSAMPLING_ReduceBlock(const uint16_t *samples)
+{
+  uint32_t samplesSum = 0;
+
+  for(uint32_t sample = 0; sample < ADC_OVERSAMPLING_BLOCK_SIZE; ++sample) {
+    samplesSum += samples[sample];
+  }
+
+  return samplesSum >> ADC_OVERSAMPLING_EXTRA_BITS;
+}
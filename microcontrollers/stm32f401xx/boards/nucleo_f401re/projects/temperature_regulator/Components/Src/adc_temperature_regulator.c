@@ -1,18 +1,30 @@
+#include "adc_oversampling.h"
 #include "adc_temperature_regulator.h"
+#include "command_dispatcher.h"
+#include "conversion_benchmark.h"
 #include "dma.h"
+#include "dwt.h"
+#include "heater_relay.h"
+#include "relay_autotuner.h"
+#include "relay_window.h"
 #include "rtc.h"
+#include "telemetry_frame.h"
+#include "temperature_control.h"
+#include "temperature_conversion.h"
+#include "thermistor_lookup_table.h"
+#include "tim.h"
 
 #include "cmsis_os2.h"
 
+#include "FreeRTOS.h"
+#include "queue.h"
+
 #include "stm32f4xx.h"
 
 #include "stm32f4xx_ll_adc.h"
 #include "stm32f4xx_ll_bus.h"
-#include "stm32f4xx_ll_gpio.h"
-
-#include <inttypes.h>
-#include <stdio.h>
-#include <string.h>
+#include "stm32f4xx_ll_dma.h"
+#include "stm32f4xx_ll_rcc.h"
 
 
 
@@ -20,142 +32,152 @@
 /*                            PRIVATE DEFINES                                */
 /*****************************************************************************/
 
-#define RELAY_HEATER_GPIO_PIN   LL_GPIO_PIN_8
-#define RELAY_HEATER_GPIO_PORT  GPIOA
-
-#define ADC_MEASUREMENT_MIN  201
-#define ADC_MEASUREMENT_MAX  3975
-
-#define TEMPERATURE_SET_POINT 35.0f
-#define TEMPERATURE_ALLOWABLE_MARGIN 0.25f
-
-#define TEMPERATURE_COUNT 156
-#define THERMISTOR_RESISTANCE_COUNT TEMPERATURE_COUNT
-
+/*
+  Temperatures are fixed-point numbers with TEMPERATURE_FRACTIONAL_BITS
+  fractional bits, the same format as the thermistor lookup table.
+*/
+#define TEMPERATURE_SET_POINT TEMPERATURE_FROM_DEGREES(35)
+
+#define TEMPERATURE_DECIMAL_SCALE 10
+
+/*
+  Conversions are triggered by TIM2 update events, so one oversampling block
+  of 256 samples at 256 Hz gives exactly one filtered reading per second.
+*/
+#define ADC1_SAMPLING_FREQUENCY_HZ 256
+#define ADC1_READING_PERIOD_MS \
+  ((1000 * ADC_OVERSAMPLING_BLOCK_SIZE) / ADC1_SAMPLING_FREQUENCY_HZ)
+
+#define ADC1_DMA_BUFFER_SIZE (2 * ADC_OVERSAMPLING_BLOCK_SIZE)
+#define ADC1_DMA_IRQ_PRIORITY 6
+
+/*
+  APB2 is divided by the smallest prescaler (2, 4, 6) that brings the ADC
+  clock down to 2 MHz, by 8 when none does. APB2 runs at the core clock,
+  so every profile ends on 8: 2 MHz at 16 MHz, 5.25 MHz at 42 MHz and
+  10.5 MHz at 84 MHz, and the 480 cycle sampling time lasts 240, 91 and
+  46 us. The source impedance of the divider (10 kOhm and the NTC) stays
+  below 10 kOhm. With the 6 kOhm sampling switch and 4 pF hold capacitor
+  of the datasheet, the capacitor settles to 1/4 LSB of 12 bits in
+  16 kOhm * 4 pF * ln(2^14) = 0.62 us, 6.5 ADC cycles at 10.5 MHz, so the
+  84 MHz profile still samples 70 times longer than needed.
+*/
+#define ADC1_CLOCK_TARGET_HZ 2000000U
+
+/*
+  Highest priority still allowed to call RTOS functions, so that a single
+  out of range conversion switches the heater off ahead of everything else.
+*/
+#define ADC1_WATCHDOG_IRQ_PRIORITY 5
+
+#define ADC1_READING_READY_FLAG   0x01U
+#define ADC1_WATCHDOG_FAULT_FLAG  0x02U
+#define ADC1_READING_TIMEOUT_MS (2 * ADC1_READING_PERIOD_MS)
+
+#define CONTROL_SETTINGS_QUEUE_MESSAGES_COUNT (uint32_t)1
+#define AUTOTUNE_REQUEST_QUEUE_MESSAGES_COUNT (uint32_t)1
+
+/*
+  Relay experiment around the set point. One oscillation of the oven takes
+  from two minutes to over twenty, hence the long timeout.
+*/
+#define AUTOTUNE_HYSTERESIS_TENTHS_DEFAULT 3
+#define AUTOTUNE_CYCLES_COUNT_DEFAULT 4
+#define AUTOTUNE_TIMEOUT_MS (4 * 60 * 60 * 1000U)
+
+/* Autotune command payload: hysteresis in tenths of degree, cycles. */
+#define AUTOTUNE_PAYLOAD_SIZE    2U
+#define AUTOTUNE_HYSTERESIS_BYTE 0
+#define AUTOTUNE_CYCLES_BYTE     1
+#define AUTOTUNE_COMMAND_NAME    "TUNE"
+
+/*
+  Control settings command payload, little-endian: proportional, integral
+  and derivative gains as int32 with PID_CONTROLLER_FRACTIONAL_BITS, the
+  derivative filter shift and the relay window in milliseconds as uint16.
+*/
+#define CONTROL_SETTINGS_PAYLOAD_SIZE      15U
+#define CONTROL_SETTINGS_PROPORTIONAL_BYTE 0
+#define CONTROL_SETTINGS_INTEGRAL_BYTE     4
+#define CONTROL_SETTINGS_DERIVATIVE_BYTE   8
+#define CONTROL_SETTINGS_FILTER_SHIFT_BYTE 12
+#define CONTROL_SETTINGS_WINDOW_BYTE       13
+#define CONTROL_SETTINGS_COMMAND_NAME      "CTRL"
+
+/*
+  Accepted ranges. The gain limit keeps every PID product well inside 64
+  bits, the window has to hold several readings and relay switch times.
+*/
+#define CONTROL_SETTINGS_GAIN_MAX         (1 << 24)
+#define CONTROL_SETTINGS_FILTER_SHIFT_MAX 8U
+#define CONTROL_SETTINGS_WINDOW_MS_MIN    (4 * ADC1_READING_PERIOD_MS)
+#define CONTROL_SETTINGS_WINDOW_MS_MAX    60000U
 
 
 
 /*****************************************************************************/
-/*                             PRIVATE MACROS                                */
+/*                             PRIVATE ENUMS                                 */
 /*****************************************************************************/
 
-#define ADC1_IS_CONVERSION_COMPLETE() LL_ADC_IsActiveFlag_EOCS(ADC1)
+enum isAdc1Enabled {
+  ADC1_Disabled = 0,
+  ADC1_Enabled  = 1
+};
 
-#define TURN_ON_HEATER()   LL_GPIO_ResetOutputPin(RELAY_HEATER_GPIO_PORT,\
-                                                  RELAY_HEATER_GPIO_PIN)
-#define TURN_OFF_HEATER()  LL_GPIO_SetOutputPin(RELAY_HEATER_GPIO_PORT,\
-                                                RELAY_HEATER_GPIO_PIN)
 
 
 
 /*****************************************************************************/
-/*                             PRIVATE ENUMS                                 */
+/*                           PRIVATE VARIABLES                               */
 /*****************************************************************************/
 
-enum isAdc1Enabled {
-  ADC1_Disabled = 0,
-  ADC1_Enabled  = 1
-};
+/*
+  Ping-pong buffer filled by DMA2 Stream0 in circular mode. Each half holds
+  one oversampling block, reduced by the half and full transfer interrupts
+  while the other half is being written.
+*/
+static uint16_t adc1DmaBuffer[ADC1_DMA_BUFFER_SIZE];
 
+static volatile uint32_t adc1FilteredReading;
 
+static osThreadId_t adc1TemperatureRegulatorTaskHandle;
 
-enum isAdc1ConversionComplete {
-  ADC1_Conversion_NotComplete = 0,
-  ADC1_Conversion_Complete   = 1
-};
+static adc1SamplingStatistics_t adc1SamplingStatistics;
+static uint32_t adc1LastReadingCycleCount;
+static uint32_t isAdc1PeriodMixed;
 
+static osMessageQueueId_t controlSettingsQueueHandle;
+static osMessageQueueId_t autotuneRequestQueueHandle;
+static temperatureControl_t temperatureControl;
+static uint32_t relayWindowMs;
 
+static relayAutotuner_t relayAutotuner;
+static uint32_t isAutotuneRunning;
 
-typedef enum heaterState {
-  Heater_On  = 0,
-  Heater_Off = 1
-}heaterState_t;
+static uint8_t telemetryFrame[TELEMETRY_FRAME_SIZE_MAX];
+static uint16_t telemetrySequence;
 
 
 
 /*****************************************************************************/
-/*                           REFERENCE TABLES                                */
+/*                           PRIVATE STRUCTURES                              */
 /*****************************************************************************/
 
-static const uint32_t thermistorResistanceTable[THERMISTOR_RESISTANCE_COUNT]= {
- 193500, 181461, 170268, 159850, 150146,
- 141100, 132659, 124779, 117418, 110537,
- 104101,  98079,  92440,  87159,  82210,
-  77571,  73219,  69137,  65305,  61707,
-  58328,  55153,  52169,  49363,  46724,
-  44241,  41904,  39704,  37633,  35681,
-  33800,  32108,  30474,  28932,  27477,
-  26104,  24807,  23583,  22426,  21333,
-  20300,  19322,  18398,  17523,  16695,
-  15912,  15169,  14466,  13799,  13167,
-  12568,  11999,  11460,  10948,  10461,
-  10000,   9561,   9144,   8747,   8370,
-   8011,   7670,   7345,   7036,   6741,
-   6461,   6193,   5938,   5695,   5464,
-   5242,   5031,   4830,   4638,   4454,
-   4279,   4111,   3951,   3797,   3651,
-   3511,   3377,   3248,   3126,   3008,
-   2896,   2788,   2684,   2585,   2490,
-   2400,   2312,   2229,   2148,   2071,
-   1997,   1927,   1858,   1793,   1730,
-   1670,   1612,   1556,   1503,   1451,
-   1402,   1354,   1309,   1265,   1222,
-   1181,   1142,   1104,   1068,   1033,
-   1000,    967,    936,    906,    877,
-    849,    822,    796,    771,    747,
-    723,    701,    679,    658,    638,
-    600,    600,    582,    564,    548,
-    531,    516,    500,    486,    472,
-    458,    445,    432,    419,    407,
-    396,    385,    374,    364,    353,
-    344,    334,    325,    316,    308,
-    300
-};
+typedef struct autotuneRequest {
+  uint32_t hysteresisTenths;
+  uint32_t cyclesCount;
+}autotuneRequest_t;
 
-static const int temperatureTable[TEMPERATURE_COUNT] = {
-  -30, -29, -28, -27, -26,
-  -25, -24, -23, -22, -21,
-  -20, -19, -18, -17, -16,
-  -15, -14, -13, -12, -11,
-  -10,  -9,  -8,  -7,  -6,
-   -5,  -4,  -3,  -2,  -1,
-    0,   1,   2,   3,   4,
-    5,   6,   7,   8,   9,
-   10,  11,  12,  13,  14,
-   15,  16,  17,  18,  19,
-   20,  21,  22,  23,  24,
-   25,  26,  27,  28,  29,
-   30,  31,  32,  33,  34,
-   35,  36,  37,  38,  39,
-   40,  41,  42,  43,  44,
-   45,  46,  47,  48,  49,
-   50,  51,  52,  53,  54,
-   55,  56,  57,  58,  59,
-   60,  61,  62,  63,  64,
-   65,  66,  67,  68,  69,
-   70,  71,  72,  73,  74,
-   75,  76,  77,  78,  79,
-   80,  81,  82,  83,  84,
-   85,  86,  87,  88,  89,
-   90,  91,  92,  93,  94,
-   95,  96,  97,  98,  99,
-  100, 101, 102, 103, 104,
-  105, 106, 107, 108, 109,
-  110, 111, 112, 113, 114,
-  115, 116, 117, 118, 119,
-  120, 121, 122, 123, 124,
-  125
-};
 
 
+static StaticQueue_t controlSettingsQueueControlBlock;
+static uint8_t controlSettingsQueueStorage[
+  CONTROL_SETTINGS_QUEUE_MESSAGES_COUNT * sizeof(temperatureControlSettings_t)];
 
-/*****************************************************************************/
-/*                           PRIVATE STRUCTURES                              */
-/*****************************************************************************/
+static StaticQueue_t autotuneRequestQueueControlBlock;
+static uint8_t autotuneRequestQueueStorage[
+  AUTOTUNE_REQUEST_QUEUE_MESSAGES_COUNT * sizeof(autotuneRequest_t)];
 
-static struct __attribute__((packed)) {
-  char dataString[40];
-}feedbackMessage;
 
 
 
@@ -163,13 +185,28 @@ static struct __attribute__((packed)) {
 /*                     PRIVATE FUNCTIONS PROTOTYPES                          */
 /*****************************************************************************/
 
-static uint32_t StartAndReadAdcConversion(void);
-static uint32_t CalculateThermistorResistance(uint32_t adcMeasurement);
-static float FindTemperature(uint32_t thermistorResistance);
-static uint32_t FindTableIndex(uint32_t thermistorResistance);
-static heaterState_t CheckHeaterState(void);
-static void UpdateFeedbackMessage(heaterState_t heaterState,
-  uint32_t adcMeasurement, float temperature);
+static uint32_t GetCommonClockPrescaler(void);
+static void StartTriggeredConversions(void);
+static void RearmAnalogWatchdog(void);
+static void PublishFilteredReading(const uint16_t *samplesBlock);
+static void UpdateSamplingStatistics(void);
+static void InitializeTemperatureControl(void);
+static void ApplyPendingControlSettings(void);
+static void StartPendingAutotune(void);
+static int32_t RunAutotuneStep(int32_t temperature);
+static void FinishAutotune(relayAutotunerStatus_t status);
+static void StopHeating(void);
+static void SendTelemetrySample(heaterState_t heaterState,
+  uint32_t adcMeasurement, int32_t temperature);
+static void SendFaultReport(void);
+static void SendAutotuneReport(relayAutotunerStatus_t status);
+static void SendTelemetryMessage(const telemetryMessage_t *message);
+static int32_t HandleAutotuneCommand(const uint8_t *payload);
+static int32_t HandleControlSettingsCommand(const uint8_t *payload);
+static int32_t AreControlSettingsValid(
+  const temperatureControlSettings_t *settings);
+static uint32_t GetPayloadUint32(const uint8_t *source);
+
 
 
 /*****************************************************************************/
@@ -195,28 +232,235 @@ void ADC1_TEMPERATURE_REGULATOR_Settings_Config(void)
     LL_ADC_SAMPLINGTIME_480CYCLES);
 
   LL_ADC_REG_InitTypeDef ADC1_TEMPERATURE_REGULATOR_REG_InitStruct = {
-    .TriggerSource    = LL_ADC_REG_TRIG_SOFTWARE,
+    .TriggerSource    = LL_ADC_REG_TRIG_EXT_TIM2_TRGO,
     .SequencerLength  = LL_ADC_REG_SEQ_SCAN_DISABLE,
     .SequencerDiscont = LL_ADC_REG_SEQ_DISCONT_DISABLE,
     .ContinuousMode   = LL_ADC_REG_CONV_SINGLE,
-    .DMATransfer      = LL_ADC_REG_DMA_TRANSFER_NONE 
+    .DMATransfer      = LL_ADC_REG_DMA_TRANSFER_UNLIMITED
   };
   LL_ADC_REG_Init(ADC1, &ADC1_TEMPERATURE_REGULATOR_REG_InitStruct);
   LL_ADC_REG_SetFlagEndOfConversion(ADC1, LL_ADC_REG_FLAG_EOC_UNITARY_CONV);
   LL_ADC_REG_SetSequencerRanks(ADC1, LL_ADC_REG_RANK_1, LL_ADC_CHANNEL_0);
 
   LL_ADC_CommonInitTypeDef ADC1_TEMPERATURE_REGULATOR_CommonInitStruct = {
-    .CommonClock = LL_ADC_CLOCK_SYNC_PCLK_DIV8
+    .CommonClock = GetCommonClockPrescaler()
   };
   LL_ADC_CommonInit(__LL_ADC_COMMON_INSTANCE(ADC1),
     &ADC1_TEMPERATURE_REGULATOR_CommonInitStruct);
 
   LL_ADC_DisableIT_EOCS(ADC1);
 
+  /*
+    Every single conversion is checked against the valid thermistor range by
+    the analog watchdog, long before the oversampling block is complete.
+  */
+  LL_ADC_SetAnalogWDMonitChannels(ADC1, LL_ADC_AWD_CHANNEL_0_REG);
+  LL_ADC_SetAnalogWDThresholds(ADC1, LL_ADC_AWD_THRESHOLD_LOW,
+    ADC_MEASUREMENT_MIN);
+  LL_ADC_SetAnalogWDThresholds(ADC1, LL_ADC_AWD_THRESHOLD_HIGH,
+    ADC_MEASUREMENT_MAX);
+  LL_ADC_ClearFlag_AWD1(ADC1);
+  LL_ADC_EnableIT_AWD1(ADC1);
+
+  NVIC_SetPriority(ADC_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(),
+    ADC1_WATCHDOG_IRQ_PRIORITY, 0));
+  NVIC_EnableIRQ(ADC_IRQn);
+
   LL_ADC_Enable(ADC1);
   while(LL_ADC_IsEnabled(ADC1) != ADC1_Enabled) {
     ;
   }
+
+  TIM2_ADC1_Trigger_Config(ADC1_SAMPLING_FREQUENCY_HZ);
+}
+
+
+
+void ADC1_TEMPERATURE_REGULATOR_DMA_Config(void)
+{
+  LL_DMA_SetChannelSelection(DMA2, LL_DMA_STREAM_0, LL_DMA_CHANNEL_0);
+  LL_DMA_SetDataTransferDirection(DMA2, LL_DMA_STREAM_0,
+                                  LL_DMA_DIRECTION_PERIPH_TO_MEMORY);
+  LL_DMA_SetStreamPriorityLevel(DMA2, LL_DMA_STREAM_0, LL_DMA_PRIORITY_HIGH);
+  LL_DMA_SetMode(DMA2, LL_DMA_STREAM_0, LL_DMA_MODE_CIRCULAR);
+  LL_DMA_SetPeriphIncMode(DMA2, LL_DMA_STREAM_0, LL_DMA_PERIPH_NOINCREMENT);
+  LL_DMA_SetMemoryIncMode(DMA2, LL_DMA_STREAM_0, LL_DMA_MEMORY_INCREMENT);
+  LL_DMA_SetPeriphSize(DMA2, LL_DMA_STREAM_0, LL_DMA_PDATAALIGN_HALFWORD);
+  LL_DMA_SetMemorySize(DMA2, LL_DMA_STREAM_0, LL_DMA_MDATAALIGN_HALFWORD);
+  LL_DMA_DisableFifoMode(DMA2, LL_DMA_STREAM_0);
+
+  LL_DMA_SetPeriphAddress(DMA2, LL_DMA_STREAM_0,
+    LL_ADC_DMA_GetRegAddr(ADC1, LL_ADC_DMA_REG_REGULAR_DATA));
+  LL_DMA_SetMemoryAddress(DMA2, LL_DMA_STREAM_0, (uint32_t)adc1DmaBuffer);
+  LL_DMA_SetDataLength(DMA2, LL_DMA_STREAM_0, ADC1_DMA_BUFFER_SIZE);
+
+  LL_DMA_EnableIT_HT(DMA2, LL_DMA_STREAM_0);
+  LL_DMA_EnableIT_TC(DMA2, LL_DMA_STREAM_0);
+
+  NVIC_SetPriority(DMA2_Stream0_IRQn,
+    NVIC_EncodePriority(NVIC_GetPriorityGrouping(), ADC1_DMA_IRQ_PRIORITY, 0));
+  NVIC_EnableIRQ(DMA2_Stream0_IRQn);
+}
+
+
+
+void ADC1_TEMPERATURE_REGULATOR_GetSamplingStatistics(
+  adc1SamplingStatistics_t *statistics)
+{
+  __disable_irq();
+  *statistics = adc1SamplingStatistics;
+  __enable_irq();
+}
+
+
+
+/*
+  Called with interrupts disabled after a system clock switch. The
+  prescaler can only change with ADC1 off, a trigger coming meanwhile is
+  missed. Sampling statistics start again at the new cycle rate, the
+  reading period the switch falls in is left out.
+*/
+void ADC1_TEMPERATURE_REGULATOR_UpdateClock(void)
+{
+  uint32_t commonClock = GetCommonClockPrescaler();
+
+  if(commonClock != LL_ADC_GetCommonClock(__LL_ADC_COMMON_INSTANCE(ADC1))) {
+    LL_ADC_Disable(ADC1);
+    LL_ADC_SetCommonClock(__LL_ADC_COMMON_INSTANCE(ADC1), commonClock);
+    LL_ADC_Enable(ADC1);
+    while(LL_ADC_IsEnabled(ADC1) != ADC1_Enabled) {
+      ;
+    }
+  }
+
+  adc1SamplingStatistics_t *statistics = &adc1SamplingStatistics;
+  statistics->expectedPeriodCycles = (SystemCoreClock /
+    ADC1_SAMPLING_FREQUENCY_HZ) * ADC_OVERSAMPLING_BLOCK_SIZE;
+  statistics->minPeriodCycles = statistics->expectedPeriodCycles;
+  statistics->maxPeriodCycles = statistics->expectedPeriodCycles;
+  statistics->maxJitterCycles = 0;
+  isAdc1PeriodMixed = 1;
+}
+
+
+
+void ADC1_TEMPERATURE_REGULATOR_DMA_HalfTransfer_Callback(void)
+{
+  PublishFilteredReading(&adc1DmaBuffer[0]);
+}
+
+
+
+void ADC1_TEMPERATURE_REGULATOR_DMA_TransferComplete_Callback(void)
+{
+  PublishFilteredReading(&adc1DmaBuffer[ADC_OVERSAMPLING_BLOCK_SIZE]);
+}
+
+
+
+/*
+  Takes effect at the next filtered reading. Safe to call from any task once
+  the regulator task runs, settings sent before that are dropped. Returns 1
+  when these settings are dropped or replace ones not applied yet.
+*/
+int32_t ADC1_TEMPERATURE_REGULATOR_SetControlSettings(
+  const temperatureControlSettings_t *settings)
+{
+  if(controlSettingsQueueHandle == NULL) {
+    return 1;
+  }
+
+  uint32_t pendingCount = osMessageQueueGetCount(controlSettingsQueueHandle);
+  osMessageQueueReset(controlSettingsQueueHandle);
+  osMessageQueuePut(controlSettingsQueueHandle, settings, 0, 0);
+
+  return pendingCount != 0;
+}
+
+
+
+/*
+  Runs a relay experiment around the set point and replaces the PID gains
+  with the ones derived from it. Zero arguments select the defaults,
+  hysteresis is in tenths of degree. Returns 1 when the request is dropped
+  or replaces one not started yet, as for the control settings.
+*/
+int32_t ADC1_TEMPERATURE_REGULATOR_StartAutotune(uint32_t hysteresisTenths,
+  uint32_t cyclesCount)
+{
+  if(autotuneRequestQueueHandle == NULL) {
+    return 1;
+  }
+
+  autotuneRequest_t request = {
+    .hysteresisTenths = hysteresisTenths != 0 ? hysteresisTenths :
+      AUTOTUNE_HYSTERESIS_TENTHS_DEFAULT,
+    .cyclesCount = cyclesCount != 0 ? cyclesCount :
+      AUTOTUNE_CYCLES_COUNT_DEFAULT
+  };
+  uint32_t pendingCount = osMessageQueueGetCount(autotuneRequestQueueHandle);
+  osMessageQueueReset(autotuneRequestQueueHandle);
+  osMessageQueuePut(autotuneRequestQueueHandle, &request, 0, 0);
+
+  return pendingCount != 0;
+}
+
+
+
+/*
+  Both commands run in the USART1 RX task, they only queue the request or
+  the checked settings for the regulator task.
+*/
+void ADC1_TEMPERATURE_REGULATOR_RegisterCommands(void)
+{
+  COMMAND_DISPATCHER_RegisterHandler(COMMAND_FRAME_ID_AUTOTUNE,
+    AUTOTUNE_PAYLOAD_SIZE, AUTOTUNE_COMMAND_NAME, HandleAutotuneCommand);
+  COMMAND_DISPATCHER_RegisterHandler(COMMAND_FRAME_ID_CONTROL_SETTINGS,
+    CONTROL_SETTINGS_PAYLOAD_SIZE, CONTROL_SETTINGS_COMMAND_NAME,
+    HandleControlSettingsCommand);
+}
+
+
+
+/*
+  Runs once from main, before the scheduler starts and while the heater is
+  still off, and queues the conversion benchmark frame, sent once the
+  scheduler runs. No task ever touches the FPU for it.
+*/
+void ADC1_TEMPERATURE_REGULATOR_RunConversionBenchmark(void)
+{
+  conversionBenchmarkResults_t results;
+  CONVERSION_BENCHMARK_Run(&results);
+
+  const telemetryMessage_t message = {
+    .type = TelemetryFrame_ConversionBenchmark,
+    .conversionBenchmark = {
+      .fixedPointCyclesPerSample = results.fixedPointCyclesPerSample,
+      .floatCyclesPerSample = results.floatCyclesPerSample,
+      .isHardwareFpuUsed = (uint8_t)results.isHardwareFpuUsed,
+      .isLazyStackingEnabled = (uint8_t)results.isLazyStackingEnabled
+    }
+  };
+  SendTelemetryMessage(&message);
+}
+
+
+
+/*
+  Cuts the heater straight from the interrupt and keeps the relay disabled.
+  The watchdog interrupt and the relay stay disabled until the task gets
+  a valid filtered reading again, so a missing thermistor does not
+  interrupt every conversion.
+*/
+void ADC1_TEMPERATURE_REGULATOR_AnalogWatchdog_Callback(void)
+{
+  HEATER_RELAY_Disable();
+  LL_ADC_DisableIT_AWD1(ADC1);
+
+  if(adc1TemperatureRegulatorTaskHandle != NULL) {
+    osThreadFlagsSet(adc1TemperatureRegulatorTaskHandle,
+      ADC1_WATCHDOG_FAULT_FLAG);
+  }
 }
 
 
@@ -227,37 +471,56 @@ void ADC1_TEMPERATURE_REGULATOR_Settings_Config(void)
 
 void StartAdc1TemperatureRegulatorTask(void *argument)
 {
+  uint32_t filteredReading = 0;
   uint32_t adcMeasurement = 0;
-  uint32_t thermistorResistance = 0;
-  float temperature = 0;
+  int32_t temperature = 0;
+  int32_t heaterDuty = 0;
+  uint32_t readingFlags = 0;
 
-  TURN_OFF_HEATER();
+  adc1TemperatureRegulatorTaskHandle = osThreadGetId();
+  InitializeTemperatureControl();
+  StartTriggeredConversions();
 
   for(;;)
   {
-    adcMeasurement = StartAndReadAdcConversion();
-    if(adcMeasurement < ADC_MEASUREMENT_MIN ||
-      adcMeasurement > ADC_MEASUREMENT_MAX) {
-      TURN_OFF_HEATER();
-      osDelay(1000);
+    readingFlags = osThreadFlagsWait(
+      ADC1_READING_READY_FLAG | ADC1_WATCHDOG_FAULT_FLAG, osFlagsWaitAny,
+      ADC1_READING_TIMEOUT_MS);
+    if((readingFlags & osFlagsError) != 0) {
+      StopHeating();
       continue;
     }
 
-    thermistorResistance = CalculateThermistorResistance(adcMeasurement);
-    temperature = FindTemperature(thermistorResistance);
-    if(temperature <= TEMPERATURE_SET_POINT - TEMPERATURE_ALLOWABLE_MARGIN
-      && CheckHeaterState() == Heater_Off) {
-      TURN_ON_HEATER();
-    } else if(temperature >= TEMPERATURE_SET_POINT + 
-      TEMPERATURE_ALLOWABLE_MARGIN && CheckHeaterState() == Heater_On) {
-      TURN_OFF_HEATER();
+    if((readingFlags & ADC1_WATCHDOG_FAULT_FLAG) != 0) {
+      SendFaultReport();
+    }
+    if((readingFlags & ADC1_READING_READY_FLAG) == 0) {
+      continue;
     }
 
-    UpdateFeedbackMessage(CheckHeaterState(), adcMeasurement, temperature);
-    DMA2_USART1_TX_SendFeedbackMessage(&feedbackMessage,
-      sizeof(feedbackMessage));
+    filteredReading = adc1FilteredReading;
+    if(TEMPERATURE_CONTROL_IsReadingValid(filteredReading) == 0) {
+      StopHeating();
+      continue;
+    }
+    RearmAnalogWatchdog();
+    StartPendingAutotune();
+    ApplyPendingControlSettings();
+
+    if(isAutotuneRunning != 0) {
+      temperature =
+        TEMPERATURE_CONVERSION_ReadingToTemperature(filteredReading);
+      heaterDuty = RunAutotuneStep(temperature);
+    } else {
+      heaterDuty = TEMPERATURE_CONTROL_Update(&temperatureControl,
+        filteredReading);
+      temperature = temperatureControl.temperature;
+    }
+    HEATER_RELAY_SetDuty((uint32_t)heaterDuty);
 
-    osDelay(1000);
+    adcMeasurement = ADC_OVERSAMPLING_TO_ADC_CODE(filteredReading);
+    SendTelemetrySample(HEATER_RELAY_GetState(), adcMeasurement,
+      temperature);
   }
 }
 
@@ -267,112 +530,375 @@ void StartAdc1TemperatureRegulatorTask(void *argument)
 /*                     PRIVATE FUNCTIONS DEFINITIONS                         */
 /*****************************************************************************/
 
-static uint32_t StartAndReadAdcConversion(void)
+static uint32_t GetCommonClockPrescaler(void)
 {
-  LL_ADC_REG_StartConversionSWStart(ADC1);
-  while(ADC1_IS_CONVERSION_COMPLETE() == ADC1_Conversion_NotComplete) {
-    ;
+  static const uint32_t prescalers[][2] = {
+    { 2U, LL_ADC_CLOCK_SYNC_PCLK_DIV2 },
+    { 4U, LL_ADC_CLOCK_SYNC_PCLK_DIV4 },
+    { 6U, LL_ADC_CLOCK_SYNC_PCLK_DIV6 }
+  };
+
+  LL_RCC_ClocksTypeDef systemClocks;
+  LL_RCC_GetSystemClocksFreq(&systemClocks);
+
+  for(uint32_t index = 0;
+    index < sizeof(prescalers) / sizeof(prescalers[0]); ++index) {
+    if(systemClocks.PCLK2_Frequency / prescalers[index][0] <=
+      ADC1_CLOCK_TARGET_HZ) {
+      return prescalers[index][1];
+    }
   }
 
-  return LL_ADC_REG_ReadConversionData12(ADC1);
+  return LL_ADC_CLOCK_SYNC_PCLK_DIV8;
 }
 
 
 
-static uint32_t CalculateThermistorResistance(uint32_t adcMeasurement)
+/*
+  LL_ADC_REG_Init only selects the trigger source, the conversions follow
+  TRGO once its edge is enabled.
+*/
+static void StartTriggeredConversions(void)
 {
-  const float adcResolution = 4095.0f;
-  const float resistanceOfVoltageDividerResistor = 10000.0f;
+  LL_DMA_EnableStream(DMA2, LL_DMA_STREAM_0);
+  LL_ADC_REG_StartConversionExtTrig(ADC1, LL_ADC_REG_TRIG_EXT_RISING);
 
-  uint32_t thermistorResistance = resistanceOfVoltageDividerResistor *
-    (adcResolution/adcMeasurement - 1.0f);
-  return thermistorResistance;
+  adc1SamplingStatistics.expectedPeriodCycles =
+    (SystemCoreClock / ADC1_SAMPLING_FREQUENCY_HZ) * ADC_OVERSAMPLING_BLOCK_SIZE;
+  adc1LastReadingCycleCount = DWT_GetCycleCount();
+  TIM2_ADC1_Trigger_Start();
 }
 
 
 
-static float FindTemperature(uint32_t thermistorResistance)
+static void RearmAnalogWatchdog(void)
 {
-  uint32_t tableIndex = FindTableIndex(thermistorResistance);
-  uint32_t referenceResistance = thermistorResistanceTable[tableIndex];
-  int referenceTemperature = temperatureTable[tableIndex];
+  if(LL_ADC_IsEnabledIT_AWD1(ADC1) == 0) {
+    LL_ADC_ClearFlag_AWD1(ADC1);
+    LL_ADC_EnableIT_AWD1(ADC1);
+    HEATER_RELAY_Enable();
+  }
+}
+
+
+
+static void PublishFilteredReading(const uint16_t *samplesBlock)
+{
+  UpdateSamplingStatistics();
+
+  adc1FilteredReading = ADC_OVERSAMPLING_ReduceBlock(samplesBlock);
+  osThreadFlagsSet(adc1TemperatureRegulatorTaskHandle,
+    ADC1_READING_READY_FLAG);
+}
+
+
+
+static void UpdateSamplingStatistics(void)
+{
+  uint32_t cycleCount = DWT_GetCycleCount();
+  uint32_t periodCycles = cycleCount - adc1LastReadingCycleCount;
+  adc1LastReadingCycleCount = cycleCount;
+
+  adc1SamplingStatistics_t *statistics = &adc1SamplingStatistics;
+  if(isAdc1PeriodMixed != 0) {
+    isAdc1PeriodMixed = 0;
+    ++statistics->readingsCount;
+    return;
+  }
+
+  statistics->lastPeriodCycles = periodCycles;
+  if(statistics->readingsCount == 0 ||
+    periodCycles < statistics->minPeriodCycles) {
+    statistics->minPeriodCycles = periodCycles;
+  }
+  if(periodCycles > statistics->maxPeriodCycles) {
+    statistics->maxPeriodCycles = periodCycles;
+  }
+
+  uint32_t deviationCycles = periodCycles > statistics->expectedPeriodCycles ?
+    periodCycles - statistics->expectedPeriodCycles :
+    statistics->expectedPeriodCycles - periodCycles;
+  if(deviationCycles > statistics->maxJitterCycles) {
+    statistics->maxJitterCycles = deviationCycles;
+  }
+
+  ++statistics->readingsCount;
+}
+
+
+
+static void InitializeTemperatureControl(void)
+{
+  TEMPERATURE_CONTROL_Init(&temperatureControl, TEMPERATURE_SET_POINT,
+    ADC1_READING_PERIOD_MS);
+
+  const osMessageQueueAttr_t controlSettingsQueueAttributes = {
+    .name = "ControlSettingsQueue",
+    .cb_mem = &controlSettingsQueueControlBlock,
+    .cb_size = sizeof(controlSettingsQueueControlBlock),
+    .mq_mem = controlSettingsQueueStorage,
+    .mq_size = sizeof(controlSettingsQueueStorage)
+  };
+  controlSettingsQueueHandle = osMessageQueueNew(
+    CONTROL_SETTINGS_QUEUE_MESSAGES_COUNT,
+    sizeof(temperatureControlSettings_t), &controlSettingsQueueAttributes);
+
+  const osMessageQueueAttr_t autotuneRequestQueueAttributes = {
+    .name = "AutotuneRequestQueue",
+    .cb_mem = &autotuneRequestQueueControlBlock,
+    .cb_size = sizeof(autotuneRequestQueueControlBlock),
+    .mq_mem = autotuneRequestQueueStorage,
+    .mq_size = sizeof(autotuneRequestQueueStorage)
+  };
+  autotuneRequestQueueHandle = osMessageQueueNew(
+    AUTOTUNE_REQUEST_QUEUE_MESSAGES_COUNT, sizeof(autotuneRequest_t),
+    &autotuneRequestQueueAttributes);
+
+  relayWindowMs = RELAY_WINDOW_MS_DEFAULT;
+  HEATER_RELAY_Start(relayWindowMs);
+}
+
+
+
+/* Settings sent during an autotune wait in the queue until it finishes. */
+static void ApplyPendingControlSettings(void)
+{
+  temperatureControlSettings_t settings;
+
+  if(isAutotuneRunning != 0) {
+    return;
+  }
+
+  if(osMessageQueueGet(controlSettingsQueueHandle, &settings, NULL, 0) ==
+    osOK) {
+    PID_CONTROLLER_SetSettings(&temperatureControl.pid, &settings.pid);
+    relayWindowMs = settings.relayWindowMs;
+    HEATER_RELAY_SetWindow(relayWindowMs);
+  }
+}
+
+
+
+/*
+  The relay window shrinks to one reading period for the experiment, so the
+  heater follows the relay decision of every reading without extra delay.
+*/
+static void StartPendingAutotune(void)
+{
+  autotuneRequest_t request;
+
+  if(isAutotuneRunning != 0 ||
+    osMessageQueueGet(autotuneRequestQueueHandle, &request, NULL, 0) != osOK) {
+    return;
+  }
+
+  const relayAutotunerSettings_t settings = {
+    .setPoint = temperatureControl.setPoint,
+    .hysteresis = (int32_t)(TEMPERATURE_FROM_DEGREES(request.hysteresisTenths) /
+      TEMPERATURE_DECIMAL_SCALE),
+    .relayAmplitude = RELAY_WINDOW_DUTY_MAX / 2,
+    .cyclesCount = request.cyclesCount,
+    .timeoutMs = AUTOTUNE_TIMEOUT_MS,
+    .derivativeFilterShift = temperatureControl.pid.settings.derivativeFilterShift
+  };
+  RELAY_AUTOTUNER_Init(&relayAutotuner, &settings, osKernelGetTickCount());
+
+  HEATER_RELAY_SetWindow(ADC1_READING_PERIOD_MS);
+  isAutotuneRunning = 1;
+}
+
+
+
+static int32_t RunAutotuneStep(int32_t temperature)
+{
+  uint32_t isRelayOn =
+    RELAY_AUTOTUNER_GetRelayCommand(&relayAutotuner, temperature);
+  relayAutotunerStatus_t status = RELAY_AUTOTUNER_Observe(&relayAutotuner,
+    osKernelGetTickCount(), temperature, isRelayOn);
+
+  if(status != RelayAutotuner_Running) {
+    FinishAutotune(status);
+    return 0;
+  }
+
+  return isRelayOn != 0 ? RELAY_WINDOW_DUTY_MAX : 0;
+}
+
+
+
+static void FinishAutotune(relayAutotunerStatus_t status)
+{
+  isAutotuneRunning = 0;
+  HEATER_RELAY_SetWindow(relayWindowMs);
+
+  if(status == RelayAutotuner_Finished) {
+    relayAutotunerResults_t results;
+    RELAY_AUTOTUNER_GetResults(&relayAutotuner, &results);
+    PID_CONTROLLER_SetSettings(&temperatureControl.pid, &results.pid);
+  }
+  PID_CONTROLLER_Reset(&temperatureControl.pid);
+
+  SendAutotuneReport(status);
+}
+
 
-  const uint32_t interpolationStepsCount = 10;
-  uint32_t interpolationStep = (thermistorResistanceTable[tableIndex] -
-    thermistorResistanceTable[tableIndex + 1]) / interpolationStepsCount;
 
-  uint32_t step;
-  for(step = 1; step <= interpolationStepsCount; ++step) {
-    referenceResistance -= interpolationStep;
-    if(referenceResistance <= thermistorResistance) {
-      break;
+/*
+  Without a valid reading the loop is open: the heater goes off for the rest
+  of the window, a running autotune is abandoned and the controller starts
+  over from the next valid reading.
+*/
+static void StopHeating(void)
+{
+  HEATER_RELAY_SetDuty(0);
+  HEATER_RELAY_TurnOff();
+  PID_CONTROLLER_Reset(&temperatureControl.pid);
+
+  if(isAutotuneRunning != 0) {
+    FinishAutotune(RelayAutotuner_Failed);
+  }
+}
+
+
+
+/*
+  Binary frame instead of the "ON|OFF adc temperature time" line, built
+  without any formatting. Tools/telemetry_decoder turns it back into that
+  line on the host.
+*/
+static void SendTelemetrySample(heaterState_t heaterState,
+  uint32_t adcMeasurement, int32_t temperature)
+{
+  const telemetryMessage_t message = {
+    .type = TelemetryFrame_Reading,
+    .sample = {
+      .sequence = telemetrySequence++,
+      .flags = heaterState == Heater_On ? TELEMETRY_FRAME_FLAG_HEATER_ON : 0,
+      .adcCode = (uint16_t)adcMeasurement,
+      .temperature = (int16_t)temperature,
+      .timeInSeconds = (uint32_t)RTC_GetTimeInSeconds()
     }
-  } 
-  
-  return referenceTemperature + 0.1*step;
+  };
+  SendTelemetryMessage(&message);
 }
 
 
 
-static uint32_t FindTableIndex(uint32_t thermistorResistance)
+static void SendFaultReport(void)
 {
-  uint32_t tableIndex;
-  for(tableIndex = 0; tableIndex < THERMISTOR_RESISTANCE_COUNT; ++tableIndex) {
-    if(thermistorResistance >= thermistorResistanceTable[tableIndex + 1]) {
-      break;
+  const telemetryMessage_t message = {
+    .type = TelemetryFrame_Fault,
+    .fault = {
+      .fault = TelemetryFault_AdcWatchdog,
+      .timeInSeconds = (uint32_t)RTC_GetTimeInSeconds()
     }
+  };
+  SendTelemetryMessage(&message);
+}
+
+
+
+/*
+  Ultimate gain and period, and the derived gains in the fixed-point format
+  of pidSettings_t, or only the failure.
+*/
+static void SendAutotuneReport(relayAutotunerStatus_t status)
+{
+  telemetryMessage_t message = {
+    .type = TelemetryFrame_Autotune,
+    .autotune = { .isFinished = 0 }
+  };
+
+  if(status == RelayAutotuner_Finished) {
+    relayAutotunerResults_t results;
+    RELAY_AUTOTUNER_GetResults(&relayAutotuner, &results);
+
+    message.autotune.isFinished = 1;
+    message.autotune.ultimateGain = results.ultimateGain;
+    message.autotune.ultimatePeriodMs = results.ultimatePeriodMs;
+    message.autotune.proportionalGain = results.pid.proportionalGain;
+    message.autotune.integralGain = results.pid.integralGain;
+    message.autotune.derivativeGain = results.pid.derivativeGain;
   }
 
-  return tableIndex;
+  SendTelemetryMessage(&message);
 }
 
 
 
-static heaterState_t CheckHeaterState(void)
+/* Only the regulator task, and main before the scheduler, send frames. */
+static void SendTelemetryMessage(const telemetryMessage_t *message)
 {
-  if(LL_GPIO_IsInputPinSet(RELAY_HEATER_GPIO_PORT, RELAY_HEATER_GPIO_PIN) == 0) {
-    return Heater_On;
-  } else {
-    return Heater_Off;
+  uint32_t frameSize = TELEMETRY_FRAME_Encode(message, telemetryFrame);
+  DMA2_USART1_TX_SendFeedbackMessage(telemetryFrame, frameSize);
+}
+
+
+
+static int32_t HandleAutotuneCommand(const uint8_t *payload)
+{
+  if(ADC1_TEMPERATURE_REGULATOR_StartAutotune(
+    payload[AUTOTUNE_HYSTERESIS_BYTE], payload[AUTOTUNE_CYCLES_BYTE]) != 0) {
+    return COMMAND_DISPATCHER_REPLACED;
   }
+
+  return COMMAND_DISPATCHER_EXECUTED;
 }
 
 
 
-static void UpdateFeedbackMessage(heaterState_t heaterState,
-  uint32_t adcMeasurement, float temperature)
+/*
+  Settings out of range are rejected whole, the echo of the command tells
+  the sender, and the running ones stay.
+*/
+static int32_t HandleControlSettingsCommand(const uint8_t *payload)
 {
-  memset(feedbackMessage.dataString, 0, sizeof(feedbackMessage.dataString));
-  size_t dataStringOffset = 0;
+  temperatureControlSettings_t settings = {
+    .pid = {
+      .proportionalGain = (int32_t)GetPayloadUint32(
+        &payload[CONTROL_SETTINGS_PROPORTIONAL_BYTE]),
+      .integralGain = (int32_t)GetPayloadUint32(
+        &payload[CONTROL_SETTINGS_INTEGRAL_BYTE]),
+      .derivativeGain = (int32_t)GetPayloadUint32(
+        &payload[CONTROL_SETTINGS_DERIVATIVE_BYTE]),
+      .derivativeFilterShift = payload[CONTROL_SETTINGS_FILTER_SHIFT_BYTE]
+    },
+    .relayWindowMs = (uint32_t)payload[CONTROL_SETTINGS_WINDOW_BYTE] |
+      ((uint32_t)payload[CONTROL_SETTINGS_WINDOW_BYTE + 1] << 8)
+  };
 
-  if(heaterState == Heater_On) {
-    sprintf(feedbackMessage.dataString, "ON");
-    dataStringOffset += strlen("ON");
-  } else {
-    sprintf(feedbackMessage.dataString, "OFF");
-    dataStringOffset += strlen("OFF");
+  if(AreControlSettingsValid(&settings) == 0) {
+    return COMMAND_DISPATCHER_REJECTED;
   }
-  feedbackMessage.dataString[dataStringOffset] = ' ';
-  ++dataStringOffset;
-
-  sprintf(feedbackMessage.dataString + dataStringOffset, "%"PRIu32,
-    adcMeasurement);
-  dataStringOffset += strlen(feedbackMessage.dataString);
-  feedbackMessage.dataString[dataStringOffset] = ' ';
-  ++dataStringOffset;
-
-  int temperatureIntegerPart = temperature;
-  float temperatureFraction = temperature - temperatureIntegerPart;
-  int temperatureFractionalPart = temperatureFraction * 10;
-  sprintf(feedbackMessage.dataString + dataStringOffset, "%d.%d",
-    temperatureIntegerPart, temperatureFractionalPart);
-  dataStringOffset += strlen(feedbackMessage.dataString);
-  feedbackMessage.dataString[dataStringOffset] = ' ';
-  ++dataStringOffset;
-
-  time_t timeInSeconds = RTC_GetTimeInSeconds();
-  sprintf(feedbackMessage.dataString + dataStringOffset, "%ld",
-    timeInSeconds);
-
-  feedbackMessage.dataString[sizeof(feedbackMessage.dataString) - 1] = '\n';
+  if(ADC1_TEMPERATURE_REGULATOR_SetControlSettings(&settings) != 0) {
+    return COMMAND_DISPATCHER_REPLACED;
+  }
+
+  return COMMAND_DISPATCHER_EXECUTED;
+}
+
+
+
+static int32_t AreControlSettingsValid(
+  const temperatureControlSettings_t *settings)
+{
+  const pidSettings_t *pid = &settings->pid;
+
+  return pid->proportionalGain >= 0 &&
+    pid->proportionalGain <= CONTROL_SETTINGS_GAIN_MAX &&
+    pid->integralGain >= 0 &&
+    pid->integralGain <= CONTROL_SETTINGS_GAIN_MAX &&
+    pid->derivativeGain >= 0 &&
+    pid->derivativeGain <= CONTROL_SETTINGS_GAIN_MAX &&
+    pid->derivativeFilterShift <= CONTROL_SETTINGS_FILTER_SHIFT_MAX &&
+    settings->relayWindowMs >= CONTROL_SETTINGS_WINDOW_MS_MIN &&
+    settings->relayWindowMs <= CONTROL_SETTINGS_WINDOW_MS_MAX;
+}
+
+
+
+static uint32_t GetPayloadUint32(const uint8_t *source)
+{
+  return (uint32_t)source[0] | ((uint32_t)source[1] << 8) |
+    ((uint32_t)source[2] << 16) | ((uint32_t)source[3] << 24);
 }
@@ -0,0 +1,151 @@
+#include "command_dispatcher.h"
+#include "dwt.h"
+
+#include "stm32f4xx.h"
+
+#include <stddef.h>
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE STRUCTURES                              */
+/*****************************************************************************/
+
+/*
+  A route calls Handle in the RX task, with the payload in place in the
+  decoded frame. Handle returns one of the COMMAND_DISPATCHER results.
+*/
+typedef struct commandRoute {
+  uint8_t commandId;
+  uint8_t payloadLength;
+  const char *name;
+  int32_t (*Handle)(const uint8_t *payload);
+  commandDispatchStatistics_t statistics;
+}commandRoute_t;
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+/* Filled before the scheduler starts, read only afterwards. */
+static commandRoute_t routes[COMMAND_DISPATCHER_ROUTES_MAX];
+static uint32_t routesCount;
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static commandRoute_t *FindRoute(uint8_t commandId);
+static void RecordLatency(commandRoute_t *route, uint32_t startCycles);
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+/*
+  Registration returns -1 for a full route table or a command ID already
+  routed. Register before osKernelStart.
+*/
+int32_t COMMAND_DISPATCHER_RegisterHandler(uint8_t commandId,
+  uint8_t payloadLength, const char *name,
+  int32_t (*Handle)(const uint8_t *payload))
+{
+  if(routesCount == COMMAND_DISPATCHER_ROUTES_MAX ||
+    payloadLength > COMMAND_FRAME_PAYLOAD_SIZE_MAX ||
+    FindRoute(commandId) != NULL) {
+    return -1;
+  }
+
+  commandRoute_t *route = &routes[routesCount++];
+  route->commandId = commandId;
+  route->payloadLength = payloadLength;
+  route->name = name;
+  route->Handle = Handle;
+
+  return 0;
+}
+
+
+
+/*
+  Called by the RX task for every valid frame, receivedCycles is the DWT
+  cycle count when the frame was decoded. Returns the route name for the
+  echo, or NULL when no route matches the command ID and payload length.
+  isRejected tells whether the handler refused the payload.
+*/
+const char *COMMAND_DISPATCHER_Dispatch(const commandFrame_t *frame,
+  uint32_t receivedCycles, uint32_t *isRejected)
+{
+  commandRoute_t *route = FindRoute(frame->commandId);
+  if(route == NULL || route->payloadLength != frame->payloadLength) {
+    return NULL;
+  }
+
+  int32_t result = route->Handle(frame->payload);
+  RecordLatency(route, receivedCycles);
+
+  *isRejected = result == COMMAND_DISPATCHER_REJECTED;
+  ++route->statistics.dispatchedCount;
+  if(result == COMMAND_DISPATCHER_REJECTED) {
+    ++route->statistics.rejectedCount;
+  } else if(result == COMMAND_DISPATCHER_REPLACED) {
+    ++route->statistics.droppedCount;
+  }
+
+  return route->name;
+}
+
+
+
+/*
+  Routes are numbered from 0 in registration order. Returns the route name,
+  or NULL past the last route.
+*/
+const char *COMMAND_DISPATCHER_GetStatistics(uint32_t route,
+  commandDispatchStatistics_t *statistics)
+{
+  if(route >= routesCount) {
+    return NULL;
+  }
+
+  __disable_irq();
+  *statistics = routes[route].statistics;
+  __enable_irq();
+
+  return routes[route].name;
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+static commandRoute_t *FindRoute(uint8_t commandId)
+{
+  for(uint32_t route = 0; route < routesCount; ++route) {
+    if(routes[route].commandId == commandId) {
+      return &routes[route];
+    }
+  }
+
+  return NULL;
+}
+
+
+
+static void RecordLatency(commandRoute_t *route, uint32_t startCycles)
+{
+  uint32_t latencyCycles = DWT_GetCycleCount() - startCycles;
+
+  route->statistics.lastLatencyCycles = latencyCycles;
+  if(latencyCycles > route->statistics.maxLatencyCycles) {
+    route->statistics.maxLatencyCycles = latencyCycles;
+  }
+}
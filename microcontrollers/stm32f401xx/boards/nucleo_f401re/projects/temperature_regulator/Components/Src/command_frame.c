@@ -0,0 +1,188 @@
+#include "command_frame.h"
+#include "crc32.h"
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define COMMAND_ID_OFFSET     0
+#define PAYLOAD_LENGTH_OFFSET 1
+#define PAYLOAD_OFFSET        2
+
+#define COBS_BLOCK_CODE_MAX 0xFFU
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static commandFrameStatus_t CheckFrame(commandFrameDecoder_t *decoder,
+  commandFrame_t *frame);
+static void AppendDecodedByte(commandFrameDecoder_t *decoder, uint8_t byte);
+static void PutUint32(uint8_t *destination, uint32_t value);
+static uint32_t GetUint32(const uint8_t *source);
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+/*
+  Returns the number of bytes written, delimiter included, or 0 for a
+  payload longer than COMMAND_FRAME_PAYLOAD_SIZE_MAX.
+*/
+uint32_t COMMAND_FRAME_Encode(const commandFrame_t *frame,
+  uint8_t encoded[COMMAND_FRAME_ENCODED_SIZE_MAX])
+{
+  uint8_t decoded[COMMAND_FRAME_DECODED_SIZE_MAX];
+  uint32_t decodedLength = PAYLOAD_OFFSET + frame->payloadLength;
+
+  if(frame->payloadLength > COMMAND_FRAME_PAYLOAD_SIZE_MAX) {
+    return 0;
+  }
+
+  decoded[COMMAND_ID_OFFSET] = frame->commandId;
+  decoded[PAYLOAD_LENGTH_OFFSET] = frame->payloadLength;
+  for(uint32_t byte = 0; byte < frame->payloadLength; ++byte) {
+    decoded[PAYLOAD_OFFSET + byte] = frame->payload[byte];
+  }
+  PutUint32(&decoded[decodedLength], CRC32_Calculate(decoded, decodedLength));
+  decodedLength += COMMAND_FRAME_CRC_SIZE;
+
+  /*
+    Every zero byte is replaced by the distance to the next one, the code
+    byte in front of the block holds the distance to the first.
+  */
+  uint32_t codePosition = 0;
+  uint32_t encodedLength = 1;
+  uint8_t code = 1;
+  for(uint32_t byte = 0; byte < decodedLength; ++byte) {
+    if(decoded[byte] != 0) {
+      encoded[encodedLength++] = decoded[byte];
+      ++code;
+    }
+    if(decoded[byte] == 0 || code == COBS_BLOCK_CODE_MAX) {
+      encoded[codePosition] = code;
+      codePosition = encodedLength++;
+      code = 1;
+    }
+  }
+  encoded[codePosition] = code;
+  encoded[encodedLength++] = COMMAND_FRAME_DELIMITER;
+
+  return encodedLength;
+}
+
+
+
+void COMMAND_FRAME_InitDecoder(commandFrameDecoder_t *decoder)
+{
+  decoder->length = 0;
+  decoder->blockCode = COBS_BLOCK_CODE_MAX;
+  decoder->blockBytesLeft = 0;
+  decoder->isOverflowed = 0;
+}
+
+
+
+/*
+  Bytes are decoded as they arrive, the frame is checked at the delimiter.
+  Empty frames are ignored, so a sender can start with a delimiter to end
+  whatever noise came before. frame is written only for
+  CommandFrame_Received.
+*/
+commandFrameStatus_t COMMAND_FRAME_FeedByte(commandFrameDecoder_t *decoder,
+  uint8_t byte, commandFrame_t *frame)
+{
+  if(byte == COMMAND_FRAME_DELIMITER) {
+    commandFrameStatus_t status = CommandFrame_Incomplete;
+    if(decoder->isOverflowed != 0 || decoder->blockBytesLeft != 0) {
+      status = CommandFrame_FormatError;
+    } else if(decoder->length != 0) {
+      status = CheckFrame(decoder, frame);
+    }
+    COMMAND_FRAME_InitDecoder(decoder);
+    return status;
+  }
+
+  if(decoder->blockBytesLeft != 0) {
+    AppendDecodedByte(decoder, byte);
+    --decoder->blockBytesLeft;
+    return CommandFrame_Incomplete;
+  }
+
+  /* A new block, the previous one ended with a zero unless it was full. */
+  if(decoder->blockCode != COBS_BLOCK_CODE_MAX) {
+    AppendDecodedByte(decoder, 0);
+  }
+  decoder->blockCode = byte;
+  decoder->blockBytesLeft = (uint8_t)(byte - 1);
+
+  return CommandFrame_Incomplete;
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+static commandFrameStatus_t CheckFrame(commandFrameDecoder_t *decoder,
+  commandFrame_t *frame)
+{
+  if(decoder->length < PAYLOAD_OFFSET + COMMAND_FRAME_CRC_SIZE) {
+    return CommandFrame_FormatError;
+  }
+
+  uint32_t crcOffset = decoder->length - COMMAND_FRAME_CRC_SIZE;
+  uint8_t payloadLength = decoder->data[PAYLOAD_LENGTH_OFFSET];
+  if(crcOffset != PAYLOAD_OFFSET + (uint32_t)payloadLength) {
+    return CommandFrame_FormatError;
+  }
+  if(GetUint32(&decoder->data[crcOffset]) !=
+    CRC32_Calculate(decoder->data, crcOffset)) {
+    return CommandFrame_CrcError;
+  }
+
+  frame->commandId = decoder->data[COMMAND_ID_OFFSET];
+  frame->payloadLength = payloadLength;
+  for(uint32_t byte = 0; byte < payloadLength; ++byte) {
+    frame->payload[byte] = decoder->data[PAYLOAD_OFFSET + byte];
+  }
+
+  return CommandFrame_Received;
+}
+
+
+
+static void AppendDecodedByte(commandFrameDecoder_t *decoder, uint8_t byte)
+{
+  if(decoder->length == COMMAND_FRAME_DECODED_SIZE_MAX) {
+    decoder->isOverflowed = 1;
+    return;
+  }
+
+  decoder->data[decoder->length++] = byte;
+}
+
+
+
+static void PutUint32(uint8_t *destination, uint32_t value)
+{
+  destination[0] = (uint8_t)value;
+  destination[1] = (uint8_t)(value >> 8);
+  destination[2] = (uint8_t)(value >> 16);
+  destination[3] = (uint8_t)(value >> 24);
+}
+
+
+
+static uint32_t GetUint32(const uint8_t *source)
+{
+  return (uint32_t)source[0] | ((uint32_t)source[1] << 8) |
+    ((uint32_t)source[2] << 16) | ((uint32_t)source[3] << 24);
+}
@@ -0,0 +1,104 @@
+#include "adc_oversampling.h"
+#include "conversion_benchmark.h"
+#include "dwt.h"
+#include "temperature_conversion.h"
+#include "thermistor_lookup_table.h"
+
+#include "stm32f4xx.h"
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define BENCHMARK_FIRST_READING \
+  (ADC_MEASUREMENT_MIN << ADC_OVERSAMPLING_EXTRA_BITS)
+#define BENCHMARK_LAST_READING \
+  (ADC_MEASUREMENT_MAX << ADC_OVERSAMPLING_EXTRA_BITS)
+
+/* Odd step, so the fractional bits of consecutive readings keep changing. */
+#define BENCHMARK_READING_STEP 7
+
+#define FPU_LAZY_STACKING_BITS (FPU_FPCCR_ASPEN_Msk | FPU_FPCCR_LSPEN_Msk)
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+static volatile int32_t fixedPointTemperatureSink;
+static volatile float floatTemperatureSink;
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static float ConvertReadingToTemperatureFloat(uint32_t filteredReading);
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+/*
+  Must be called before the scheduler starts, so that nothing else runs
+  during the measurement and the FPU use stays out of every task: starting
+  the scheduler clears the FPU context of main.
+*/
+void CONVERSION_BENCHMARK_Run(conversionBenchmarkResults_t *results)
+{
+  uint32_t samplesCount = 0;
+
+  uint32_t startCycleCount = DWT_GetCycleCount();
+  for(uint32_t reading = BENCHMARK_FIRST_READING;
+    reading < BENCHMARK_LAST_READING; reading += BENCHMARK_READING_STEP) {
+    fixedPointTemperatureSink =
+      TEMPERATURE_CONVERSION_ReadingToTemperature(reading);
+    ++samplesCount;
+  }
+  uint32_t fixedPointCycles = DWT_GetCycleCount() - startCycleCount;
+
+  startCycleCount = DWT_GetCycleCount();
+  for(uint32_t reading = BENCHMARK_FIRST_READING;
+    reading < BENCHMARK_LAST_READING; reading += BENCHMARK_READING_STEP) {
+    floatTemperatureSink = ConvertReadingToTemperatureFloat(reading);
+  }
+  uint32_t floatCycles = DWT_GetCycleCount() - startCycleCount;
+
+  results->samplesCount = samplesCount;
+  results->fixedPointCyclesPerSample = fixedPointCycles / samplesCount;
+  results->floatCyclesPerSample = floatCycles / samplesCount;
+  results->isHardwareFpuUsed = __FPU_USED;
+#if (__FPU_USED == 1)
+  results->isLazyStackingEnabled =
+    (FPU->FPCCR & FPU_LAZY_STACKING_BITS) == FPU_LAZY_STACKING_BITS;
+#else
+  results->isLazyStackingEnabled = 0;
+#endif
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+static float ConvertReadingToTemperatureFloat(uint32_t filteredReading)
+{
+  const float temperatureLsb = 1.0f / TEMPERATURE_FROM_DEGREES(1);
+
+  float adcCode = (float)filteredReading / (1U << ADC_OVERSAMPLING_EXTRA_BITS);
+  uint32_t lowerAdcCode = (uint32_t)adcCode;
+  float fraction = adcCode - (float)lowerAdcCode;
+
+  float lowerTemperature = thermistorLookupTable[lowerAdcCode] * temperatureLsb;
+  float upperTemperature =
+    thermistorLookupTable[lowerAdcCode + 1] * temperatureLsb;
+
+  return lowerTemperature + (upperTemperature - lowerTemperature) * fraction;
+}
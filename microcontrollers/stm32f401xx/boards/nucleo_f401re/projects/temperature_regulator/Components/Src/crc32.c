@@ -0,0 +1,139 @@
+#include "crc32.h"
+
+/* Firmware builds use the CRC unit, host builds the bit-exact table. */
+#ifdef USE_FULL_LL_DRIVER
+#define CRC32_HARDWARE
+#include "stm32f4xx_ll_bus.h"
+#include "stm32f4xx_ll_crc.h"
+#endif
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define WORD_SIZE 4U
+
+#define CRC_POLYNOMIAL    0x04C11DB7UL
+#define CRC_INITIAL_VALUE 0xFFFFFFFFUL
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+#ifndef CRC32_HARDWARE
+static uint32_t crcTable[256];
+static int isCrcTableBuilt;
+#endif
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static uint32_t GetWord(const uint8_t *data, uint32_t length,
+  uint32_t offset);
+#ifndef CRC32_HARDWARE
+static uint32_t FeedWord(uint32_t crc, uint32_t word);
+static void BuildCrcTable(void);
+#endif
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+void CRC32_Clock_Config(void)
+{
+#ifdef CRC32_HARDWARE
+  LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_CRC);
+#endif
+}
+
+
+
+/*
+  CRC of the STM32F4 CRC unit: polynomial 0x04C11DB7, initial value
+  0xFFFFFFFF, no reflection, no final XOR, fed with 32-bit words. The data
+  is read as little-endian words, as the core loads it, and the last word
+  is padded with zero bytes. The unit is not shared, only the USART1 RX
+  task calls this.
+*/
+uint32_t CRC32_Calculate(const uint8_t *data, uint32_t length)
+{
+#ifdef CRC32_HARDWARE
+  LL_CRC_ResetCRCCalculationUnit(CRC);
+  for(uint32_t offset = 0; offset < length; offset += WORD_SIZE) {
+    LL_CRC_FeedData32(CRC, GetWord(data, length, offset));
+  }
+
+  return LL_CRC_ReadData32(CRC);
+#else
+  uint32_t crc = CRC_INITIAL_VALUE;
+
+  if(isCrcTableBuilt == 0) {
+    BuildCrcTable();
+  }
+  for(uint32_t offset = 0; offset < length; offset += WORD_SIZE) {
+    crc = FeedWord(crc, GetWord(data, length, offset));
+  }
+
+  return crc;
+#endif
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+static uint32_t GetWord(const uint8_t *data, uint32_t length,
+  uint32_t offset)
+{
+  uint32_t word = 0;
+
+  for(uint32_t byte = 0; byte < WORD_SIZE && offset + byte < length; ++byte) {
+    word |= (uint32_t)data[offset + byte] << (8 * byte);
+  }
+
+  return word;
+}
+
+
+
+#ifndef CRC32_HARDWARE
+/* The unit shifts the word in from bit 31, so the top byte goes first. */
+static uint32_t FeedWord(uint32_t crc, uint32_t word)
+{
+  crc ^= word;
+  for(uint32_t byte = 0; byte < WORD_SIZE; ++byte) {
+    crc = (crc << 8) ^ crcTable[crc >> 24];
+  }
+
+  return crc;
+}
+
+
+
+static void BuildCrcTable(void)
+{
+  for(uint32_t index = 0; index < 256; ++index) {
+    uint32_t crc = index << 24;
+    for(uint32_t bit = 0; bit < 8; ++bit) {
+      if((crc & 0x80000000UL) != 0) {
+        crc = (crc << 1) ^ CRC_POLYNOMIAL;
+      } else {
+        crc <<= 1;
+      }
+    }
+    crcTable[index] = crc;
+  }
+  isCrcTableBuilt = 1;
+}
+#endif
@@ -1,12 +1,19 @@
-#include "adc_temperature_regulator.h"
+#include "command_dispatcher.h"
+#include "command_frame.h"
 #include "dma.h"
+#include "dwt.h"
+#include "ring_buffer.h"
 #include "rtc.h"
+#include "telemetry_frame.h"
 #include "usart.h"
 
 #include "cmsis_os2.h"
 
+#include "stm32f4xx.h"
+
 #include "stm32f4xx_ll_bus.h"
 #include "stm32f4xx_ll_dma.h"
+#include "stm32f4xx_ll_usart.h"
 
 #include <string.h>
 
@@ -16,59 +23,78 @@
 /*                            PRIVATE DEFINES                                */
 /*****************************************************************************/
 
-#define DMA2_BUFFER_SIZE 32
-
-#define MAGIC_WORD_LENGTH  4
+/*
+  USART1 RX is received into two banks of DMA2 Stream2 double buffer mode,
+  the RX task reads one while the stream fills the other. The bank has to
+  hold the bytes received while the task is held off, at 115200 baud about
+  11.5 per ms. Override with -DDMA2_USART1_RX_BANK_SIZE=<bytes>.
+*/
+#ifndef DMA2_USART1_RX_BANK_SIZE
+#define DMA2_USART1_RX_BANK_SIZE 128
+#endif
+#define DMA2_USART1_RX_BANKS_COUNT 2
 
-#define CONFIG_BYTES_COUNT 2
-#define LONG_BLINK_BYTE    0
-#define SHORT_BLINK_BYTE   1
+#if DMA2_USART1_RX_BANK_SIZE < 2 || DMA2_USART1_RX_BANK_SIZE > 65535
+#error "DMA2_USART1_RX_BANK_SIZE must fit the 16-bit DMA data counter"
+#endif
 
-#define LED2TASK_QUEUE_MESSAGES_COUNT (uint32_t)1
+/*
+  Bytes waiting for DMA2 Stream7, copied in by the senders. Holds about a
+  dozen full telemetry frames, a power of two for the ring buffer.
+*/
+#define TX_RING_BUFFER_SIZE 512U
 
+#if (TX_RING_BUFFER_SIZE & (TX_RING_BUFFER_SIZE - 1U)) != 0
+#error "TX_RING_BUFFER_SIZE must be a power of two"
+#endif
 
+/* Below configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY, the handler uses RTOS. */
+#define DMA2_USART1_TX_IRQ_PRIORITY 7
+#define DMA2_USART1_RX_IRQ_PRIORITY 6
 
-/*****************************************************************************/
-/*                             PRIVATE MACROS                                */
-/*****************************************************************************/
+#define DMA2_USART1_RX_DATA_FLAG 0x01U
 
-#define ARRAY_LENGTH(x)    (sizeof(x) / sizeof((x)[0]))
+/*
+  The first overrun is reported at once, the ones following within this
+  period only in the next report, so a flood does not load TX as well.
+*/
+#define RX_OVERRUN_REPORT_PERIOD_MS 1000U
 
 
 
 /*****************************************************************************/
-/*                             PRIVATE ENUMS                                 */
+/*                           PRIVATE VARIABLES                               */
 /*****************************************************************************/
 
-typedef enum isMagicFound_t
-{
-  Magic_Found = 0,
-  Magic_NotFound = -1,
-}MagicStatus_t;
+static uint8_t dma2Usart1RxBanks[DMA2_USART1_RX_BANKS_COUNT]
+                                [DMA2_USART1_RX_BANK_SIZE];
 
+/* Banks filled since the start, bank n is dma2Usart1RxBanks[n % 2]. */
+static volatile uint32_t rxCompletedBanksCount;
 
+static osThreadId_t dma2Usart1RxTaskHandle;
 
-/*****************************************************************************/
-/*                           PRIVATE VARIABLES                               */
-/*****************************************************************************/
+/*
+  The senders are the only producer, serialized by the scheduler lock, the
+  Stream7 interrupt is the only consumer. The stream sends straight out of
+  the read span, which is released once the transfer is complete.
+*/
+static ring_buffer_t txRingBuffer;
+static uint8_t txRingBufferStorage[TX_RING_BUFFER_SIZE];
 
-static uint8_t dma2Usart1RxBuffer[DMA2_BUFFER_SIZE];
+/* Written by the Stream7 interrupt only, while the stream is disabled. */
+static uint32_t activeTxLength;
 
-static const char MAGIC_WORD[MAGIC_WORD_LENGTH + 1] = "ABCD";
+static commandFrameDecoder_t rxCommandDecoder;
 
-static osMessageQueueId_t queueHandleForLed2Task;
+static dma2Usart1TxStatistics_t txStatistics;
+static dma2Usart1RxStatistics_t rxStatistics;
 
+/* Echo and overrun report of the RX task. */
+static uint8_t echoFrame[TELEMETRY_FRAME_SIZE_MAX];
 
-
-/*****************************************************************************/
-/*                           PRIVATE STRUCTURES                              */
-/*****************************************************************************/
-
-static struct __attribute__((packed))
-{
-  char magicWord[MAGIC_WORD_LENGTH + 1];
-  time_t rtcTime;
-}feedbackMessage;
+static uint32_t isRxOverrunReported;
+static uint32_t rxOverrunReportTick;
 
 
 
@@ -76,16 +102,14 @@ static struct __attribute__((packed))
 /*                      PRIVATE FUNCTIONS PROTOTYPES                         */
 /*****************************************************************************/
 
-static size_t GetCurrentPositionInDma2Usart1RxBuffer(void);
-static size_t CountBytesLeftToCheck(size_t currentPosition,
-                                    size_t oldPosition);
-static MagicStatus_t FindMagic(size_t dma2BufferOffset, size_t magicWordOffset,
-                         size_t magicWordLength); 
-static size_t UpdateLed2BufferAndPosition(uint8_t *led2UpdatedBlinksCount,
-                                          size_t positionIndex,
-                                          size_t magicWordLength);
-static void InitializeFeedbackMessage(void);
-static void FeedbackMessageUpdateTime(void);
+static void GetDma2Usart1RxWritePosition(uint32_t *bank, uint32_t *offset);
+static void RecordRxOverrun(uint32_t lostBytesCount);
+static void RecordRxPendingBytes(uint32_t pendingBytesCount);
+static void ProcessRxFrameStatus(commandFrameStatus_t status,
+                                 const commandFrame_t *frame);
+static void DispatchRxCommand(const commandFrame_t *frame);
+static void SendCommandEcho(const char *name, uint32_t isRejected);
+static void SendRxOverrunReport(void);
 
 
 
@@ -107,6 +131,9 @@ void DMA2_USART1_RX_Config(void)
                                   LL_DMA_DIRECTION_PERIPH_TO_MEMORY);
   LL_DMA_SetStreamPriorityLevel(DMA2, LL_DMA_STREAM_2, LL_DMA_PRIORITY_LOW);
   LL_DMA_SetMode(DMA2, LL_DMA_STREAM_2, LL_DMA_MODE_CIRCULAR);
+  LL_DMA_EnableDoubleBufferMode(DMA2, LL_DMA_STREAM_2);
+  LL_DMA_SetCurrentTargetMem(DMA2, LL_DMA_STREAM_2,
+                             LL_DMA_CURRENTTARGETMEM0);
   LL_DMA_SetPeriphIncMode(DMA2, LL_DMA_STREAM_2, LL_DMA_PERIPH_NOINCREMENT);
   LL_DMA_SetMemoryIncMode(DMA2, LL_DMA_STREAM_2, LL_DMA_MEMORY_INCREMENT);
   LL_DMA_SetPeriphSize(DMA2, LL_DMA_STREAM_2, LL_DMA_PDATAALIGN_BYTE);
@@ -114,8 +141,22 @@ void DMA2_USART1_RX_Config(void)
   LL_DMA_DisableFifoMode(DMA2, LL_DMA_STREAM_2);
 
   LL_DMA_SetPeriphAddress(DMA2, LL_DMA_STREAM_2, (uint32_t)&USART1->DR);
-  LL_DMA_SetMemoryAddress(DMA2, LL_DMA_STREAM_2, (uint32_t)dma2Usart1RxBuffer);
-  LL_DMA_SetDataLength(DMA2, LL_DMA_STREAM_2, ARRAY_LENGTH(dma2Usart1RxBuffer));
+  LL_DMA_SetMemoryAddress(DMA2, LL_DMA_STREAM_2,
+                          (uint32_t)dma2Usart1RxBanks[0]);
+  LL_DMA_SetMemory1Address(DMA2, LL_DMA_STREAM_2,
+                           (uint32_t)dma2Usart1RxBanks[1]);
+  LL_DMA_SetDataLength(DMA2, LL_DMA_STREAM_2, DMA2_USART1_RX_BANK_SIZE);
+
+  /*
+    Half and full bank wake the RX task before the other bank is
+    overwritten, the USART1 idle line interrupt after shorter bursts.
+  */
+  LL_DMA_EnableIT_HT(DMA2, LL_DMA_STREAM_2);
+  LL_DMA_EnableIT_TC(DMA2, LL_DMA_STREAM_2);
+  NVIC_SetPriority(DMA2_Stream2_IRQn,
+    NVIC_EncodePriority(NVIC_GetPriorityGrouping(),
+                        DMA2_USART1_RX_IRQ_PRIORITY, 0));
+  NVIC_EnableIRQ(DMA2_Stream2_IRQn);
 
   LL_DMA_EnableStream(DMA2, LL_DMA_STREAM_2);
 }
@@ -136,115 +177,289 @@ void DMA2_USART1_TX_Config(void)
   LL_DMA_DisableFifoMode(DMA2, LL_DMA_STREAM_7);
 
   LL_DMA_SetPeriphAddress(DMA2, LL_DMA_STREAM_7, (uint32_t)&USART1->DR);
+  LL_DMA_EnableIT_TC(DMA2, LL_DMA_STREAM_7);
+
+  (void)ring_buffer_init(&txRingBuffer, txRingBufferStorage,
+                         sizeof(txRingBufferStorage));
+
+  NVIC_SetPriority(DMA2_Stream7_IRQn,
+    NVIC_EncodePriority(NVIC_GetPriorityGrouping(),
+                        DMA2_USART1_TX_IRQ_PRIORITY, 0));
+  NVIC_EnableIRQ(DMA2_Stream7_IRQn);
 }
 
 
 
-osMessageQueueId_t GetQueueHandleForLed2Task(void)
+/*
+  Copies the message into the TX ring buffer and returns at once, from any
+  task or before the scheduler starts. Messages are sent in order, in one
+  DMA2 Stream7 transfer per contiguous span chained from the transfer
+  complete interrupt. A message that does not fit whole is dropped and
+  counted, the ring never holds part of one.
+*/
+void DMA2_USART1_TX_SendFeedbackMessage(void *objectAddress, size_t objectSize)
 {
-  return queueHandleForLed2Task;
+  int32_t lock = osKernelLock();
+
+  if(objectSize > TX_RING_BUFFER_SIZE)
+  {
+    ++txStatistics.droppedFramesCount;
+    (void)osKernelRestoreLock(lock);
+    return;
+  }
+
+  if(ring_buffer_get_free_space(&txRingBuffer) < objectSize)
+  {
+    ++txStatistics.overflowFramesCount;
+    (void)osKernelRestoreLock(lock);
+    return;
+  }
+
+  (void)ring_buffer_write(&txRingBuffer, objectAddress, (uint32_t)objectSize);
+  ++txStatistics.queuedFramesCount;
+
+  uint32_t queuedBytesCount = ring_buffer_get_used_space(&txRingBuffer);
+  if(queuedBytesCount > txStatistics.maxQueuedBytesCount)
+  {
+    txStatistics.maxQueuedBytesCount = queuedBytesCount;
+  }
+
+  (void)osKernelRestoreLock(lock);
+
+  /* Lets the interrupt start the transfer if the stream is idle. */
+  NVIC_SetPendingIRQ(DMA2_Stream7_IRQn);
 }
 
 
 
-void DMA2_USART1_TX_SendFeedbackMessage(void *objectAddress, size_t objectSize)
+/*
+  Room left in the TX ring buffer, for senders of long outputs that wait
+  for it instead of having their messages dropped.
+*/
+uint32_t DMA2_USART1_TX_GetFreeBytesCount(void)
 {
-  LL_DMA_SetMemoryAddress(DMA2, LL_DMA_STREAM_7, (uint32_t)objectAddress);
-  LL_DMA_SetDataLength(DMA2, LL_DMA_STREAM_7, objectSize);
+  return ring_buffer_get_free_space(&txRingBuffer);
+}
+
+
+
+/*
+  From a task, before the USART1 clock changes. Keeps the interrupt from
+  starting the next frame and waits until the frame being sent has left
+  the shift register. Messages sent meanwhile wait in the ring buffer.
+*/
+void DMA2_USART1_TX_Hold(void)
+{
+  NVIC_DisableIRQ(DMA2_Stream7_IRQn);
 
-  if(!LL_DMA_IsEnabledStream(DMA2, LL_DMA_STREAM_7))
+  while(LL_DMA_IsEnabledStream(DMA2, LL_DMA_STREAM_7) ||
+        LL_USART_IsActiveFlag_TC(USART1) == 0)
   {
-    LL_DMA_EnableStream(DMA2, LL_DMA_STREAM_7);
+    osDelay(1);
+  }
+}
 
-    while(LL_DMA_IsActiveFlag_TC7(DMA2) == 0)
-    {
-      ;
-    }
-    LL_DMA_ClearFlag_TC7(DMA2);
-    LL_DMA_ClearFlag_HT7(DMA2);
-    LL_DMA_ClearFlag_DME7(DMA2);
-    LL_DMA_ClearFlag_FE7(DMA2);
-    LL_DMA_ClearFlag_TE7(DMA2);
+
+
+/* Lets the interrupt start the messages queued during the hold. */
+void DMA2_USART1_TX_Release(void)
+{
+  NVIC_EnableIRQ(DMA2_Stream7_IRQn);
+  NVIC_SetPendingIRQ(DMA2_Stream7_IRQn);
+}
+
+
+
+/*
+  Called from DMA2_Stream7_IRQHandler, on transfer complete and when a
+  sender pends the interrupt. Once the stream is idle, releases the span
+  it has sent and starts on the next one, so only this interrupt ever
+  touches Stream7.
+*/
+void DMA2_USART1_TX_TransferComplete_Callback(void)
+{
+  const uint8_t *span;
+
+  if(LL_DMA_IsEnabledStream(DMA2, LL_DMA_STREAM_7))
+  {
+    return;
+  }
+
+  ring_buffer_release_read_span(&txRingBuffer, activeTxLength);
+  activeTxLength = ring_buffer_get_read_span(&txRingBuffer, &span);
+  if(activeTxLength == 0)
+  {
+    return;
+  }
+
+  LL_DMA_ClearFlag_TC7(DMA2);
+  LL_DMA_ClearFlag_HT7(DMA2);
+  LL_DMA_ClearFlag_DME7(DMA2);
+  LL_DMA_ClearFlag_FE7(DMA2);
+  LL_DMA_ClearFlag_TE7(DMA2);
+
+  /* Set again by USART1 once the last byte of the span is out. */
+  LL_USART_ClearFlag_TC(USART1);
+
+  LL_DMA_SetMemoryAddress(DMA2, LL_DMA_STREAM_7, (uint32_t)span);
+  LL_DMA_SetDataLength(DMA2, LL_DMA_STREAM_7, activeTxLength);
+  LL_DMA_EnableStream(DMA2, LL_DMA_STREAM_7);
+  ++txStatistics.transfersCount;
+}
+
+
+
+/*
+  Called from the DMA2 Stream2 half transfer interrupt and the USART1 idle
+  line interrupt: new bytes are waiting in the RX banks.
+*/
+void DMA2_USART1_RX_Callback(void)
+{
+  if(dma2Usart1RxTaskHandle != NULL)
+  {
+    osThreadFlagsSet(dma2Usart1RxTaskHandle, DMA2_USART1_RX_DATA_FLAG);
   }
 }
 
 
 
+/*
+  Called from the DMA2 Stream2 transfer complete interrupt: a bank is full
+  and the stream has switched to the other one.
+*/
+void DMA2_USART1_RX_TransferComplete_Callback(void)
+{
+  ++rxCompletedBanksCount;
+  DMA2_USART1_RX_Callback();
+}
+
+
+
+void DMA2_USART1_TX_GetStatistics(dma2Usart1TxStatistics_t *statistics)
+{
+  __disable_irq();
+  *statistics = txStatistics;
+  __enable_irq();
+}
+
+
+
+void DMA2_USART1_RX_GetStatistics(dma2Usart1RxStatistics_t *statistics)
+{
+  __disable_irq();
+  *statistics = rxStatistics;
+  __enable_irq();
+}
+
+
+
+/*
+  RX statistics telemetry frame into frame, TELEMETRY_FRAME_SIZE_MAX bytes.
+  Returns the size of the frame.
+*/
+uint32_t DMA2_USART1_RX_EncodeStatistics(uint8_t *frame)
+{
+  dma2Usart1RxStatistics_t statistics;
+  DMA2_USART1_RX_GetStatistics(&statistics);
+
+  const telemetryMessage_t message = {
+    .type = TelemetryFrame_RxStatistics,
+    .rxStatistics = {
+      .receivedFramesCount = statistics.receivedFramesCount,
+      .formatErrorsCount = statistics.formatErrorsCount,
+      .crcErrorsCount = statistics.crcErrorsCount,
+      .unknownCommandsCount = statistics.unknownCommandsCount,
+      .overrunsCount = statistics.overrunsCount,
+      .lostBytesCount = statistics.lostBytesCount,
+      .maxPendingBytesCount = statistics.maxPendingBytesCount
+    }
+  };
+
+  return TELEMETRY_FRAME_Encode(&message, frame);
+}
+
+
+
 /*****************************************************************************/
 /*                         RTOS TASK DEFINITION                              */
 /*****************************************************************************/
 
+/*
+  Every received byte is fed once to the command frame decoder, which keeps
+  its state between wake-ups, so a frame split over two DMA interrupts or
+  over two banks is still decoded. The task reads bank readBank up to the
+  write position of the stream. Once the stream has come back to the bank
+  being read, the unread bytes there are lost: they are counted, the
+  decoder restarts, the RX statistics are sent and reading goes on with
+  the oldest intact bank.
+*/
 void StartDma2Usart1RxTask(void *argument)
 {
-  size_t oldPosition = 0;
-  size_t currentPosition = 0;
-  MagicStatus_t isMagicFound = Magic_NotFound;
-  uint8_t led2UpdatedBlinksCount[CONFIG_BYTES_COUNT] = {0};
-
-  queueHandleForLed2Task = osMessageQueueNew(LED2TASK_QUEUE_MESSAGES_COUNT, 
-                                      sizeof(led2UpdatedBlinksCount), NULL);
-  InitializeFeedbackMessage();
+  uint32_t readBank = 0;
+  uint32_t readOffset = 0;
+  uint32_t writtenBank = 0;
+  uint32_t writtenOffset = 0;
+  uint32_t endOffset = 0;
+  int32_t banksBehind = 0;
+  const uint8_t *bank = NULL;
+  commandFrame_t frame;
+  commandFrameStatus_t status = CommandFrame_Incomplete;
+
+  COMMAND_FRAME_InitDecoder(&rxCommandDecoder);
+  dma2Usart1RxTaskHandle = osThreadGetId();
 
   for(;;)
   {
-    currentPosition = GetCurrentPositionInDma2Usart1RxBuffer();
-    if(currentPosition != oldPosition)
+    GetDma2Usart1RxWritePosition(&writtenBank, &writtenOffset);
+    banksBehind = (int32_t)(writtenBank - readBank);
+
+    if(banksBehind > DMA2_USART1_RX_BANKS_COUNT
+       || (banksBehind == DMA2_USART1_RX_BANKS_COUNT
+           && writtenOffset > readOffset))
     {
-      while(isMagicFound == Magic_NotFound 
-            && CountBytesLeftToCheck(currentPosition, oldPosition) 
-            >= (MAGIC_WORD_LENGTH + CONFIG_BYTES_COUNT))
-      {
-        if((ARRAY_LENGTH(dma2Usart1RxBuffer)-oldPosition) >= MAGIC_WORD_LENGTH)
-        {
-          isMagicFound = FindMagic(oldPosition, 0, MAGIC_WORD_LENGTH);
-          if(isMagicFound == Magic_Found)
-          {
-            oldPosition = UpdateLed2BufferAndPosition(led2UpdatedBlinksCount,
-                                                      oldPosition,
-                                                      MAGIC_WORD_LENGTH);
-            break;
-          }
-        }
-        else if((ARRAY_LENGTH(dma2Usart1RxBuffer) - oldPosition) != 0)
-        {
-          size_t offset = ARRAY_LENGTH(dma2Usart1RxBuffer) - oldPosition;
-          MagicStatus_t isPartOfMagicFound = Magic_NotFound;
-          isPartOfMagicFound = FindMagic(oldPosition, 0, offset);
-          if(isPartOfMagicFound == Magic_Found)
-          {
-            size_t leftBytes = MAGIC_WORD_LENGTH - offset;
-            isMagicFound = FindMagic(0, offset, leftBytes);
-            if(isMagicFound == Magic_Found)
-            {
-              oldPosition = leftBytes;
-              oldPosition = UpdateLed2BufferAndPosition(led2UpdatedBlinksCount,
-                                                        oldPosition, 0);
-              break;
-            }
-          }
-        }
-        
-        oldPosition++;
-        if(oldPosition == ARRAY_LENGTH(dma2Usart1RxBuffer))
-          oldPosition = 0;
-      }
+      RecordRxOverrun((uint32_t)(banksBehind - 1) * DMA2_USART1_RX_BANK_SIZE
+                      - readOffset);
+      COMMAND_FRAME_InitDecoder(&rxCommandDecoder);
+      readBank = writtenBank - 1;
+      readOffset = 0;
+      banksBehind = 1;
+      SendRxOverrunReport();
     }
 
-    if(oldPosition == ARRAY_LENGTH(dma2Usart1RxBuffer))
-          oldPosition = 0;
+    if(banksBehind > 0)
+    {
+      RecordRxPendingBytes((uint32_t)banksBehind * DMA2_USART1_RX_BANK_SIZE
+                           + writtenOffset - readOffset);
+      endOffset = DMA2_USART1_RX_BANK_SIZE;
+    }
+    else if(banksBehind == 0 && writtenOffset > readOffset)
+    {
+      RecordRxPendingBytes(writtenOffset - readOffset);
+      endOffset = writtenOffset;
+    }
+    else
+    {
+      endOffset = readOffset;
+    }
 
-    if(isMagicFound == Magic_Found)
+    bank = dma2Usart1RxBanks[readBank % DMA2_USART1_RX_BANKS_COUNT];
+    while(readOffset != endOffset)
     {
-      osMessageQueuePut(queueHandleForLed2Task, led2UpdatedBlinksCount, 0, 0);
-      
-      FeedbackMessageUpdateTime();
-      DMA2_USART1_TX_SendFeedbackMessage(&feedbackMessage,
-                                         sizeof(feedbackMessage));
+      status = COMMAND_FRAME_FeedByte(&rxCommandDecoder, bank[readOffset],
+                                      &frame);
+      readOffset++;
+      ProcessRxFrameStatus(status, &frame);
     }
 
-    isMagicFound = Magic_NotFound;
+    if(readOffset == DMA2_USART1_RX_BANK_SIZE)
+    {
+      readBank++;
+      readOffset = 0;
+      continue;
+    }
 
-    osDelay(500);
+    osThreadFlagsWait(DMA2_USART1_RX_DATA_FLAG, osFlagsWaitAny,
+                      osWaitForever);
   }
 }
 
@@ -254,90 +469,127 @@ void StartDma2Usart1RxTask(void *argument)
 /*                     PRIVATE FUNCTIONS DEFINITIONS                         */
 /*****************************************************************************/
 
-static void InitializeFeedbackMessage(void)
+/*
+  The stream switches banks before the transfer complete interrupt counts
+  the full bank. The current target is read after the count, so a pending
+  interrupt shows as a target ahead of the count, and before the data
+  counter, so a switch in between gives a position behind the stream,
+  never ahead of it.
+*/
+static void GetDma2Usart1RxWritePosition(uint32_t *bank, uint32_t *offset)
 {
-  strncpy(feedbackMessage.magicWord, MAGIC_WORD, MAGIC_WORD_LENGTH + 1);
-  feedbackMessage.rtcTime = 0;
+  uint32_t completedBanksCount = rxCompletedBanksCount;
+  uint32_t currentTarget = LL_DMA_GetCurrentTargetMem(DMA2, LL_DMA_STREAM_2);
+  uint32_t dataLength = LL_DMA_GetDataLength(DMA2, LL_DMA_STREAM_2);
+  uint32_t countedTarget = (completedBanksCount % DMA2_USART1_RX_BANKS_COUNT
+                            == 0) ? LL_DMA_CURRENTTARGETMEM0
+                                  : LL_DMA_CURRENTTARGETMEM1;
+
+  if(currentTarget != countedTarget)
+  {
+    completedBanksCount++;
+  }
+
+  *bank = completedBanksCount;
+  *offset = DMA2_USART1_RX_BANK_SIZE - dataLength;
 }
 
 
 
-static size_t GetCurrentPositionInDma2Usart1RxBuffer(void)
+static void RecordRxOverrun(uint32_t lostBytesCount)
 {
-  return ARRAY_LENGTH(dma2Usart1RxBuffer) - 
-         LL_DMA_GetDataLength(DMA2, LL_DMA_STREAM_2);
+  ++rxStatistics.overrunsCount;
+  rxStatistics.lostBytesCount += lostBytesCount;
 }
 
 
 
-static size_t CountBytesLeftToCheck(size_t currentPosition,
-                                    size_t oldPosition)
+static void RecordRxPendingBytes(uint32_t pendingBytesCount)
 {
-  if(currentPosition > oldPosition)
+  if(pendingBytesCount > rxStatistics.maxPendingBytesCount)
   {
-    return currentPosition - oldPosition;
-  }
-  else if(currentPosition < oldPosition)
-  {
-    return (ARRAY_LENGTH(dma2Usart1RxBuffer) - oldPosition) + currentPosition;
-  }
-  else
-  {
-    return 0;
+    rxStatistics.maxPendingBytesCount = pendingBytesCount;
   }
 }
 
 
 
-
-static MagicStatus_t FindMagic(size_t dma2BufferOffset, size_t magicWordOffset,
-                               size_t magicWordLength)
+/*
+  Rejected frames are only counted, the sender sees the missing echo and
+  repeats the command.
+*/
+static void ProcessRxFrameStatus(commandFrameStatus_t status,
+                                 const commandFrame_t *frame)
 {
-  int isMagicFound;
-  isMagicFound = memcmp(dma2Usart1RxBuffer + dma2BufferOffset,
-                        MAGIC_WORD + magicWordOffset, magicWordLength);
-  if(isMagicFound == 0)
-  {
-    return Magic_Found;
-  }
-  else
+  switch(status)
   {
-    return Magic_NotFound;
+    case CommandFrame_Received:
+      ++rxStatistics.receivedFramesCount;
+      DispatchRxCommand(frame);
+      break;
+    case CommandFrame_FormatError:
+      ++rxStatistics.formatErrorsCount;
+      break;
+    case CommandFrame_CrcError:
+      ++rxStatistics.crcErrorsCount;
+      break;
+    default:
+      break;
   }
 }
 
 
 
-static size_t UpdateLed2BufferAndPosition(uint8_t *led2UpdatedBlinksCount,
-                                          size_t positionIndex,
-                                          size_t magicWordLength)
-                                       
+/*
+  The dispatcher hands the payload to the handler registered for the
+  command, the name of a dispatched command is echoed back together
+  with whether the handler rejected it and the RTC time.
+*/
+static void DispatchRxCommand(const commandFrame_t *frame)
 {
-  size_t newPosition = positionIndex + magicWordLength;
-  if(ARRAY_LENGTH(dma2Usart1RxBuffer) - newPosition == 1)
+  uint32_t isRejected = 0;
+  const char *name = COMMAND_DISPATCHER_Dispatch(frame, DWT_GetCycleCount(),
+                                                 &isRejected);
+  if(name == NULL)
   {
-    led2UpdatedBlinksCount[LONG_BLINK_BYTE] =dma2Usart1RxBuffer[newPosition];
-    newPosition = 0;
-    led2UpdatedBlinksCount[SHORT_BLINK_BYTE]=dma2Usart1RxBuffer[newPosition++];
-  }
-  else if(ARRAY_LENGTH(dma2Usart1RxBuffer) - newPosition == 0)
-  {
-    newPosition = 0;
-    led2UpdatedBlinksCount[LONG_BLINK_BYTE] =dma2Usart1RxBuffer[newPosition++];
-    led2UpdatedBlinksCount[SHORT_BLINK_BYTE]=dma2Usart1RxBuffer[newPosition++];
-  }
-  else
-  {
-    led2UpdatedBlinksCount[LONG_BLINK_BYTE] =dma2Usart1RxBuffer[newPosition++];
-    led2UpdatedBlinksCount[SHORT_BLINK_BYTE]=dma2Usart1RxBuffer[newPosition++];
+    ++rxStatistics.unknownCommandsCount;
+    return;
   }
 
-  return newPosition;
+  SendCommandEcho(name, isRejected);
+}
+
+
+
+static void SendCommandEcho(const char *name, uint32_t isRejected)
+{
+  telemetryMessage_t message = {
+    .type = TelemetryFrame_CommandEcho,
+    .commandEcho = {
+      .isRejected = (uint8_t)isRejected,
+      .timeInSeconds = (uint32_t)RTC_GetTimeInSeconds()
+    }
+  };
+  strncpy(message.commandEcho.name, name,
+          sizeof(message.commandEcho.name) - 1);
+
+  uint32_t frameSize = TELEMETRY_FRAME_Encode(&message, echoFrame);
+  DMA2_USART1_TX_SendFeedbackMessage(echoFrame, frameSize);
 }
 
 
 
-static void FeedbackMessageUpdateTime(void)
+static void SendRxOverrunReport(void)
 {
-  feedbackMessage.rtcTime = RTC_GetTimeInSeconds();
+  uint32_t tick = osKernelGetTickCount();
+  if(isRxOverrunReported != 0
+     && tick - rxOverrunReportTick < RX_OVERRUN_REPORT_PERIOD_MS)
+  {
+    return;
+  }
+
+  isRxOverrunReported = 1;
+  rxOverrunReportTick = tick;
+  uint32_t frameSize = DMA2_USART1_RX_EncodeStatistics(echoFrame);
+  DMA2_USART1_TX_SendFeedbackMessage(echoFrame, frameSize);
 }
@@ -0,0 +1,35 @@
+#include "dwt.h"
+
+#include "stm32f4xx.h"
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+void DWT_CycleCounter_Config(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+
+
+uint32_t DWT_GetCycleCount(void)
+{
+  return DWT->CYCCNT;
+}
+
+
+
+/*
+  The counter runs on the core clock, which is gated in sleep mode.
+  Advancing it by the time spent asleep keeps cycle differences measured
+  across a sleep in step with the wall clock.
+*/
+void DWT_AdvanceCycleCount(uint32_t cycles)
+{
+  DWT->CYCCNT += cycles;
+}
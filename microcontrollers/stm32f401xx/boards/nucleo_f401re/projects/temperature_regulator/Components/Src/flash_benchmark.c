@@ -0,0 +1,125 @@
+#include "dwt.h"
+#include "flash_benchmark.h"
+
+#include "cmsis_os2.h"
+
+#include "stm32f4xx.h"
+
+#include "stm32f4xx_ll_system.h"
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define REFERENCE_PASSES_COUNT 8U
+#define REFERENCE_MESSAGE_LENGTH (sizeof(referenceMessage) - 1U)
+
+#define CRC32_INITIAL_VALUE        0xFFFFFFFFU
+#define CRC32_POLYNOMIAL_REFLECTED 0xEDB88320U
+
+#define ACCELERATOR_BITS \
+  (FLASH_ACR_PRFTEN | FLASH_ACR_ICEN | FLASH_ACR_DCEN)
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+/* In flash, read by the reference loop through the data cache. */
+static const char referenceMessage[] =
+  "The quick brown fox jumps over the lazy dog";
+
+static volatile uint32_t crcSink;
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static uint32_t RunReferenceLoop(void) __attribute__((noinline));
+static void ResetFlashCaches(void);
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+/*
+  Must be called from a task. The kernel is locked so that other tasks do
+  not add to the measurements, interrupts stay enabled. The accelerator is
+  switched off for the first run, then its caches are reset and it is
+  switched back on as it was. A first run fills the caches before the
+  measured one.
+*/
+void FLASH_BENCHMARK_Run(flashBenchmarkResults_t *results)
+{
+  int32_t kernelLockState = osKernelLock();
+  uint32_t acceleratorBits = FLASH->ACR & ACCELERATOR_BITS;
+
+  FLASH->ACR &= ~ACCELERATOR_BITS;
+  uint32_t startCycleCount = DWT_GetCycleCount();
+  crcSink = RunReferenceLoop();
+  uint32_t acceleratorOffCycles = DWT_GetCycleCount() - startCycleCount;
+
+  ResetFlashCaches();
+  FLASH->ACR |= acceleratorBits;
+  crcSink = RunReferenceLoop();
+  startCycleCount = DWT_GetCycleCount();
+  crcSink = RunReferenceLoop();
+  uint32_t acceleratorOnCycles = DWT_GetCycleCount() - startCycleCount;
+
+  osKernelRestoreLock(kernelLockState);
+
+  results->frequencyHz = SystemCoreClock;
+  results->waitStatesCount = LL_FLASH_GetLatency();
+  results->bytesCount = REFERENCE_PASSES_COUNT * REFERENCE_MESSAGE_LENGTH;
+  results->acceleratorOffCycles = acceleratorOffCycles;
+  results->acceleratorOnCycles = acceleratorOnCycles;
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+/*
+  Bitwise CRC-32 of the reference message: a short loop with a branch per
+  bit, the kind of code the instruction cache and prefetch buffer hide the
+  flash wait states of.
+*/
+static uint32_t RunReferenceLoop(void)
+{
+  uint32_t crc = CRC32_INITIAL_VALUE;
+
+  for(uint32_t pass = 0; pass < REFERENCE_PASSES_COUNT; ++pass) {
+    for(uint32_t byte = 0; byte < REFERENCE_MESSAGE_LENGTH; ++byte) {
+      crc ^= (uint8_t)referenceMessage[byte];
+      for(uint32_t bit = 0; bit < 8U; ++bit) {
+        if((crc & 1U) != 0) {
+          crc = (crc >> 1) ^ CRC32_POLYNOMIAL_REFLECTED;
+        } else {
+          crc >>= 1;
+        }
+      }
+    }
+  }
+
+  return ~crc;
+}
+
+
+
+/* The caches can only be reset while they are disabled. */
+static void ResetFlashCaches(void)
+{
+  LL_FLASH_EnableInstCacheReset();
+  LL_FLASH_DisableInstCacheReset();
+  LL_FLASH_EnableDataCacheReset();
+  LL_FLASH_DisableDataCacheReset();
+}
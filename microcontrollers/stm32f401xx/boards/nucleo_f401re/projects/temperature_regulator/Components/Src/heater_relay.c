@@ -0,0 +1,180 @@
+#include "heater_relay.h"
+#include "relay_window.h"
+
+#include "cmsis_os2.h"
+
+#include "FreeRTOS.h"
+#include "timers.h"
+
+#include "stm32f4xx.h"
+
+#include "stm32f4xx_ll_gpio.h"
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define RELAY_HEATER_GPIO_PIN   LL_GPIO_PIN_8
+#define RELAY_HEATER_GPIO_PORT  GPIOA
+
+
+
+/*****************************************************************************/
+/*                             PRIVATE MACROS                                */
+/*****************************************************************************/
+
+#define TURN_ON_HEATER()   LL_GPIO_ResetOutputPin(RELAY_HEATER_GPIO_PORT,\
+                                                  RELAY_HEATER_GPIO_PIN)
+#define TURN_OFF_HEATER()  LL_GPIO_SetOutputPin(RELAY_HEATER_GPIO_PORT,\
+                                                RELAY_HEATER_GPIO_PIN)
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+/*
+  Created with the FreeRTOS API, osTimerNew allocates the callback context
+  from the RTOS heap even with static control blocks.
+*/
+static StaticTimer_t relayWindowTimerControlBlock;
+static StaticTimer_t relayPulseEndTimerControlBlock;
+static osTimerId_t relayWindowTimerHandle;
+static osTimerId_t relayPulseEndTimerHandle;
+
+static volatile uint32_t relayWindowMs;
+static volatile uint32_t relayDutyPerMille;
+static volatile uint32_t isRelayDisabled;
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static void StartRelayWindow(TimerHandle_t timer);
+static void EndRelayPulse(TimerHandle_t timer);
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+/*
+  Time-proportional output: every window starts with the heater on for
+  duty / RELAY_WINDOW_DUTY_MAX of the window. Both edges are driven by RTOS
+  software timers, the duty and window are picked up at the next window.
+*/
+void HEATER_RELAY_Start(uint32_t windowMs)
+{
+  TURN_OFF_HEATER();
+
+  relayWindowMs = windowMs;
+  relayWindowTimerHandle = (osTimerId_t)xTimerCreateStatic("RelayWindow",
+    pdMS_TO_TICKS(windowMs), pdTRUE, NULL, StartRelayWindow,
+    &relayWindowTimerControlBlock);
+  relayPulseEndTimerHandle = (osTimerId_t)xTimerCreateStatic("RelayPulseEnd",
+    1, pdFALSE, NULL, EndRelayPulse, &relayPulseEndTimerControlBlock);
+  osTimerStart(relayWindowTimerHandle, windowMs);
+}
+
+
+
+void HEATER_RELAY_SetWindow(uint32_t windowMs)
+{
+  if(windowMs == relayWindowMs) {
+    return;
+  }
+
+  relayWindowMs = windowMs;
+  osTimerStart(relayWindowTimerHandle, windowMs);
+}
+
+
+
+void HEATER_RELAY_SetDuty(uint32_t dutyPerMille)
+{
+  if(dutyPerMille > RELAY_WINDOW_DUTY_MAX) {
+    dutyPerMille = RELAY_WINDOW_DUTY_MAX;
+  }
+  relayDutyPerMille = dutyPerMille;
+}
+
+
+
+/* Ends the current pulse early, the next window starts as usual. */
+void HEATER_RELAY_TurnOff(void)
+{
+  TURN_OFF_HEATER();
+}
+
+
+
+/*
+  Safe to call from interrupts. The heater stays off, whatever the duty,
+  until HEATER_RELAY_Enable is called.
+*/
+void HEATER_RELAY_Disable(void)
+{
+  isRelayDisabled = 1;
+  TURN_OFF_HEATER();
+}
+
+
+
+void HEATER_RELAY_Enable(void)
+{
+  isRelayDisabled = 0;
+}
+
+
+
+heaterState_t HEATER_RELAY_GetState(void)
+{
+  if(LL_GPIO_IsInputPinSet(RELAY_HEATER_GPIO_PORT, RELAY_HEATER_GPIO_PIN) == 0) {
+    return Heater_On;
+  } else {
+    return Heater_Off;
+  }
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+static void StartRelayWindow(TimerHandle_t timer)
+{
+  uint32_t windowMs = relayWindowMs;
+  uint32_t pulseTimeMs = RELAY_WINDOW_CalculatePulseTime(windowMs,
+    relayDutyPerMille);
+
+  if(pulseTimeMs == 0) {
+    TURN_OFF_HEATER();
+    return;
+  }
+
+  /* Interrupts masked, so a watchdog trip cannot fall between check and on. */
+  __disable_irq();
+  if(isRelayDisabled == 0) {
+    TURN_ON_HEATER();
+  }
+  __enable_irq();
+
+  if(pulseTimeMs < windowMs) {
+    osTimerStart(relayPulseEndTimerHandle, pulseTimeMs);
+  }
+}
+
+
+
+static void EndRelayPulse(TimerHandle_t timer)
+{
+  TURN_OFF_HEATER();
+}
+
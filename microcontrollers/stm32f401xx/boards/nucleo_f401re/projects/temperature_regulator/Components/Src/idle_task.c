@@ -1,6 +1,109 @@
+#include "adc_temperature_regulator.h"
+#include "command_dispatcher.h"
+#include "command_frame.h"
+#include "dma.h"
+#include "flash_benchmark.h"
 #include "idle_task.h"
+#include "low_power.h"
+#include "run_time_stats.h"
+#include "system_clock.h"
+#include "telemetry_frame.h"
+#include "trace_recorder.h"
 
 #include "cmsis_os.h"
+#include "task.h"
+
+#include <string.h>
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+/* Below the 51 s the DWT run time counters take to wrap at 84 MHz. */
+#define REPORT_PERIOD_MS 30000U
+
+/* Clock profile governor, measures the load over each period. */
+#define GOVERNOR_PERIOD_MS 1000U
+
+#define REPORT_REQUEST_FLAG  0x01U
+#define TRACE_DUMP_FLAG      0x02U
+#define FLASH_BENCHMARK_FLAG 0x04U
+
+#define CPU_REPORT_PAYLOAD_SIZE 0U
+#define CPU_REPORT_COMMAND_NAME "CPUS"
+#define TRACE_DUMP_PAYLOAD_SIZE 0U
+#define TRACE_DUMP_COMMAND_NAME "TRCE"
+#define FLASH_BENCHMARK_PAYLOAD_SIZE 0U
+#define FLASH_BENCHMARK_COMMAND_NAME "FLSH"
+
+/* About one full telemetry frame at 115200 baud. */
+#define TX_RING_BUFFER_WAIT_MS 4U
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+static osThreadId_t reportTaskHandle;
+
+static lowPowerStatistics_t previousLowPowerStatistics;
+static runTimeTaskStatistics_t tasksStatistics[RUN_TIME_STATS_TASKS_MAX];
+static TaskStatus_t tasksStatus[RUN_TIME_STATS_TASKS_MAX];
+
+static uint8_t telemetryFrame[TELEMETRY_FRAME_SIZE_MAX];
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static int32_t HandleCpuReportCommand(const uint8_t *payload);
+static int32_t HandleTraceDumpCommand(const uint8_t *payload);
+static int32_t HandleFlashBenchmarkCommand(const uint8_t *payload);
+static void SendLowPowerReport(uint32_t periodTicks);
+static void SendClockReport(void);
+static void SendCpuReport(void);
+static void SendSamplingReport(void);
+static void SendTxReport(void);
+static void SendCommandReport(void);
+static void SendRxReport(void);
+static void SendTraceDump(void);
+static void SendTraceRecords(uint32_t recordsCount);
+static void SendFlashBenchmarkReports(void);
+static void SendFlashBenchmarkReport(void);
+static void SendTraceName(telemetryFrameType_t type, uint32_t number,
+  const char *name);
+static void SendTelemetryMessage(const telemetryMessage_t *message);
+static void SendTelemetryMessageWhenRoom(const telemetryMessage_t *message);
+static void SendTelemetryFrameWhenRoom(uint32_t frameSize);
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+/*
+  The CPU report, trace dump and flash benchmark commands only wake the
+  task, which sends the reports and the dump and runs the benchmark.
+*/
+void IDLE_TASK_RegisterCommands(osThreadId_t idleTaskHandle)
+{
+  reportTaskHandle = idleTaskHandle;
+  COMMAND_DISPATCHER_RegisterHandler(COMMAND_FRAME_ID_CPU_REPORT,
+    CPU_REPORT_PAYLOAD_SIZE, CPU_REPORT_COMMAND_NAME,
+    HandleCpuReportCommand);
+  COMMAND_DISPATCHER_RegisterHandler(COMMAND_FRAME_ID_TRACE_DUMP,
+    TRACE_DUMP_PAYLOAD_SIZE, TRACE_DUMP_COMMAND_NAME,
+    HandleTraceDumpCommand);
+  COMMAND_DISPATCHER_RegisterHandler(COMMAND_FRAME_ID_FLASH_BENCHMARK,
+    FLASH_BENCHMARK_PAYLOAD_SIZE, FLASH_BENCHMARK_COMMAND_NAME,
+    HandleFlashBenchmarkCommand);
+}
 
 
 
@@ -8,10 +111,422 @@
 /*                         RTOS TASK DEFINITION                              */
 /*****************************************************************************/
 
+/*
+  The sleeping itself is done by the RTOS idle task (tickless idle). This
+  task wakes once per report period, or when the CPU report command asks
+  for it, and sends the low power, clock and per task CPU reports covering
+  the time since the previous ones, the ADC1 sampling report, the per
+  command dispatch report and the USART1 RX and TX reports. The trace dump
+  command makes it send the event trace recorded since the previous dump.
+  In between, it runs the clock profile governor once per governor period.
+  The flash benchmark runs once at start, on the boot clock profile, and
+  on every clock profile when the command asks for it.
+*/
 void StartIdleTask(void *argument)
 {
+  uint32_t previousTick = osKernelGetTickCount();
+  uint32_t reportTick = previousTick + REPORT_PERIOD_MS;
+  uint32_t governorTick = previousTick + GOVERNOR_PERIOD_MS;
+
+  LOW_POWER_GetStatistics(&previousLowPowerStatistics);
+  (void)RUN_TIME_STATS_GetTaskStatistics(tasksStatistics);
+  SendFlashBenchmarkReport();
+
   for(;;)
   {
-    osDelay(1);
+    uint32_t flags = 0;
+    uint32_t tick = osKernelGetTickCount();
+    uint32_t wakeTick = (int32_t)(governorTick - reportTick) < 0 ?
+      governorTick : reportTick;
+    if((int32_t)(wakeTick - tick) > 0) {
+      flags = osThreadFlagsWait(REPORT_REQUEST_FLAG | TRACE_DUMP_FLAG |
+        FLASH_BENCHMARK_FLAG, osFlagsWaitAny, wakeTick - tick);
+      if((flags & osFlagsError) != 0) {
+        flags = 0;
+      }
+      tick = osKernelGetTickCount();
+    }
+
+    if((int32_t)(governorTick - tick) <= 0) {
+      governorTick = tick + GOVERNOR_PERIOD_MS;
+      SYSTEM_CLOCK_Governor_Update();
+    }
+
+    if((flags & TRACE_DUMP_FLAG) != 0) {
+      SendTraceDump();
+    }
+
+    if((flags & FLASH_BENCHMARK_FLAG) != 0) {
+      SendFlashBenchmarkReports();
+    }
+
+    if((int32_t)(reportTick - tick) <= 0) {
+      reportTick = tick + REPORT_PERIOD_MS;
+    } else if((flags & REPORT_REQUEST_FLAG) == 0) {
+      continue;
+    }
+
+    SendLowPowerReport(tick - previousTick);
+    SendClockReport();
+    SendCpuReport();
+    SendSamplingReport();
+    SendCommandReport();
+    SendRxReport();
+    SendTxReport();
+    previousTick = tick;
+  }
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+static int32_t HandleCpuReportCommand(const uint8_t *payload)
+{
+  (void)payload;
+  osThreadFlagsSet(reportTaskHandle, REPORT_REQUEST_FLAG);
+
+  return COMMAND_DISPATCHER_EXECUTED;
+}
+
+
+
+static int32_t HandleTraceDumpCommand(const uint8_t *payload)
+{
+  (void)payload;
+  osThreadFlagsSet(reportTaskHandle, TRACE_DUMP_FLAG);
+
+  return COMMAND_DISPATCHER_EXECUTED;
+}
+
+
+
+static int32_t HandleFlashBenchmarkCommand(const uint8_t *payload)
+{
+  (void)payload;
+  osThreadFlagsSet(reportTaskHandle, FLASH_BENCHMARK_FLAG);
+
+  return COMMAND_DISPATCHER_EXECUTED;
+}
+
+
+
+/*
+  Share of the period spent asleep, in per mille, and the number of
+  wakeups.
+*/
+static void SendLowPowerReport(uint32_t periodTicks)
+{
+  lowPowerStatistics_t current;
+  LOW_POWER_GetStatistics(&current);
+
+  const lowPowerStatistics_t *previous = &previousLowPowerStatistics;
+  uint32_t periodMs = periodTicks * 1000U / osKernelGetTickFreq();
+  if(periodMs == 0) {
+    periodMs = 1;
+  }
+
+  const telemetryMessage_t message = {
+    .type = TelemetryFrame_LowPower,
+    .lowPower = {
+      .sleepPerMille = (uint16_t)(((uint64_t)(current.sleepTimeMs -
+        previous->sleepTimeMs) * 1000U) / periodMs),
+      .wakeupsCount = current.sleepsCount - previous->sleepsCount
+    }
+  };
+  SendTelemetryMessage(&message);
+
+  previousLowPowerStatistics = current;
+}
+
+
+
+/*
+  Core clock of the current profile, profile switches since reset and the
+  load measured by the governor over its last period, in per mille.
+*/
+static void SendClockReport(void)
+{
+  systemClockStatistics_t statistics;
+  SYSTEM_CLOCK_GetStatistics(&statistics);
+
+  const telemetryMessage_t message = {
+    .type = TelemetryFrame_Clock,
+    .clock = {
+      .frequencyHz = statistics.frequencyHz,
+      .switchesCount = statistics.switchesCount,
+      .busyPerMille = (uint16_t)statistics.busyPerMille
+    }
+  };
+  SendTelemetryMessage(&message);
+}
+
+
+
+/*
+  One frame per task: CPU share in per mille and the longest activation in
+  microseconds.
+*/
+static void SendCpuReport(void)
+{
+  uint32_t tasksCount = RUN_TIME_STATS_GetTaskStatistics(tasksStatistics);
+  telemetryMessage_t message = { .type = TelemetryFrame_CpuTask };
+
+  for(uint32_t task = 0; task < tasksCount; ++task) {
+    const runTimeTaskStatistics_t *statistics = &tasksStatistics[task];
+    strncpy(message.cpuTask.name, statistics->name,
+      sizeof(message.cpuTask.name) - 1);
+    message.cpuTask.cpuPerMille = (uint16_t)statistics->cpuPerMille;
+    message.cpuTask.maxActivationUs = statistics->maxActivationUs;
+    SendTelemetryMessage(&message);
+  }
+}
+
+
+
+/*
+  Spacing of the ADC1 readings in core clock cycles. The statistics start
+  again on every clock switch and only the governor, run by this task,
+  switches, so the cycle rate sent is the one they were measured at. This
+  and the reports after it wait for room, the whole report does not fit
+  in the TX ring buffer.
+*/
+static void SendSamplingReport(void)
+{
+  adc1SamplingStatistics_t statistics;
+  ADC1_TEMPERATURE_REGULATOR_GetSamplingStatistics(&statistics);
+
+  const telemetryMessage_t message = {
+    .type = TelemetryFrame_Sampling,
+    .sampling = {
+      .readingsCount = statistics.readingsCount,
+      .expectedPeriodCycles = statistics.expectedPeriodCycles,
+      .lastPeriodCycles = statistics.lastPeriodCycles,
+      .minPeriodCycles = statistics.minPeriodCycles,
+      .maxPeriodCycles = statistics.maxPeriodCycles,
+      .maxJitterCycles = statistics.maxJitterCycles,
+      .cyclesPerSecond = SystemCoreClock
+    }
+  };
+  SendTelemetryMessageWhenRoom(&message);
+}
+
+
+
+/*
+  One frame per command route: dispatch, rejection and drop counts since
+  reset and the latency from decoding to execution.
+*/
+static void SendCommandReport(void)
+{
+  commandDispatchStatistics_t statistics;
+  telemetryMessage_t message = { .type = TelemetryFrame_CommandStatistics };
+  telemetryCommandStatistics_t *command = &message.commandStatistics;
+  const char *name;
+
+  for(uint32_t route = 0; (name = COMMAND_DISPATCHER_GetStatistics(route,
+    &statistics)) != NULL; ++route) {
+    strncpy(command->name, name, sizeof(command->name) - 1);
+    command->dispatchedCount = statistics.dispatchedCount;
+    command->rejectedCount = statistics.rejectedCount;
+    command->droppedCount = statistics.droppedCount;
+    command->lastLatencyCycles = statistics.lastLatencyCycles;
+    command->maxLatencyCycles = statistics.maxLatencyCycles;
+    command->cyclesPerSecond = SystemCoreClock;
+    SendTelemetryMessageWhenRoom(&message);
+  }
+}
+
+
+
+/* The RX task sends the same frame on an overrun. */
+static void SendRxReport(void)
+{
+  uint32_t frameSize = DMA2_USART1_RX_EncodeStatistics(telemetryFrame);
+  SendTelemetryFrameWhenRoom(frameSize);
+}
+
+
+
+/*
+  USART1 TX counters since reset. Taken last, so the frames of this report
+  are in them.
+*/
+static void SendTxReport(void)
+{
+  dma2Usart1TxStatistics_t statistics;
+  DMA2_USART1_TX_GetStatistics(&statistics);
+
+  const telemetryMessage_t message = {
+    .type = TelemetryFrame_TxStatistics,
+    .txStatistics = {
+      .queuedFramesCount = statistics.queuedFramesCount,
+      .overflowFramesCount = statistics.overflowFramesCount,
+      .droppedFramesCount = statistics.droppedFramesCount,
+      .transfersCount = statistics.transfersCount,
+      .maxQueuedBytesCount = statistics.maxQueuedBytesCount
+    }
+  };
+  SendTelemetryMessageWhenRoom(&message);
+}
+
+
+
+/*
+  Recording stops for the dump, so the dump does not trace itself over the
+  records being sent, and starts again empty once it is sent. The frames
+  wait for room in the TX ring buffer, a dump takes about a second.
+*/
+static void SendTraceDump(void)
+{
+  uint32_t overwrittenCount = 0;
+  uint32_t recordsCount = TRACE_RECORDER_Freeze(&overwrittenCount);
+
+  const telemetryMessage_t header = {
+    .type = TelemetryFrame_TraceHeader,
+    .traceHeader = {
+      .recordsCount = recordsCount,
+      .overwrittenCount = overwrittenCount,
+      .cyclesPerSecond = SystemCoreClock
+    }
+  };
+  SendTelemetryMessageWhenRoom(&header);
+
+  uint32_t tasksCount = uxTaskGetSystemState(tasksStatus,
+    RUN_TIME_STATS_TASKS_MAX, NULL);
+  for(uint32_t task = 0; task < tasksCount; ++task) {
+    SendTraceName(TelemetryFrame_TraceTask, tasksStatus[task].xTaskNumber,
+      tasksStatus[task].pcTaskName);
+  }
+
+  for(uint32_t queue = 1; queue <= TRACE_RECORDER_QUEUES_MAX; ++queue) {
+    const char *name = TRACE_RECORDER_GetQueueName(queue);
+    if(name != NULL) {
+      SendTraceName(TelemetryFrame_TraceQueue, queue, name);
+    }
+  }
+
+  SendTraceRecords(recordsCount);
+
+  const telemetryMessage_t end = { .type = TelemetryFrame_TraceEnd };
+  SendTelemetryMessageWhenRoom(&end);
+
+  TRACE_RECORDER_Restart();
+}
+
+
+
+static void SendTraceRecords(uint32_t recordsCount)
+{
+  traceRecord_t record;
+  telemetryMessage_t message = { .type = TelemetryFrame_TraceRecords };
+  telemetryTraceRecords_t *trace = &message.traceRecords;
+
+  for(uint32_t first = 0; first < recordsCount;
+    first += TELEMETRY_FRAME_TRACE_RECORDS_MAX) {
+    trace->recordsCount = 0;
+    for(uint32_t index = first; index < recordsCount &&
+      index < first + TELEMETRY_FRAME_TRACE_RECORDS_MAX; ++index) {
+      TRACE_RECORDER_GetRecord(index, &record);
+      trace->records[trace->recordsCount].cycles = record.cycles;
+      trace->records[trace->recordsCount].event = record.event;
+      trace->records[trace->recordsCount].object = record.object;
+      trace->records[trace->recordsCount].data = record.data;
+      ++trace->recordsCount;
+    }
+    SendTelemetryMessageWhenRoom(&message);
+  }
+}
+
+
+
+/*
+  Runs the benchmark on every clock profile, slowest first, then goes back
+  to the profile the governor had picked.
+*/
+static void SendFlashBenchmarkReports(void)
+{
+  systemClockStatistics_t statistics;
+  SYSTEM_CLOCK_GetStatistics(&statistics);
+
+  for(uint32_t profile = 0; profile < SYSTEM_CLOCK_PROFILES_COUNT;
+    ++profile) {
+    SYSTEM_CLOCK_SetProfile((systemClockProfile_t)profile);
+    SendFlashBenchmarkReport();
+  }
+
+  SYSTEM_CLOCK_SetProfile(statistics.profile);
+}
+
+
+
+/*
+  Hundredths of cycle per byte of the reference loop with the flash
+  accelerator off and on.
+*/
+static void SendFlashBenchmarkReport(void)
+{
+  flashBenchmarkResults_t results;
+  FLASH_BENCHMARK_Run(&results);
+
+  const telemetryMessage_t message = {
+    .type = TelemetryFrame_FlashBenchmark,
+    .flashBenchmark = {
+      .frequencyHz = results.frequencyHz,
+      .waitStatesCount = (uint8_t)results.waitStatesCount,
+      .acceleratorOffCentiCycles = (uint32_t)(((uint64_t)
+        results.acceleratorOffCycles * 100U) / results.bytesCount),
+      .acceleratorOnCentiCycles = (uint32_t)(((uint64_t)
+        results.acceleratorOnCycles * 100U) / results.bytesCount)
+    }
+  };
+  SendTelemetryMessageWhenRoom(&message);
+}
+
+
+
+static void SendTraceName(telemetryFrameType_t type, uint32_t number,
+  const char *name)
+{
+  telemetryMessage_t message = {
+    .type = type,
+    .traceName = { .number = (uint8_t)number }
+  };
+  strncpy(message.traceName.name, name, sizeof(message.traceName.name) - 1);
+
+  SendTelemetryMessageWhenRoom(&message);
+}
+
+
+
+static void SendTelemetryMessage(const telemetryMessage_t *message)
+{
+  uint32_t frameSize = TELEMETRY_FRAME_Encode(message, telemetryFrame);
+  DMA2_USART1_TX_SendFeedbackMessage(telemetryFrame, frameSize);
+}
+
+
+
+static void SendTelemetryMessageWhenRoom(const telemetryMessage_t *message)
+{
+  uint32_t frameSize = TELEMETRY_FRAME_Encode(message, telemetryFrame);
+  SendTelemetryFrameWhenRoom(frameSize);
+}
+
+
+
+/*
+  Sends the frame in telemetryFrame once the TX ring buffer has room for it
+  and one more full frame, so the readings and command echoes sent
+  meanwhile by the other tasks still fit.
+*/
+static void SendTelemetryFrameWhenRoom(uint32_t frameSize)
+{
+  while(DMA2_USART1_TX_GetFreeBytesCount() <
+    frameSize + TELEMETRY_FRAME_SIZE_MAX) {
+    osDelay(TX_RING_BUFFER_WAIT_MS);
   }
+  DMA2_USART1_TX_SendFeedbackMessage(telemetryFrame, frameSize);
 }
@@ -1,10 +1,14 @@
-#include "dma.h"
+#include "command_dispatcher.h"
+#include "command_frame.h"
 #include "led.h"
+#include "tim.h"
 
-#include "cmsis_os.h"
+#include "stm32f4xx.h"
 
 #include "stm32f4xx_ll_gpio.h"
 
+#include <string.h>
+
 
 
 /*****************************************************************************/
@@ -20,8 +24,26 @@
 #define LONG_BLINKS_INDEX  0
 #define SHORT_BLINKS_INDEX 1
 
-#define SHORT_DELAY_MS 200
-#define LONG_DELAY_MS  (3 * SHORT_DELAY_MS)
+#define LED2_BLINKS_PAYLOAD_SIZE 2U
+#define LED2_COMMAND_NAME        "ABCD"
+
+/*
+  Patterns are played in 200 ms slots, one bit per slot: a short blink is
+  one slot on and one off, a long blink three on and three off, and the
+  pattern ends with 1.6 s off before it starts again.
+*/
+#define SLOT_MS             200U
+#define SHORT_BLINK_SLOTS   1U
+#define LONG_BLINK_SLOTS    3U
+#define PATTERN_PAUSE_SLOTS 8U
+
+#define BLINKS_COUNT_MAX 40U
+#define PATTERN_SLOTS_MAX \
+  (BLINKS_COUNT_MAX * 2U * (LONG_BLINK_SLOTS + SHORT_BLINK_SLOTS) + \
+   PATTERN_PAUSE_SLOTS)
+#define PATTERN_WORDS_COUNT ((PATTERN_SLOTS_MAX + 31U) / 32U)
+
+#define LED2_TIM_IRQ_PRIORITY 15
 
 
 
@@ -35,48 +57,155 @@
 
 
 /*****************************************************************************/
-/*                         RTOS TASK DEFINITION                              */
+/*                           PRIVATE STRUCTURES                              */
 /*****************************************************************************/
 
-void StartLed2Task(void *argument)
-{
-  uint8_t blinksCount[2] = {[LONG_BLINKS_INDEX] = LONG_BLINKS_COUNT_DEFAULT,
-                            [SHORT_BLINKS_INDEX] = SHORT_BLINKS_COUNT_DEFAULT};
-  uint8_t newBlinksCount[2];
-  osStatus_t foundNewCounts = osError;
+/* Bit n of the stream is bit n % 32 of word n / 32, set for LED2 on. */
+typedef struct led2Pattern {
+  uint32_t bits[PATTERN_WORDS_COUNT];
+  uint32_t slotsCount;
+}led2Pattern_t;
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+/* Played by the TIM3 interrupt, replaced with interrupts disabled. */
+static led2Pattern_t pattern;
+static uint32_t patternSlot;
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static void EncodePattern(uint8_t longBlinksCount, uint8_t shortBlinksCount,
+  led2Pattern_t *newPattern);
+static uint32_t AppendSlots(led2Pattern_t *newPattern, uint32_t slot,
+  uint32_t slotsCount, uint32_t isOn);
+static int32_t HandleLed2Command(const uint8_t *payload);
+
 
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+void LED2_Start(void)
+{
   LED2_OFF();
+  EncodePattern(LONG_BLINKS_COUNT_DEFAULT, SHORT_BLINKS_COUNT_DEFAULT,
+    &pattern);
+  patternSlot = 0;
 
-  for(;;)
-  {
-    foundNewCounts = osMessageQueueGet(GetQueueHandleForLed2Task(), 
-                                       newBlinksCount, NULL, 1000);
-    if(foundNewCounts == osOK)
-    {
-      blinksCount[LONG_BLINKS_INDEX] = newBlinksCount[LONG_BLINKS_INDEX];
-      blinksCount[SHORT_BLINKS_INDEX] = newBlinksCount[SHORT_BLINKS_INDEX];
-    }
+  TIM3_LED2_Pattern_Config(1000U / SLOT_MS);
+  NVIC_SetPriority(TIM3_IRQn,
+    NVIC_EncodePriority(NVIC_GetPriorityGrouping(), LED2_TIM_IRQ_PRIORITY, 0));
+  NVIC_EnableIRQ(TIM3_IRQn);
 
-    for(uint8_t longBlinks = 0; longBlinks < blinksCount[LONG_BLINKS_INDEX];
-        longBlinks++)
-    {
-      LED2_ON();
-      osDelay(LONG_DELAY_MS);
-      LED2_OFF();
-      osDelay(LONG_DELAY_MS);
-    }
+  TIM3_LED2_Pattern_Start();
+}
 
-    for(uint8_t shortBlinks = 0; shortBlinks < blinksCount[SHORT_BLINKS_INDEX]; 
-        shortBlinks++)
-    {
-      LED2_ON();
-      osDelay(SHORT_DELAY_MS);
-      LED2_OFF();
-      osDelay(SHORT_DELAY_MS);
-    }
 
-    osDelay(500);
+
+/*
+  Counts above BLINKS_COUNT_MAX are cut to it. The new pattern starts from
+  its first slot at the next TIM3 update, never mixed with the old one.
+*/
+void LED2_UpdateBlinkPattern(const uint8_t newLongBlinksAmount,
+                             const uint8_t newShortBlinksAmount)
+{
+  led2Pattern_t newPattern;
+  EncodePattern(newLongBlinksAmount, newShortBlinksAmount, &newPattern);
+
+  __disable_irq();
+  pattern = newPattern;
+  patternSlot = 0;
+  __enable_irq();
+}
+
+
+
+/* The blink command runs in the USART1 RX task. */
+void LED2_RegisterCommands(void)
+{
+  COMMAND_DISPATCHER_RegisterHandler(COMMAND_FRAME_ID_LED2_BLINKS,
+    LED2_BLINKS_PAYLOAD_SIZE, LED2_COMMAND_NAME, HandleLed2Command);
+}
+
+
+
+/* TIM3 update interrupt, plays one slot of the pattern. */
+void LED2_PatternTimer_Callback(void)
+{
+  uint32_t slot = patternSlot;
+
+  if((pattern.bits[slot / 32U] & (1UL << (slot % 32U))) != 0) {
+    LED2_ON();
+  } else {
+    LED2_OFF();
+  }
+
+  ++slot;
+  patternSlot = slot < pattern.slotsCount ? slot : 0;
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+static void EncodePattern(uint8_t longBlinksCount, uint8_t shortBlinksCount,
+  led2Pattern_t *newPattern)
+{
+  uint32_t slot = 0;
+
+  if(longBlinksCount > BLINKS_COUNT_MAX) {
+    longBlinksCount = BLINKS_COUNT_MAX;
   }
+  if(shortBlinksCount > BLINKS_COUNT_MAX) {
+    shortBlinksCount = BLINKS_COUNT_MAX;
+  }
+
+  memset(newPattern->bits, 0, sizeof(newPattern->bits));
+
+  for(uint32_t blink = 0; blink < longBlinksCount; ++blink) {
+    slot = AppendSlots(newPattern, slot, LONG_BLINK_SLOTS, 1);
+    slot = AppendSlots(newPattern, slot, LONG_BLINK_SLOTS, 0);
+  }
+  for(uint32_t blink = 0; blink < shortBlinksCount; ++blink) {
+    slot = AppendSlots(newPattern, slot, SHORT_BLINK_SLOTS, 1);
+    slot = AppendSlots(newPattern, slot, SHORT_BLINK_SLOTS, 0);
+  }
+  slot = AppendSlots(newPattern, slot, PATTERN_PAUSE_SLOTS, 0);
+
+  newPattern->slotsCount = slot;
+}
+
+
+
+static uint32_t AppendSlots(led2Pattern_t *newPattern, uint32_t slot,
+  uint32_t slotsCount, uint32_t isOn)
+{
+  for(uint32_t lastSlot = slot + slotsCount; slot < lastSlot; ++slot) {
+    if(isOn != 0) {
+      newPattern->bits[slot / 32U] |= 1UL << (slot % 32U);
+    }
+  }
+
+  return slot;
+}
+
+
+
+static int32_t HandleLed2Command(const uint8_t *payload)
+{
+  LED2_UpdateBlinkPattern(payload[LONG_BLINKS_INDEX],
+    payload[SHORT_BLINKS_INDEX]);
 
-  osThreadTerminate(NULL);
+  return COMMAND_DISPATCHER_EXECUTED;
 }
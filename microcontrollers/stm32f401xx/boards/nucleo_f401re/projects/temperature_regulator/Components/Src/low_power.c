@@ -0,0 +1,169 @@
+#include "dwt.h"
+#include "low_power.h"
+#include "rtc.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "stm32f4xx.h"
+
+#include "stm32f4xx_ll_cortex.h"
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define TICK_PERIOD_US (1000000U / configTICK_RATE_HZ)
+
+/* Longest idle period the RTC wakeup timer can end. */
+#define IDLE_TICKS_MAX (RTC_WAKEUP_PERIOD_MAX_US / TICK_PERIOD_US)
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+static uint32_t sleepsCount;
+static uint64_t sleepSubseconds;
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static uint32_t Sleep(uint32_t periodUs);
+static void RestartSysTick(uint32_t cyclesToNextTick);
+static void RecordSleep(uint32_t sleptSubseconds);
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+/*
+  portSUPPRESS_TICKS_AND_SLEEP, called by the RTOS idle task when no task is
+  ready for at least configEXPECTED_IDLE_TIME_BEFORE_SLEEP ticks. The
+  SysTick is stopped and the RTC wakeup timer ends the sleep one tick before
+  the next task unblocks, unless an interrupt comes first. The time asleep
+  is measured with the RTC subsecond counter and the tick count is stepped
+  by it, the part of a tick left over is handed back to the SysTick.
+
+  The idle periods are spent in sleep mode only. STOP mode halts every clock
+  but the LSE, while TIM2 triggers ADC1 conversions moved by DMA2 all the
+  time and USART1 reception never stops either, so there is no idle period
+  in which STOP mode would not lose samples or command bytes.
+*/
+void LOW_POWER_SuppressTicksAndSleep(uint32_t expectedIdleTicks)
+{
+  const uint32_t cyclesPerTick = SystemCoreClock / configTICK_RATE_HZ;
+
+  if(expectedIdleTicks > IDLE_TICKS_MAX) {
+    expectedIdleTicks = IDLE_TICKS_MAX;
+  }
+
+  __disable_irq();
+  __DSB();
+  __ISB();
+
+  SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+  uint32_t tickElapsedCycles = SysTick->LOAD - SysTick->VAL;
+
+  /* A tick already pending would be counted twice. */
+  if(eTaskConfirmSleepModeStatus() == eAbortSleep ||
+    (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0) {
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+    __enable_irq();
+    return;
+  }
+
+  uint32_t periodUs = (expectedIdleTicks - 1) * TICK_PERIOD_US +
+    (uint32_t)(((uint64_t)(cyclesPerTick - tickElapsedCycles) * 1000000U) /
+    SystemCoreClock);
+  uint32_t sleptSubseconds = Sleep(periodUs);
+  uint32_t sleptCycles = (uint32_t)(((uint64_t)sleptSubseconds *
+    SystemCoreClock) / RTC_SUBSECONDS_PER_SECOND);
+  DWT_AdvanceCycleCount(sleptCycles);
+
+  uint64_t elapsedCycles = (uint64_t)tickElapsedCycles + sleptCycles;
+  uint32_t elapsedTicks = (uint32_t)(elapsedCycles / cyclesPerTick);
+  if(elapsedTicks > expectedIdleTicks - 1) {
+    elapsedTicks = expectedIdleTicks - 1;
+  }
+  uint64_t leftoverCycles = elapsedCycles -
+    (uint64_t)elapsedTicks * cyclesPerTick;
+  if(leftoverCycles >= cyclesPerTick) {
+    leftoverCycles = cyclesPerTick - 1;
+  }
+
+  RestartSysTick(cyclesPerTick - (uint32_t)leftoverCycles);
+  vTaskStepTick(elapsedTicks);
+  RecordSleep(sleptSubseconds);
+
+  __enable_irq();
+}
+
+
+
+void LOW_POWER_GetStatistics(lowPowerStatistics_t *statistics)
+{
+  __disable_irq();
+  statistics->sleepsCount = sleepsCount;
+  statistics->sleepTimeMs =
+    (uint32_t)((sleepSubseconds * 1000U) / RTC_SUBSECONDS_PER_SECOND);
+  __enable_irq();
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+/*
+  Called with interrupts disabled, a pending interrupt still ends WFI and is
+  served once they are enabled again. Returns the time asleep in RTC
+  subseconds.
+*/
+static uint32_t Sleep(uint32_t periodUs)
+{
+  uint32_t startTime = RTC_GetTimeOfDayInSubseconds();
+  RTC_WakeupTimer_Start(periodUs);
+
+  LL_LPM_EnableSleep();
+  __DSB();
+  __WFI();
+  __ISB();
+
+  uint32_t endTime = RTC_GetTimeOfDayInSubseconds();
+  RTC_WakeupTimer_Stop();
+
+  return (endTime + RTC_SUBSECONDS_PER_DAY - startTime) %
+    RTC_SUBSECONDS_PER_DAY;
+}
+
+
+
+/*
+  The first period only covers the rest of the current tick, the full
+  reload value is picked up by the counter when that period ends.
+*/
+static void RestartSysTick(uint32_t cyclesToNextTick)
+{
+  SysTick->LOAD = cyclesToNextTick > 1 ? cyclesToNextTick - 1 : 1;
+  SysTick->VAL = 0;
+  SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+  SysTick->LOAD = SystemCoreClock / configTICK_RATE_HZ - 1;
+}
+
+
+
+static void RecordSleep(uint32_t sleptSubseconds)
+{
+  ++sleepsCount;
+  sleepSubseconds += sleptSubseconds;
+}
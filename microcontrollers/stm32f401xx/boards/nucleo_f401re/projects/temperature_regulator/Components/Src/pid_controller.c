@@ -0,0 +1,163 @@
+#include "pid_controller.h"
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+/* Gain times error leaves twice the fractional bits in the product. */
+#define PRODUCT_FRACTIONAL_BITS (2 * PID_CONTROLLER_FRACTIONAL_BITS)
+
+#define MILLISECONDS_IN_SECOND 1000
+
+/*
+  Extra fractional bits of the filtered derivative. Without them the filter
+  update truncates to zero long before the derivative has decayed, leaving
+  a constant offset that the derivative gain turns into a large output bias.
+*/
+#define DERIVATIVE_EXTRA_BITS 8
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static int64_t ClampProduct(const pidController_t *pid, int64_t value);
+static int32_t ClampOutput(const pidController_t *pid, int64_t value);
+static int32_t UpdateFilteredDerivative(pidController_t *pid,
+  int32_t measurement);
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+void PID_CONTROLLER_Init(pidController_t *pid, const pidSettings_t *settings,
+  uint32_t samplePeriodMs, int32_t outputMin, int32_t outputMax)
+{
+  pid->settings = *settings;
+  pid->samplePeriodMs = samplePeriodMs;
+  pid->outputMin = outputMin;
+  pid->outputMax = outputMax;
+
+  PID_CONTROLLER_Reset(pid);
+}
+
+
+
+/*
+  The integral term is kept, so changing the gains of a running loop does
+  not bump the output by more than the proportional and derivative change.
+*/
+void PID_CONTROLLER_SetSettings(pidController_t *pid,
+  const pidSettings_t *settings)
+{
+  pid->settings = *settings;
+}
+
+
+
+void PID_CONTROLLER_Reset(pidController_t *pid)
+{
+  pid->integralTerm = 0;
+  pid->previousMeasurement = 0;
+  pid->filteredDerivative = 0;
+  pid->isPreviousMeasurementValid = 0;
+}
+
+
+
+/*
+  Called once every samplePeriodMs. The derivative acts on the measurement
+  only, so set point changes do not kick the output. Integration stops while
+  the output is saturated in the direction the error pushes it (conditional
+  integration) and the integral term never leaves the output range.
+*/
+int32_t PID_CONTROLLER_Update(pidController_t *pid, int32_t setPoint,
+  int32_t measurement)
+{
+  int32_t error = setPoint - measurement;
+
+  int64_t proportionalTerm =
+    (int64_t)pid->settings.proportionalGain * error;
+  int64_t derivativeTerm = ((int64_t)pid->settings.derivativeGain *
+    UpdateFilteredDerivative(pid, measurement)) >> DERIVATIVE_EXTRA_BITS;
+  int64_t integralStep = ((int64_t)pid->settings.integralGain * error *
+    pid->samplePeriodMs) / MILLISECONDS_IN_SECOND;
+
+  int64_t unsaturatedOutput =
+    proportionalTerm + pid->integralTerm + integralStep + derivativeTerm;
+  int64_t outputMax = (int64_t)pid->outputMax << PRODUCT_FRACTIONAL_BITS;
+  int64_t outputMin = (int64_t)pid->outputMin << PRODUCT_FRACTIONAL_BITS;
+
+  if(!(unsaturatedOutput > outputMax && integralStep > 0) &&
+    !(unsaturatedOutput < outputMin && integralStep < 0)) {
+    pid->integralTerm = ClampProduct(pid, pid->integralTerm + integralStep);
+  }
+
+  return ClampOutput(pid,
+    (proportionalTerm + pid->integralTerm + derivativeTerm) >>
+    PRODUCT_FRACTIONAL_BITS);
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+static int64_t ClampProduct(const pidController_t *pid, int64_t value)
+{
+  int64_t outputMax = (int64_t)pid->outputMax << PRODUCT_FRACTIONAL_BITS;
+  int64_t outputMin = (int64_t)pid->outputMin << PRODUCT_FRACTIONAL_BITS;
+
+  if(value > outputMax) {
+    return outputMax;
+  } else if(value < outputMin) {
+    return outputMin;
+  } else {
+    return value;
+  }
+}
+
+
+
+static int32_t ClampOutput(const pidController_t *pid, int64_t value)
+{
+  if(value > pid->outputMax) {
+    return pid->outputMax;
+  } else if(value < pid->outputMin) {
+    return pid->outputMin;
+  } else {
+    return (int32_t)value;
+  }
+}
+
+
+
+/*
+  Returns the negated rate of change of the measurement per second with
+  DERIVATIVE_EXTRA_BITS more fractional bits, run through a first order
+  low-pass filter. The first call has no history and returns zero.
+*/
+static int32_t UpdateFilteredDerivative(pidController_t *pid,
+  int32_t measurement)
+{
+  if(pid->isPreviousMeasurementValid == 0) {
+    pid->previousMeasurement = measurement;
+    pid->isPreviousMeasurementValid = 1;
+    return 0;
+  }
+
+  int32_t rawDerivative = (int32_t)((((int64_t)(pid->previousMeasurement -
+    measurement) * MILLISECONDS_IN_SECOND) << DERIVATIVE_EXTRA_BITS) /
+    (int64_t)pid->samplePeriodMs);
+  pid->previousMeasurement = measurement;
+
+  pid->filteredDerivative += (rawDerivative - pid->filteredDerivative) >>
+    pid->settings.derivativeFilterShift;
+  return pid->filteredDerivative;
+}
@@ -0,0 +1,223 @@
+#include "relay_autotuner.h"
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define TRANSIENT_CYCLES_COUNT 1
+
+/* Kp = 0.6 Ku, Ti = Tu / 2, Td = Tu / 8. */
+#define ZIEGLER_NICHOLS_PROPORTIONAL_NUMERATOR 3
+#define ZIEGLER_NICHOLS_PROPORTIONAL_DENOMINATOR 5
+#define ZIEGLER_NICHOLS_INTEGRAL_TIME_DIVISOR 2
+#define ZIEGLER_NICHOLS_DERIVATIVE_TIME_DIVISOR 8
+
+#define MILLISECONDS_IN_SECOND 1000
+
+/* Keeps the square root precise for amplitudes of a few LSB. */
+#define AMPLITUDE_EXTRA_BITS 8
+
+/* 355 / 113, within 1e-7 of pi. */
+#define PI_NUMERATOR 355
+#define PI_DENOMINATOR 113
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static void CountRelaySwitchOn(relayAutotuner_t *tuner, uint32_t timeMs,
+  int32_t temperature);
+static uint32_t SquareRoot(uint64_t value);
+static int32_t DivideAndRound(int64_t dividend, int64_t divisor);
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+void RELAY_AUTOTUNER_Init(relayAutotuner_t *tuner,
+  const relayAutotunerSettings_t *settings, uint32_t timeMs)
+{
+  tuner->settings = *settings;
+  tuner->startTimeMs = timeMs;
+  tuner->isRelayOn = 0;
+  tuner->switchOnsCount = 0;
+  tuner->isUpperBandCrossed = 0;
+  tuner->lastSwitchOnTimeMs = timeMs;
+  tuner->cycleMaxTemperature = INT32_MIN;
+  tuner->cycleMinTemperature = INT32_MAX;
+  tuner->measuredCyclesCount = 0;
+  tuner->periodsSumMs = 0;
+  tuner->peakToPeakSum = 0;
+}
+
+
+
+/*
+  Relay with hysteresis around the set point, the heater is switched on
+  below setPoint - hysteresis and off above setPoint + hysteresis.
+*/
+uint32_t RELAY_AUTOTUNER_GetRelayCommand(relayAutotuner_t *tuner,
+  int32_t temperature)
+{
+  const relayAutotunerSettings_t *settings = &tuner->settings;
+
+  if(temperature < settings->setPoint - settings->hysteresis) {
+    return 1;
+  } else if(temperature > settings->setPoint + settings->hysteresis) {
+    return 0;
+  } else {
+    return tuner->isRelayOn;
+  }
+}
+
+
+
+/*
+  Feeds one sample of the relay experiment. The relay state is passed in, so
+  that recorded traces of any on/off controller can be identified as well.
+  One cycle spans two relay switch-ons with the temperature going above
+  setPoint + hysteresis in between, so relay chatter caused by measurement
+  noise around the switching point does not start a new cycle.
+*/
+relayAutotunerStatus_t RELAY_AUTOTUNER_Observe(relayAutotuner_t *tuner,
+  uint32_t timeMs, int32_t temperature, uint32_t isRelayOn)
+{
+  if(temperature > tuner->settings.setPoint + tuner->settings.hysteresis) {
+    tuner->isUpperBandCrossed = 1;
+  }
+  if(isRelayOn != 0 && tuner->isRelayOn == 0 &&
+    (tuner->isUpperBandCrossed != 0 || tuner->switchOnsCount == 0)) {
+    CountRelaySwitchOn(tuner, timeMs, temperature);
+  }
+  tuner->isRelayOn = isRelayOn != 0;
+
+  if(temperature > tuner->cycleMaxTemperature) {
+    tuner->cycleMaxTemperature = temperature;
+  }
+  if(temperature < tuner->cycleMinTemperature) {
+    tuner->cycleMinTemperature = temperature;
+  }
+
+  if(tuner->measuredCyclesCount >= tuner->settings.cyclesCount) {
+    return RelayAutotuner_Finished;
+  } else if(timeMs - tuner->startTimeMs > tuner->settings.timeoutMs) {
+    return RelayAutotuner_Failed;
+  } else {
+    return RelayAutotuner_Running;
+  }
+}
+
+
+
+/*
+  Describing function of the relay: Ku = 4d / (pi * sqrt(a^2 - e^2)), with d
+  the relay amplitude, a the oscillation amplitude and e the hysteresis.
+  Only valid once RELAY_AUTOTUNER_Observe returned RelayAutotuner_Finished.
+  Integer only, so that the regulator task never uses the FPU and keeps the
+  basic exception frame.
+*/
+void RELAY_AUTOTUNER_GetResults(const relayAutotuner_t *tuner,
+  relayAutotunerResults_t *results)
+{
+  const int32_t one = 1 << PID_CONTROLLER_FRACTIONAL_BITS;
+  const relayAutotunerSettings_t *settings = &tuner->settings;
+  uint32_t cyclesCount = tuner->measuredCyclesCount;
+
+  int32_t amplitude = (int32_t)(tuner->peakToPeakSum / (2 * cyclesCount));
+  int64_t effectiveAmplitude = (int64_t)amplitude << AMPLITUDE_EXTRA_BITS;
+  if(amplitude > settings->hysteresis) {
+    effectiveAmplitude = SquareRoot((uint64_t)((int64_t)amplitude *
+      amplitude - (int64_t)settings->hysteresis * settings->hysteresis) <<
+      (2 * AMPLITUDE_EXTRA_BITS));
+  }
+  if(effectiveAmplitude < (1 << AMPLITUDE_EXTRA_BITS)) {
+    effectiveAmplitude = 1 << AMPLITUDE_EXTRA_BITS;
+  }
+
+  results->oscillationAmplitude = amplitude;
+  results->ultimatePeriodMs = (uint32_t)(tuner->periodsSumMs / cyclesCount);
+  results->ultimateGain = DivideAndRound(
+    ((int64_t)4 * settings->relayAmplitude * PI_DENOMINATOR * one * one) <<
+    AMPLITUDE_EXTRA_BITS, PI_NUMERATOR * effectiveAmplitude);
+
+  int64_t ultimatePeriodMs =
+    results->ultimatePeriodMs != 0 ? results->ultimatePeriodMs : 1;
+  int32_t proportionalGain = DivideAndRound(
+    (int64_t)results->ultimateGain * ZIEGLER_NICHOLS_PROPORTIONAL_NUMERATOR,
+    ZIEGLER_NICHOLS_PROPORTIONAL_DENOMINATOR);
+
+  results->pid.proportionalGain = proportionalGain;
+  results->pid.integralGain = DivideAndRound((int64_t)proportionalGain *
+    ZIEGLER_NICHOLS_INTEGRAL_TIME_DIVISOR * MILLISECONDS_IN_SECOND,
+    ultimatePeriodMs);
+  results->pid.derivativeGain = DivideAndRound((int64_t)proportionalGain *
+    ultimatePeriodMs, (int64_t)ZIEGLER_NICHOLS_DERIVATIVE_TIME_DIVISOR *
+    MILLISECONDS_IN_SECOND);
+  results->pid.derivativeFilterShift = settings->derivativeFilterShift;
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+static void CountRelaySwitchOn(relayAutotuner_t *tuner, uint32_t timeMs,
+  int32_t temperature)
+{
+  if(tuner->switchOnsCount > TRANSIENT_CYCLES_COUNT &&
+    tuner->measuredCyclesCount < tuner->settings.cyclesCount) {
+    tuner->periodsSumMs += timeMs - tuner->lastSwitchOnTimeMs;
+    tuner->peakToPeakSum +=
+      tuner->cycleMaxTemperature - tuner->cycleMinTemperature;
+    ++tuner->measuredCyclesCount;
+  }
+
+  ++tuner->switchOnsCount;
+  tuner->isUpperBandCrossed = 0;
+  tuner->lastSwitchOnTimeMs = timeMs;
+  tuner->cycleMaxTemperature = temperature;
+  tuner->cycleMinTemperature = temperature;
+}
+
+
+
+/* Bit by bit, rounded down. */
+static uint32_t SquareRoot(uint64_t value)
+{
+  uint64_t root = 0;
+  uint64_t bit = (uint64_t)1 << 62;
+
+  while(bit > value) {
+    bit >>= 2;
+  }
+  while(bit != 0) {
+    if(value >= root + bit) {
+      value -= root + bit;
+      root = (root >> 1) + bit;
+    } else {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+
+  return (uint32_t)root;
+}
+
+
+
+/*
+  Gains derived from a valid experiment are positive, a degenerate one
+  saturates instead of wrapping around.
+*/
+static int32_t DivideAndRound(int64_t dividend, int64_t divisor)
+{
+  int64_t quotient = (dividend + divisor / 2) / divisor;
+  return quotient > INT32_MAX ? INT32_MAX : (int32_t)quotient;
+}
@@ -0,0 +1,30 @@
+#include "relay_window.h"
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+/*
+  Time the relay stays on from the start of a window. The module has no
+  hardware dependencies, so the host simulation switches the relay exactly
+  like the firmware does.
+*/
+uint32_t RELAY_WINDOW_CalculatePulseTime(uint32_t windowMs,
+  uint32_t dutyPerMille)
+{
+  if(dutyPerMille > RELAY_WINDOW_DUTY_MAX) {
+    dutyPerMille = RELAY_WINDOW_DUTY_MAX;
+  }
+
+  uint32_t pulseTimeMs = (windowMs * dutyPerMille) / RELAY_WINDOW_DUTY_MAX;
+
+  if(pulseTimeMs < RELAY_WINDOW_MIN_SWITCH_TIME_MS) {
+    return 0;
+  } else if(windowMs - pulseTimeMs < RELAY_WINDOW_MIN_SWITCH_TIME_MS) {
+    return windowMs;
+  } else {
+    return pulseTimeMs;
+  }
+}
@@ -1,5 +1,6 @@
 #include "rtc.h"
 
+#include "stm32f4xx_ll_exti.h"
 #include "stm32f4xx_ll_pwr.h"
 #include "stm32f4xx_ll_rcc.h"
 #include "stm32f4xx_ll_rtc.h"
@@ -12,8 +13,16 @@
 /*                            PRIVATE DEFINES                                */
 /*****************************************************************************/
 
-#define RTC_SYNCH_PREDIV           ((uint32_t)255)
-#define RTC_ASYNCH_PREDIV          ((uint32_t)127)
+/*
+  32768 Hz LSE divided by 8 and 4096: the subsecond counter resolves 244 us,
+  fine enough to measure tickless idle periods against the 1 ms RTOS tick.
+*/
+#define RTC_SYNCH_PREDIV           ((uint32_t)(RTC_SUBSECONDS_PER_SECOND - 1))
+#define RTC_ASYNCH_PREDIV          ((uint32_t)7)
+
+/* Wakeup timer clocked by RTCCLK / 2, the 16-bit reload covers 4 s. */
+#define RTC_WAKEUP_CLOCK_HZ        (32768U / 2U)
+#define RTC_WAKEUP_IRQ_PRIORITY    15
 
 #define RTC_BKP_DATE_TIME_UPDATED ((uint32_t)0x32F2)
 
@@ -27,6 +36,7 @@
 
 static void RTC_EnterInitMode(void);
 static void RTC_ExitInitMode(void);
+static void RTC_Prescalers_Config(void);
 
 
 
@@ -61,8 +71,7 @@ void RTC_InitialSettings_Config(void)
 
     RTC_EnterInitMode();
 
-    LL_RTC_SetSynchPrescaler(RTC, RTC_SYNCH_PREDIV);
-    LL_RTC_SetAsynchPrescaler(RTC, RTC_ASYNCH_PREDIV);
+    RTC_Prescalers_Config();
 
     LL_RTC_DateTypeDef rtcDateStruct = {
       .WeekDay = LL_RTC_WEEKDAY_TUESDAY,
@@ -89,11 +98,101 @@ void RTC_InitialSettings_Config(void)
     LL_RTC_EnableWriteProtection(RTC);
 
     LL_RTC_BAK_SetRegister(RTC, LL_RTC_BKP_DR0, RTC_BKP_DATE_TIME_UPDATED);
+  } else if(LL_RTC_GetSynchPrescaler(RTC) != RTC_SYNCH_PREDIV) {
+    /* Set up by an older firmware, keep the calendar. */
+    LL_RTC_DisableWriteProtection(RTC);
+    RTC_EnterInitMode();
+    RTC_Prescalers_Config();
+    RTC_ExitInitMode();
+    LL_RTC_EnableWriteProtection(RTC);
   }
 }
 
 
 
+/* The wakeup timer interrupt goes through EXTI line 22. */
+void RTC_WakeupTimer_Config(void)
+{
+  LL_RTC_DisableWriteProtection(RTC);
+  LL_RTC_WAKEUP_Disable(RTC);
+  while(LL_RTC_IsActiveFlag_WUTW(RTC) != 1) {
+    ;
+  }
+  LL_RTC_WAKEUP_SetClock(RTC, LL_RTC_WAKEUPCLOCK_DIV_2);
+  LL_RTC_EnableIT_WUT(RTC);
+  LL_RTC_EnableWriteProtection(RTC);
+
+  LL_EXTI_EnableIT_0_31(LL_EXTI_LINE_22);
+  LL_EXTI_EnableRisingTrig_0_31(LL_EXTI_LINE_22);
+
+  NVIC_SetPriority(RTC_WKUP_IRQn, RTC_WAKEUP_IRQ_PRIORITY);
+  NVIC_EnableIRQ(RTC_WKUP_IRQn);
+}
+
+
+
+/* Periods longer than RTC_WAKEUP_PERIOD_MAX_US are cut to the maximum. */
+void RTC_WakeupTimer_Start(uint32_t periodUs)
+{
+  uint64_t wakeupClockTicks =
+    ((uint64_t)periodUs * RTC_WAKEUP_CLOCK_HZ) / 1000000U;
+  if(wakeupClockTicks == 0) {
+    wakeupClockTicks = 1;
+  } else if(wakeupClockTicks > 0x10000U) {
+    wakeupClockTicks = 0x10000U;
+  }
+
+  LL_RTC_DisableWriteProtection(RTC);
+  LL_RTC_WAKEUP_Disable(RTC);
+  while(LL_RTC_IsActiveFlag_WUTW(RTC) != 1) {
+    ;
+  }
+  LL_RTC_WAKEUP_SetAutoReload(RTC, (uint32_t)wakeupClockTicks - 1);
+  LL_RTC_ClearFlag_WUT(RTC);
+  LL_RTC_WAKEUP_Enable(RTC);
+  LL_RTC_EnableWriteProtection(RTC);
+}
+
+
+
+/*
+  Also drops a wakeup event that fired after another interrupt woke the MCU,
+  so it does not show up as a spurious interrupt.
+*/
+void RTC_WakeupTimer_Stop(void)
+{
+  LL_RTC_DisableWriteProtection(RTC);
+  LL_RTC_WAKEUP_Disable(RTC);
+  LL_RTC_ClearFlag_WUT(RTC);
+  LL_RTC_EnableWriteProtection(RTC);
+
+  LL_EXTI_ClearFlag_0_31(LL_EXTI_LINE_22);
+  NVIC_ClearPendingIRQ(RTC_WKUP_IRQn);
+}
+
+
+
+/*
+  Time of day in 1 / RTC_SUBSECONDS_PER_SECOND units. Reading the subsecond
+  register locks the calendar shadow registers until the date is read, so
+  the three reads are consistent.
+*/
+uint32_t RTC_GetTimeOfDayInSubseconds(void)
+{
+  uint32_t subseconds = LL_RTC_TIME_GetSubSecond(RTC);
+  uint32_t time = LL_RTC_TIME_Get(RTC);
+  (void)LL_RTC_DATE_Get(RTC);
+
+  uint32_t seconds =
+    __LL_RTC_CONVERT_BCD2BIN(__LL_RTC_GET_HOUR(time)) * 3600U +
+    __LL_RTC_CONVERT_BCD2BIN(__LL_RTC_GET_MINUTE(time)) * 60U +
+    __LL_RTC_CONVERT_BCD2BIN(__LL_RTC_GET_SECOND(time));
+
+  return seconds * RTC_SUBSECONDS_PER_SECOND + (RTC_SYNCH_PREDIV - subseconds);
+}
+
+
+
 time_t RTC_GetTimeInSeconds(void)
 {
   LL_RTC_TimeTypeDef rtcTimeStruct = {
@@ -145,3 +244,11 @@ static void RTC_ExitInitMode(void)
 
   LL_RTC_WaitForSynchro(RTC);
 }
+
+
+
+static void RTC_Prescalers_Config(void)
+{
+  LL_RTC_SetSynchPrescaler(RTC, RTC_SYNCH_PREDIV);
+  LL_RTC_SetAsynchPrescaler(RTC, RTC_ASYNCH_PREDIV);
+}
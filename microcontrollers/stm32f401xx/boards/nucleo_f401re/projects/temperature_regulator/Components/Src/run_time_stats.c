@@ -0,0 +1,99 @@
+#include "dwt.h"
+#include "run_time_stats.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+/* Task numbers are given in creation order, starting from 1. */
+#define TASK_NUMBERS_COUNT 16U
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+static uint32_t runningTaskNumber;
+static uint32_t switchedInCycles;
+static uint32_t maxActivationCycles[TASK_NUMBERS_COUNT];
+
+static TaskStatus_t tasksStatus[RUN_TIME_STATS_TASKS_MAX];
+static uint32_t previousRunTimeCounters[TASK_NUMBERS_COUNT];
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+/*
+  traceTASK_SWITCHED_IN, called by the scheduler with interrupts masked.
+  The activation of the task switched out ends here, a switch back to the
+  same task continues its activation.
+*/
+void RUN_TIME_STATS_TaskSwitchedIn(uint32_t taskNumber)
+{
+  if(taskNumber == runningTaskNumber) {
+    return;
+  }
+
+  uint32_t cycles = DWT_GetCycleCount();
+  uint32_t activationCycles = cycles - switchedInCycles;
+  uint32_t index = runningTaskNumber % TASK_NUMBERS_COUNT;
+  if(activationCycles > maxActivationCycles[index]) {
+    maxActivationCycles[index] = activationCycles;
+  }
+
+  runningTaskNumber = taskNumber;
+  switchedInCycles = cycles;
+}
+
+
+
+/*
+  Fills one entry per task and returns their number. The run time counters
+  are DWT cycle counts, they wrap after 2^32 cycles (51 s at 84 MHz), so
+  calls must come more often than that. Not reentrant.
+*/
+uint32_t RUN_TIME_STATS_GetTaskStatistics(
+  runTimeTaskStatistics_t statistics[RUN_TIME_STATS_TASKS_MAX])
+{
+  uint32_t tasksCount = uxTaskGetSystemState(tasksStatus,
+    RUN_TIME_STATS_TASKS_MAX, NULL);
+
+  uint64_t totalCycles = 0;
+  for(uint32_t task = 0; task < tasksCount; ++task) {
+    uint32_t number = tasksStatus[task].xTaskNumber % TASK_NUMBERS_COUNT;
+    totalCycles += tasksStatus[task].ulRunTimeCounter -
+      previousRunTimeCounters[number];
+  }
+  if(totalCycles == 0) {
+    totalCycles = 1;
+  }
+
+  for(uint32_t task = 0; task < tasksCount; ++task) {
+    uint32_t number = tasksStatus[task].xTaskNumber % TASK_NUMBERS_COUNT;
+    uint32_t runCycles = tasksStatus[task].ulRunTimeCounter -
+      previousRunTimeCounters[number];
+    previousRunTimeCounters[number] = tasksStatus[task].ulRunTimeCounter;
+
+    taskENTER_CRITICAL();
+    uint32_t activationCycles = maxActivationCycles[number];
+    maxActivationCycles[number] = 0;
+    taskEXIT_CRITICAL();
+
+    statistics[task].name = tasksStatus[task].pcTaskName;
+    statistics[task].cpuPerMille =
+      (uint32_t)(((uint64_t)runCycles * 1000U) / totalCycles);
+    statistics[task].maxActivationUs =
+      (uint32_t)(((uint64_t)activationCycles * 1000000U) / SystemCoreClock);
+  }
+
+  return tasksCount;
+}
@@ -0,0 +1,365 @@
+#include "adc_temperature_regulator.h"
+#include "dma.h"
+#include "dwt.h"
+#include "system_clock.h"
+#include "tim.h"
+#include "trace_recorder.h"
+#include "usart.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "stm32f4xx.h"
+
+#include "stm32f4xx_ll_pwr.h"
+#include "stm32f4xx_ll_rcc.h"
+#include "stm32f4xx_ll_system.h"
+#include "stm32f4xx_ll_utils.h"
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define HSI_CALIBRATION_TRIMMING 16U
+
+/*
+  The PLL input is the HSI divided down to 2 MHz, the frequency recommended
+  to limit its jitter, and the VCO runs at 336 MHz in both PLL profiles.
+*/
+#define PLL_INPUT_DIVIDER     LL_RCC_PLLM_DIV_8
+#define PLL_VCO_MULTIPLIER    168U
+
+/*
+  The governor steps up when the idle task got less than 30 % of the
+  period, and down when the load would stay below 50 % on the slower clock.
+*/
+#define GOVERNOR_SCALE_UP_BUSY_PER_MILLE   700U
+#define GOVERNOR_SCALE_DOWN_BUSY_PER_MILLE 500U
+
+#define HZ_PER_MHZ 1000000U
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE STRUCTURES                              */
+/*****************************************************************************/
+
+/*
+  Flash wait states for VDD from 2.7 V to 3.6 V: none up to 30 MHz, one up
+  to 60 MHz, two up to 84 MHz. Regulator scale 3 is good for up to 60 MHz,
+  scale 2 for 84 MHz. APB1 must stay at or below 42 MHz. The prefetch
+  buffer is on with wait states only, there is nothing to hide without.
+*/
+typedef struct systemClockProfileSettings {
+  uint32_t frequencyHz;
+  uint32_t isPll;
+  uint32_t pllOutputDivider;
+  uint32_t flashLatency;
+  uint32_t voltageScale;
+  uint32_t apb1Prescaler;
+}systemClockProfileSettings_t;
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+static const systemClockProfileSettings_t
+  profilesSettings[SYSTEM_CLOCK_PROFILES_COUNT] = {
+  [SystemClockProfile_Hsi16MHz] = {
+    .frequencyHz      = 16000000U,
+    .isPll            = 0,
+    .pllOutputDivider = 0,
+    .flashLatency     = LL_FLASH_LATENCY_0,
+    .voltageScale     = LL_PWR_REGU_VOLTAGE_SCALE3,
+    .apb1Prescaler    = LL_RCC_APB1_DIV_1
+  },
+  [SystemClockProfile_Pll42MHz] = {
+    .frequencyHz      = 42000000U,
+    .isPll            = 1,
+    .pllOutputDivider = LL_RCC_PLLP_DIV_8,
+    .flashLatency     = LL_FLASH_LATENCY_1,
+    .voltageScale     = LL_PWR_REGU_VOLTAGE_SCALE3,
+    .apb1Prescaler    = LL_RCC_APB1_DIV_1
+  },
+  [SystemClockProfile_Pll84MHz] = {
+    .frequencyHz      = 84000000U,
+    .isPll            = 1,
+    .pllOutputDivider = LL_RCC_PLLP_DIV_4,
+    .flashLatency     = LL_FLASH_LATENCY_2,
+    .voltageScale     = LL_PWR_REGU_VOLTAGE_SCALE2,
+    .apb1Prescaler    = LL_RCC_APB1_DIV_2
+  }
+};
+
+static volatile systemClockProfile_t currentProfile;
+static uint32_t switchesCount;
+static uint32_t busyPerMille;
+
+static uint32_t isGovernorStarted;
+static uint32_t governorCycles;
+static uint32_t governorIdleCycles;
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static void ApplyProfile(const systemClockProfileSettings_t *settings);
+static void EnableFlashCaches(void);
+static void SetFlashLatency(uint32_t flashLatency);
+static void StartPll(void);
+static void RederiveSysTick(uint32_t previousFrequencyHz);
+static uint32_t GetIdleTaskRunTimeCounter(void);
+static void RestartGovernorPeriod(void);
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+/* Called once at reset, the core starts on the 16 MHz HSI profile. */
+void SYSTEM_CLOCK_Config(void)
+{
+  LL_RCC_HSI_SetCalibTrimming(HSI_CALIBRATION_TRIMMING);
+  LL_RCC_HSI_Enable();
+  while(LL_RCC_HSI_IsReady() != 1) {
+    ;
+  }
+
+  LL_RCC_SetAHBPrescaler(LL_RCC_SYSCLK_DIV_1);
+  LL_RCC_SetAPB2Prescaler(LL_RCC_APB2_DIV_1);
+  LL_RCC_SetTIMPrescaler(LL_RCC_TIM_PRESCALER_TWICE);
+  EnableFlashCaches();
+
+  currentProfile = SystemClockProfile_Hsi16MHz;
+  ApplyProfile(&profilesSettings[currentProfile]);
+  LL_Init1msTick(SystemCoreClock);
+}
+
+
+
+/*
+  Called from one task at a time, the report task which runs the governor.
+  The USART1 frame being sent is finished first, then everything clocked
+  from the core and the APB buses is derived again with interrupts
+  disabled: SysTick, the TIM2 and TIM3 periods, the USART1 baud rate and
+  the ADC1 prescaler. Most of the time with interrupts disabled is spent
+  waiting for the PLL to lock. The governor measures a fresh period from
+  the switch.
+*/
+void SYSTEM_CLOCK_SetProfile(systemClockProfile_t profile)
+{
+  if(profile == currentProfile || profile >= SYSTEM_CLOCK_PROFILES_COUNT) {
+    return;
+  }
+
+  uint32_t previousFrequencyHz = SystemCoreClock;
+  DMA2_USART1_TX_Hold();
+
+  __disable_irq();
+  ApplyProfile(&profilesSettings[profile]);
+  currentProfile = profile;
+  ++switchesCount;
+
+  RederiveSysTick(previousFrequencyHz);
+  TIM2_ADC1_Trigger_UpdateClock();
+  TIM3_LED2_Pattern_UpdateClock();
+  USART1_UpdateBaudRate();
+  ADC1_TEMPERATURE_REGULATOR_UpdateClock();
+  TRACE_RECORDER_ClockSwitch(previousFrequencyHz / HZ_PER_MHZ,
+    SystemCoreClock / HZ_PER_MHZ);
+  __enable_irq();
+
+  DMA2_USART1_TX_Release();
+  RestartGovernorPeriod();
+}
+
+
+
+/*
+  Called by the report task once per governor period. The load is the share
+  of DWT cycles the RTOS idle task did not get, time asleep counts as idle
+  since the cycle counter is advanced over it. One profile step at most per
+  period.
+*/
+void SYSTEM_CLOCK_Governor_Update(void)
+{
+  uint32_t idleRunTimeCounter = GetIdleTaskRunTimeCounter();
+  uint32_t cycles = DWT_GetCycleCount();
+  uint32_t periodCycles = cycles - governorCycles;
+  uint32_t idleCycles = idleRunTimeCounter - governorIdleCycles;
+  governorCycles = cycles;
+  governorIdleCycles = idleRunTimeCounter;
+
+  if(isGovernorStarted == 0 || periodCycles == 0 ||
+    idleCycles > periodCycles) {
+    isGovernorStarted = 1;
+    return;
+  }
+
+  busyPerMille = 1000U -
+    (uint32_t)(((uint64_t)idleCycles * 1000U) / periodCycles);
+
+  systemClockProfile_t profile = currentProfile;
+  if(busyPerMille > GOVERNOR_SCALE_UP_BUSY_PER_MILLE &&
+    profile < SystemClockProfile_Pll84MHz) {
+    SYSTEM_CLOCK_SetProfile(profile + 1);
+  } else if(profile > SystemClockProfile_Hsi16MHz) {
+    uint32_t slowerBusyPerMille = (uint32_t)(((uint64_t)busyPerMille *
+      profilesSettings[profile].frequencyHz) /
+      profilesSettings[profile - 1].frequencyHz);
+    if(slowerBusyPerMille < GOVERNOR_SCALE_DOWN_BUSY_PER_MILLE) {
+      SYSTEM_CLOCK_SetProfile(profile - 1);
+    }
+  }
+}
+
+
+
+void SYSTEM_CLOCK_GetStatistics(systemClockStatistics_t *statistics)
+{
+  __disable_irq();
+  statistics->profile = currentProfile;
+  statistics->frequencyHz = SystemCoreClock;
+  statistics->switchesCount = switchesCount;
+  statistics->busyPerMille = busyPerMille;
+  __enable_irq();
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+/*
+  Goes through the HSI, since the PLL and the regulator scale can only be
+  changed with the PLL off. The flash latency is raised before the clock
+  and lowered after it, the APB1 prescaler is set while on the HSI so that
+  APB1 never runs above 42 MHz.
+*/
+static void ApplyProfile(const systemClockProfileSettings_t *settings)
+{
+  if(settings->flashLatency > LL_FLASH_GetLatency()) {
+    SetFlashLatency(settings->flashLatency);
+  }
+
+  LL_RCC_SetSysClkSource(LL_RCC_SYS_CLKSOURCE_HSI);
+  while(LL_RCC_GetSysClkSource() != LL_RCC_SYS_CLKSOURCE_STATUS_HSI) {
+    ;
+  }
+  LL_RCC_PLL_Disable();
+  while(LL_RCC_PLL_IsReady() != 0) {
+    ;
+  }
+
+  LL_PWR_SetRegulVoltageScaling(settings->voltageScale);
+  LL_RCC_SetAPB1Prescaler(settings->apb1Prescaler);
+
+  if(settings->isPll != 0) {
+    LL_RCC_PLL_ConfigDomain_SYS(LL_RCC_PLLSOURCE_HSI, PLL_INPUT_DIVIDER,
+      PLL_VCO_MULTIPLIER, settings->pllOutputDivider);
+    StartPll();
+  }
+
+  if(settings->flashLatency < LL_FLASH_GetLatency()) {
+    SetFlashLatency(settings->flashLatency);
+  }
+
+  if(settings->flashLatency != LL_FLASH_LATENCY_0) {
+    LL_FLASH_EnablePrefetch();
+  } else {
+    LL_FLASH_DisablePrefetch();
+  }
+
+  LL_SetSystemCoreClock(settings->frequencyHz);
+}
+
+
+
+/*
+  ART accelerator instruction and data caches, kept on in every profile.
+  They are reset while disabled, before being enabled.
+*/
+static void EnableFlashCaches(void)
+{
+  LL_FLASH_DisableInstCache();
+  LL_FLASH_DisableDataCache();
+  LL_FLASH_EnableInstCacheReset();
+  LL_FLASH_DisableInstCacheReset();
+  LL_FLASH_EnableDataCacheReset();
+  LL_FLASH_DisableDataCacheReset();
+
+  LL_FLASH_EnableInstCache();
+  LL_FLASH_EnableDataCache();
+}
+
+
+
+static void SetFlashLatency(uint32_t flashLatency)
+{
+  LL_FLASH_SetLatency(flashLatency);
+  while(LL_FLASH_GetLatency() != flashLatency) {
+    ;
+  }
+}
+
+
+
+/* The regulator only reaches the scale selected once the PLL is on. */
+static void StartPll(void)
+{
+  LL_RCC_PLL_Enable();
+  while(LL_RCC_PLL_IsReady() != 1) {
+    ;
+  }
+  while(LL_PWR_IsActiveFlag_VOS() != 1) {
+    ;
+  }
+
+  LL_RCC_SetSysClkSource(LL_RCC_SYS_CLKSOURCE_PLL);
+  while(LL_RCC_GetSysClkSource() != LL_RCC_SYS_CLKSOURCE_STATUS_PLL) {
+    ;
+  }
+}
+
+
+
+/*
+  The rest of the current tick is scaled to the new clock, the reload value
+  of a full tick is picked up by the counter when it ends, as the tickless
+  idle of low_power.c does after a sleep.
+*/
+static void RederiveSysTick(uint32_t previousFrequencyHz)
+{
+  uint32_t cyclesToNextTick = (uint32_t)(((uint64_t)SysTick->VAL *
+    SystemCoreClock) / previousFrequencyHz);
+
+  SysTick->LOAD = cyclesToNextTick > 1 ? cyclesToNextTick - 1 : 1;
+  SysTick->VAL = 0;
+  SysTick->LOAD = SystemCoreClock / configTICK_RATE_HZ - 1;
+}
+
+
+
+static uint32_t GetIdleTaskRunTimeCounter(void)
+{
+  TaskStatus_t idleTaskStatus;
+  vTaskGetInfo(xTaskGetIdleTaskHandle(), &idleTaskStatus, pdFALSE, eInvalid);
+
+  return idleTaskStatus.ulRunTimeCounter;
+}
+
+
+
+static void RestartGovernorPeriod(void)
+{
+  governorIdleCycles = GetIdleTaskRunTimeCounter();
+  governorCycles = DWT_GetCycleCount();
+}
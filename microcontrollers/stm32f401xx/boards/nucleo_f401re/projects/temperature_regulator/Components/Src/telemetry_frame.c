@@ -0,0 +1,540 @@
+#include "telemetry_frame.h"
+
+#include <string.h>
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define SYNC_OFFSET           0
+#define VERSION_OFFSET        1
+#define TYPE_OFFSET           2
+#define PAYLOAD_LENGTH_OFFSET 3
+#define PAYLOAD_OFFSET        TELEMETRY_FRAME_HEADER_SIZE
+
+#define READING_PAYLOAD_SIZE              11U
+#define FAULT_PAYLOAD_SIZE                5U
+#define CONVERSION_BENCHMARK_PAYLOAD_SIZE 10U
+#define AUTOTUNE_PAYLOAD_SIZE             21U
+#define LOW_POWER_PAYLOAD_SIZE            6U
+#define CLOCK_PAYLOAD_SIZE                10U
+#define CPU_TASK_PAYLOAD_SIZE             (TELEMETRY_FRAME_NAME_SIZE + 6U)
+#define FLASH_BENCHMARK_PAYLOAD_SIZE      13U
+#define COMMAND_ECHO_PAYLOAD_SIZE \
+  (TELEMETRY_FRAME_COMMAND_NAME_SIZE + 5U)
+#define TRACE_HEADER_PAYLOAD_SIZE         12U
+#define TRACE_NAME_PAYLOAD_SIZE           (TELEMETRY_FRAME_NAME_SIZE + 1U)
+#define TRACE_END_PAYLOAD_SIZE            0U
+#define SAMPLING_PAYLOAD_SIZE             28U
+#define TX_STATISTICS_PAYLOAD_SIZE        20U
+#define RX_STATISTICS_PAYLOAD_SIZE        28U
+#define COMMAND_STATISTICS_PAYLOAD_SIZE \
+  (TELEMETRY_FRAME_COMMAND_NAME_SIZE + 24U)
+
+#define CRC_POLYNOMIAL    0x1021U
+#define CRC_INITIAL_VALUE 0xFFFFU
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static uint8_t *EncodePayload(const telemetryMessage_t *message,
+  uint8_t *payload);
+static uint8_t *EncodeTraceRecords(const telemetryTraceRecords_t *trace,
+  uint8_t *payload);
+static int32_t IsPayloadLengthValid(uint8_t type, uint32_t length);
+static void DecodePayload(const uint8_t *payload, uint32_t length,
+  telemetryMessage_t *message);
+static void DecodeTraceRecords(const uint8_t *payload, uint32_t length,
+  telemetryTraceRecords_t *trace);
+static uint8_t *PutUint16(uint8_t *destination, uint16_t value);
+static uint8_t *PutUint32(uint8_t *destination, uint32_t value);
+static uint8_t *PutName(uint8_t *destination, const char *name,
+  uint32_t size);
+static uint16_t GetUint16(const uint8_t *source);
+static uint32_t GetUint32(const uint8_t *source);
+static void GetName(const uint8_t *source, char *name, uint32_t size);
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+/*
+  Fields are stored byte by byte, so the layout does not depend on the
+  endianness, alignment or structure packing of the compiler. Returns the
+  size of the frame.
+*/
+uint32_t TELEMETRY_FRAME_Encode(const telemetryMessage_t *message,
+  uint8_t frame[TELEMETRY_FRAME_SIZE_MAX])
+{
+  frame[SYNC_OFFSET] = TELEMETRY_FRAME_SYNC_BYTE;
+  frame[VERSION_OFFSET] = TELEMETRY_FRAME_VERSION;
+  frame[TYPE_OFFSET] = (uint8_t)message->type;
+
+  uint8_t *end = EncodePayload(message, &frame[PAYLOAD_OFFSET]);
+  uint32_t crcOffset = (uint32_t)(end - frame);
+  frame[PAYLOAD_LENGTH_OFFSET] = (uint8_t)(crcOffset - PAYLOAD_OFFSET);
+  PutUint16(end, TELEMETRY_FRAME_CalculateCrc(frame, crcOffset));
+
+  return crcOffset + TELEMETRY_FRAME_CRC_SIZE;
+}
+
+
+
+/*
+  Size of the whole frame from its header, 0 when the header cannot start
+  a frame of this version.
+*/
+uint32_t TELEMETRY_FRAME_GetSize(const uint8_t *header)
+{
+  if(header[SYNC_OFFSET] != TELEMETRY_FRAME_SYNC_BYTE ||
+    header[VERSION_OFFSET] != TELEMETRY_FRAME_VERSION ||
+    IsPayloadLengthValid(header[TYPE_OFFSET],
+    header[PAYLOAD_LENGTH_OFFSET]) == 0) {
+    return 0;
+  }
+
+  return TELEMETRY_FRAME_HEADER_SIZE + header[PAYLOAD_LENGTH_OFFSET] +
+    TELEMETRY_FRAME_CRC_SIZE;
+}
+
+
+
+/* Returns -1 for a wrong header, payload length or CRC. */
+int32_t TELEMETRY_FRAME_Decode(const uint8_t *frame, uint32_t size,
+  telemetryMessage_t *message)
+{
+  if(size < TELEMETRY_FRAME_HEADER_SIZE + TELEMETRY_FRAME_CRC_SIZE ||
+    TELEMETRY_FRAME_GetSize(frame) != size) {
+    return -1;
+  }
+
+  uint32_t crcOffset = size - TELEMETRY_FRAME_CRC_SIZE;
+  if(GetUint16(&frame[crcOffset]) !=
+    TELEMETRY_FRAME_CalculateCrc(frame, crcOffset)) {
+    return -1;
+  }
+
+  message->type = (telemetryFrameType_t)frame[TYPE_OFFSET];
+  DecodePayload(&frame[PAYLOAD_OFFSET], frame[PAYLOAD_LENGTH_OFFSET],
+    message);
+
+  return 0;
+}
+
+
+
+/* CRC-16/CCITT-FALSE, bitwise: 36 bytes do not justify a 512 byte table. */
+uint16_t TELEMETRY_FRAME_CalculateCrc(const uint8_t *data, uint32_t length)
+{
+  uint16_t crc = CRC_INITIAL_VALUE;
+
+  for(uint32_t byte = 0; byte < length; ++byte) {
+    crc ^= (uint16_t)(data[byte] << 8);
+    for(uint32_t bit = 0; bit < 8; ++bit) {
+      if((crc & 0x8000U) != 0) {
+        crc = (uint16_t)((crc << 1) ^ CRC_POLYNOMIAL);
+      } else {
+        crc = (uint16_t)(crc << 1);
+      }
+    }
+  }
+
+  return crc;
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+/* Returns the end of the payload, the layouts are in telemetry_frame.h. */
+static uint8_t *EncodePayload(const telemetryMessage_t *message,
+  uint8_t *payload)
+{
+  uint8_t *end = payload;
+
+  switch(message->type) {
+    case TelemetryFrame_Reading:
+      end = PutUint16(end, message->sample.sequence);
+      *end++ = message->sample.flags;
+      end = PutUint16(end, message->sample.adcCode);
+      end = PutUint16(end, (uint16_t)message->sample.temperature);
+      end = PutUint32(end, message->sample.timeInSeconds);
+      break;
+    case TelemetryFrame_Fault:
+      *end++ = message->fault.fault;
+      end = PutUint32(end, message->fault.timeInSeconds);
+      break;
+    case TelemetryFrame_ConversionBenchmark:
+      end = PutUint32(end,
+        message->conversionBenchmark.fixedPointCyclesPerSample);
+      end = PutUint32(end, message->conversionBenchmark.floatCyclesPerSample);
+      *end++ = message->conversionBenchmark.isHardwareFpuUsed;
+      *end++ = message->conversionBenchmark.isLazyStackingEnabled;
+      break;
+    case TelemetryFrame_Autotune:
+      *end++ = message->autotune.isFinished;
+      end = PutUint32(end, (uint32_t)message->autotune.ultimateGain);
+      end = PutUint32(end, message->autotune.ultimatePeriodMs);
+      end = PutUint32(end, (uint32_t)message->autotune.proportionalGain);
+      end = PutUint32(end, (uint32_t)message->autotune.integralGain);
+      end = PutUint32(end, (uint32_t)message->autotune.derivativeGain);
+      break;
+    case TelemetryFrame_LowPower:
+      end = PutUint16(end, message->lowPower.sleepPerMille);
+      end = PutUint32(end, message->lowPower.wakeupsCount);
+      break;
+    case TelemetryFrame_Clock:
+      end = PutUint32(end, message->clock.frequencyHz);
+      end = PutUint32(end, message->clock.switchesCount);
+      end = PutUint16(end, message->clock.busyPerMille);
+      break;
+    case TelemetryFrame_CpuTask:
+      end = PutName(end, message->cpuTask.name, TELEMETRY_FRAME_NAME_SIZE);
+      end = PutUint16(end, message->cpuTask.cpuPerMille);
+      end = PutUint32(end, message->cpuTask.maxActivationUs);
+      break;
+    case TelemetryFrame_FlashBenchmark:
+      end = PutUint32(end, message->flashBenchmark.frequencyHz);
+      *end++ = message->flashBenchmark.waitStatesCount;
+      end = PutUint32(end,
+        message->flashBenchmark.acceleratorOffCentiCycles);
+      end = PutUint32(end, message->flashBenchmark.acceleratorOnCentiCycles);
+      break;
+    case TelemetryFrame_CommandEcho:
+      end = PutName(end, message->commandEcho.name,
+        TELEMETRY_FRAME_COMMAND_NAME_SIZE);
+      *end++ = message->commandEcho.isRejected;
+      end = PutUint32(end, message->commandEcho.timeInSeconds);
+      break;
+    case TelemetryFrame_TraceHeader:
+      end = PutUint32(end, message->traceHeader.recordsCount);
+      end = PutUint32(end, message->traceHeader.overwrittenCount);
+      end = PutUint32(end, message->traceHeader.cyclesPerSecond);
+      break;
+    case TelemetryFrame_TraceTask:
+    case TelemetryFrame_TraceQueue:
+      *end++ = message->traceName.number;
+      end = PutName(end, message->traceName.name, TELEMETRY_FRAME_NAME_SIZE);
+      break;
+    case TelemetryFrame_TraceRecords:
+      end = EncodeTraceRecords(&message->traceRecords, end);
+      break;
+    case TelemetryFrame_Sampling:
+      end = PutUint32(end, message->sampling.readingsCount);
+      end = PutUint32(end, message->sampling.expectedPeriodCycles);
+      end = PutUint32(end, message->sampling.lastPeriodCycles);
+      end = PutUint32(end, message->sampling.minPeriodCycles);
+      end = PutUint32(end, message->sampling.maxPeriodCycles);
+      end = PutUint32(end, message->sampling.maxJitterCycles);
+      end = PutUint32(end, message->sampling.cyclesPerSecond);
+      break;
+    case TelemetryFrame_TxStatistics:
+      end = PutUint32(end, message->txStatistics.queuedFramesCount);
+      end = PutUint32(end, message->txStatistics.overflowFramesCount);
+      end = PutUint32(end, message->txStatistics.droppedFramesCount);
+      end = PutUint32(end, message->txStatistics.transfersCount);
+      end = PutUint32(end, message->txStatistics.maxQueuedBytesCount);
+      break;
+    case TelemetryFrame_RxStatistics:
+      end = PutUint32(end, message->rxStatistics.receivedFramesCount);
+      end = PutUint32(end, message->rxStatistics.formatErrorsCount);
+      end = PutUint32(end, message->rxStatistics.crcErrorsCount);
+      end = PutUint32(end, message->rxStatistics.unknownCommandsCount);
+      end = PutUint32(end, message->rxStatistics.overrunsCount);
+      end = PutUint32(end, message->rxStatistics.lostBytesCount);
+      end = PutUint32(end, message->rxStatistics.maxPendingBytesCount);
+      break;
+    case TelemetryFrame_CommandStatistics:
+      end = PutName(end, message->commandStatistics.name,
+        TELEMETRY_FRAME_COMMAND_NAME_SIZE);
+      end = PutUint32(end, message->commandStatistics.dispatchedCount);
+      end = PutUint32(end, message->commandStatistics.rejectedCount);
+      end = PutUint32(end, message->commandStatistics.droppedCount);
+      end = PutUint32(end, message->commandStatistics.lastLatencyCycles);
+      end = PutUint32(end, message->commandStatistics.maxLatencyCycles);
+      end = PutUint32(end, message->commandStatistics.cyclesPerSecond);
+      break;
+    default:
+      break;
+  }
+
+  return end;
+}
+
+
+
+static uint8_t *EncodeTraceRecords(const telemetryTraceRecords_t *trace,
+  uint8_t *payload)
+{
+  uint32_t recordsCount = trace->recordsCount;
+  if(recordsCount > TELEMETRY_FRAME_TRACE_RECORDS_MAX) {
+    recordsCount = TELEMETRY_FRAME_TRACE_RECORDS_MAX;
+  }
+
+  for(uint32_t record = 0; record < recordsCount; ++record) {
+    payload = PutUint32(payload, trace->records[record].cycles);
+    *payload++ = trace->records[record].event;
+    *payload++ = trace->records[record].object;
+    payload = PutUint16(payload, trace->records[record].data);
+  }
+
+  return payload;
+}
+
+
+
+static int32_t IsPayloadLengthValid(uint8_t type, uint32_t length)
+{
+  switch(type) {
+    case TelemetryFrame_Reading:
+      return length == READING_PAYLOAD_SIZE;
+    case TelemetryFrame_Fault:
+      return length == FAULT_PAYLOAD_SIZE;
+    case TelemetryFrame_ConversionBenchmark:
+      return length == CONVERSION_BENCHMARK_PAYLOAD_SIZE;
+    case TelemetryFrame_Autotune:
+      return length == AUTOTUNE_PAYLOAD_SIZE;
+    case TelemetryFrame_LowPower:
+      return length == LOW_POWER_PAYLOAD_SIZE;
+    case TelemetryFrame_Clock:
+      return length == CLOCK_PAYLOAD_SIZE;
+    case TelemetryFrame_CpuTask:
+      return length == CPU_TASK_PAYLOAD_SIZE;
+    case TelemetryFrame_FlashBenchmark:
+      return length == FLASH_BENCHMARK_PAYLOAD_SIZE;
+    case TelemetryFrame_CommandEcho:
+      return length == COMMAND_ECHO_PAYLOAD_SIZE;
+    case TelemetryFrame_TraceHeader:
+      return length == TRACE_HEADER_PAYLOAD_SIZE;
+    case TelemetryFrame_TraceTask:
+    case TelemetryFrame_TraceQueue:
+      return length == TRACE_NAME_PAYLOAD_SIZE;
+    case TelemetryFrame_TraceRecords:
+      return length != 0 && length <= TELEMETRY_FRAME_PAYLOAD_SIZE_MAX &&
+        length % TELEMETRY_FRAME_TRACE_RECORD_SIZE == 0;
+    case TelemetryFrame_TraceEnd:
+      return length == TRACE_END_PAYLOAD_SIZE;
+    case TelemetryFrame_Sampling:
+      return length == SAMPLING_PAYLOAD_SIZE;
+    case TelemetryFrame_TxStatistics:
+      return length == TX_STATISTICS_PAYLOAD_SIZE;
+    case TelemetryFrame_RxStatistics:
+      return length == RX_STATISTICS_PAYLOAD_SIZE;
+    case TelemetryFrame_CommandStatistics:
+      return length == COMMAND_STATISTICS_PAYLOAD_SIZE;
+    default:
+      return 0;
+  }
+}
+
+
+
+/* The length has been checked against the type. */
+static void DecodePayload(const uint8_t *payload, uint32_t length,
+  telemetryMessage_t *message)
+{
+  switch(message->type) {
+    case TelemetryFrame_Reading:
+      message->sample.sequence = GetUint16(&payload[0]);
+      message->sample.flags = payload[2];
+      message->sample.adcCode = GetUint16(&payload[3]);
+      message->sample.temperature = (int16_t)GetUint16(&payload[5]);
+      message->sample.timeInSeconds = GetUint32(&payload[7]);
+      break;
+    case TelemetryFrame_Fault:
+      message->fault.fault = payload[0];
+      message->fault.timeInSeconds = GetUint32(&payload[1]);
+      break;
+    case TelemetryFrame_ConversionBenchmark:
+      message->conversionBenchmark.fixedPointCyclesPerSample =
+        GetUint32(&payload[0]);
+      message->conversionBenchmark.floatCyclesPerSample =
+        GetUint32(&payload[4]);
+      message->conversionBenchmark.isHardwareFpuUsed = payload[8];
+      message->conversionBenchmark.isLazyStackingEnabled = payload[9];
+      break;
+    case TelemetryFrame_Autotune:
+      message->autotune.isFinished = payload[0];
+      message->autotune.ultimateGain = (int32_t)GetUint32(&payload[1]);
+      message->autotune.ultimatePeriodMs = GetUint32(&payload[5]);
+      message->autotune.proportionalGain = (int32_t)GetUint32(&payload[9]);
+      message->autotune.integralGain = (int32_t)GetUint32(&payload[13]);
+      message->autotune.derivativeGain = (int32_t)GetUint32(&payload[17]);
+      break;
+    case TelemetryFrame_LowPower:
+      message->lowPower.sleepPerMille = GetUint16(&payload[0]);
+      message->lowPower.wakeupsCount = GetUint32(&payload[2]);
+      break;
+    case TelemetryFrame_Clock:
+      message->clock.frequencyHz = GetUint32(&payload[0]);
+      message->clock.switchesCount = GetUint32(&payload[4]);
+      message->clock.busyPerMille = GetUint16(&payload[8]);
+      break;
+    case TelemetryFrame_CpuTask:
+      GetName(&payload[0], message->cpuTask.name, TELEMETRY_FRAME_NAME_SIZE);
+      message->cpuTask.cpuPerMille =
+        GetUint16(&payload[TELEMETRY_FRAME_NAME_SIZE]);
+      message->cpuTask.maxActivationUs =
+        GetUint32(&payload[TELEMETRY_FRAME_NAME_SIZE + 2]);
+      break;
+    case TelemetryFrame_FlashBenchmark:
+      message->flashBenchmark.frequencyHz = GetUint32(&payload[0]);
+      message->flashBenchmark.waitStatesCount = payload[4];
+      message->flashBenchmark.acceleratorOffCentiCycles =
+        GetUint32(&payload[5]);
+      message->flashBenchmark.acceleratorOnCentiCycles =
+        GetUint32(&payload[9]);
+      break;
+    case TelemetryFrame_CommandEcho:
+      GetName(&payload[0], message->commandEcho.name,
+        TELEMETRY_FRAME_COMMAND_NAME_SIZE);
+      message->commandEcho.isRejected =
+        payload[TELEMETRY_FRAME_COMMAND_NAME_SIZE];
+      message->commandEcho.timeInSeconds =
+        GetUint32(&payload[TELEMETRY_FRAME_COMMAND_NAME_SIZE + 1]);
+      break;
+    case TelemetryFrame_TraceHeader:
+      message->traceHeader.recordsCount = GetUint32(&payload[0]);
+      message->traceHeader.overwrittenCount = GetUint32(&payload[4]);
+      message->traceHeader.cyclesPerSecond = GetUint32(&payload[8]);
+      break;
+    case TelemetryFrame_TraceTask:
+    case TelemetryFrame_TraceQueue:
+      message->traceName.number = payload[0];
+      GetName(&payload[1], message->traceName.name,
+        TELEMETRY_FRAME_NAME_SIZE);
+      break;
+    case TelemetryFrame_TraceRecords:
+      DecodeTraceRecords(payload, length, &message->traceRecords);
+      break;
+    case TelemetryFrame_Sampling:
+      message->sampling.readingsCount = GetUint32(&payload[0]);
+      message->sampling.expectedPeriodCycles = GetUint32(&payload[4]);
+      message->sampling.lastPeriodCycles = GetUint32(&payload[8]);
+      message->sampling.minPeriodCycles = GetUint32(&payload[12]);
+      message->sampling.maxPeriodCycles = GetUint32(&payload[16]);
+      message->sampling.maxJitterCycles = GetUint32(&payload[20]);
+      message->sampling.cyclesPerSecond = GetUint32(&payload[24]);
+      break;
+    case TelemetryFrame_TxStatistics:
+      message->txStatistics.queuedFramesCount = GetUint32(&payload[0]);
+      message->txStatistics.overflowFramesCount = GetUint32(&payload[4]);
+      message->txStatistics.droppedFramesCount = GetUint32(&payload[8]);
+      message->txStatistics.transfersCount = GetUint32(&payload[12]);
+      message->txStatistics.maxQueuedBytesCount = GetUint32(&payload[16]);
+      break;
+    case TelemetryFrame_RxStatistics:
+      message->rxStatistics.receivedFramesCount = GetUint32(&payload[0]);
+      message->rxStatistics.formatErrorsCount = GetUint32(&payload[4]);
+      message->rxStatistics.crcErrorsCount = GetUint32(&payload[8]);
+      message->rxStatistics.unknownCommandsCount = GetUint32(&payload[12]);
+      message->rxStatistics.overrunsCount = GetUint32(&payload[16]);
+      message->rxStatistics.lostBytesCount = GetUint32(&payload[20]);
+      message->rxStatistics.maxPendingBytesCount = GetUint32(&payload[24]);
+      break;
+    case TelemetryFrame_CommandStatistics:
+      GetName(&payload[0], message->commandStatistics.name,
+        TELEMETRY_FRAME_COMMAND_NAME_SIZE);
+      message->commandStatistics.dispatchedCount =
+        GetUint32(&payload[TELEMETRY_FRAME_COMMAND_NAME_SIZE]);
+      message->commandStatistics.rejectedCount =
+        GetUint32(&payload[TELEMETRY_FRAME_COMMAND_NAME_SIZE + 4]);
+      message->commandStatistics.droppedCount =
+        GetUint32(&payload[TELEMETRY_FRAME_COMMAND_NAME_SIZE + 8]);
+      message->commandStatistics.lastLatencyCycles =
+        GetUint32(&payload[TELEMETRY_FRAME_COMMAND_NAME_SIZE + 12]);
+      message->commandStatistics.maxLatencyCycles =
+        GetUint32(&payload[TELEMETRY_FRAME_COMMAND_NAME_SIZE + 16]);
+      message->commandStatistics.cyclesPerSecond =
+        GetUint32(&payload[TELEMETRY_FRAME_COMMAND_NAME_SIZE + 20]);
+      break;
+    default:
+      break;
+  }
+}
+
+
+
+static void DecodeTraceRecords(const uint8_t *payload, uint32_t length,
+  telemetryTraceRecords_t *trace)
+{
+  trace->recordsCount =
+    (uint8_t)(length / TELEMETRY_FRAME_TRACE_RECORD_SIZE);
+
+  for(uint32_t record = 0; record < trace->recordsCount; ++record) {
+    const uint8_t *source =
+      &payload[record * TELEMETRY_FRAME_TRACE_RECORD_SIZE];
+    trace->records[record].cycles = GetUint32(&source[0]);
+    trace->records[record].event = source[4];
+    trace->records[record].object = source[5];
+    trace->records[record].data = GetUint16(&source[6]);
+  }
+}
+
+
+
+static uint8_t *PutUint16(uint8_t *destination, uint16_t value)
+{
+  destination[0] = (uint8_t)value;
+  destination[1] = (uint8_t)(value >> 8);
+
+  return destination + 2;
+}
+
+
+
+static uint8_t *PutUint32(uint8_t *destination, uint32_t value)
+{
+  destination[0] = (uint8_t)value;
+  destination[1] = (uint8_t)(value >> 8);
+  destination[2] = (uint8_t)(value >> 16);
+  destination[3] = (uint8_t)(value >> 24);
+
+  return destination + 4;
+}
+
+
+
+/* Longer names are cut, shorter ones padded with NULs. */
+static uint8_t *PutName(uint8_t *destination, const char *name,
+  uint32_t size)
+{
+  uint32_t length = (uint32_t)strnlen(name, size);
+  memcpy(destination, name, length);
+  memset(&destination[length], 0, size - length);
+
+  return destination + size;
+}
+
+
+
+static uint16_t GetUint16(const uint8_t *source)
+{
+  return (uint16_t)(source[0] | (source[1] << 8));
+}
+
+
+
+static uint32_t GetUint32(const uint8_t *source)
+{
+  return (uint32_t)source[0] | ((uint32_t)source[1] << 8) |
+    ((uint32_t)source[2] << 16) | ((uint32_t)source[3] << 24);
+}
+
+
+
+/* A name filling the whole field is not NUL terminated on the line. */
+static void GetName(const uint8_t *source, char *name, uint32_t size)
+{
+  memcpy(name, source, size);
+  name[size] = '\0';
+}
@@ -0,0 +1,82 @@
+#include "adc_oversampling.h"
+#include "relay_window.h"
+#include "temperature_control.h"
+#include "temperature_conversion.h"
+#include "thermistor_lookup_table.h"
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+/*
+  Starting point for an oven with a time constant of tens of minutes:
+  20 % of heater power per degree of error, 10 minutes integral time,
+  1 minute derivative time filtered over about 16 readings.
+*/
+#define PID_PROPORTIONAL_GAIN_DEFAULT  PID_GAIN_FROM_PER_MILLE(200)
+#define PID_INTEGRAL_GAIN_DEFAULT      (PID_PROPORTIONAL_GAIN_DEFAULT / 600)
+#define PID_DERIVATIVE_GAIN_DEFAULT    (PID_PROPORTIONAL_GAIN_DEFAULT * 60)
+#define PID_DERIVATIVE_FILTER_SHIFT_DEFAULT 4
+
+
+
+/*****************************************************************************/
+/*                             PRIVATE MACROS                                */
+/*****************************************************************************/
+
+#define PID_GAIN_FROM_PER_MILLE(perMille) \
+  ((perMille) * (1 << PID_CONTROLLER_FRACTIONAL_BITS))
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+/*
+  The control step of the regulator task without any hardware access, so
+  the host simulation runs the very same code against a plant model.
+*/
+void TEMPERATURE_CONTROL_Init(temperatureControl_t *control, int32_t setPoint,
+  uint32_t samplePeriodMs)
+{
+  const pidSettings_t pidSettings = {
+    .proportionalGain      = PID_PROPORTIONAL_GAIN_DEFAULT,
+    .integralGain          = PID_INTEGRAL_GAIN_DEFAULT,
+    .derivativeGain        = PID_DERIVATIVE_GAIN_DEFAULT,
+    .derivativeFilterShift = PID_DERIVATIVE_FILTER_SHIFT_DEFAULT
+  };
+  PID_CONTROLLER_Init(&control->pid, &pidSettings, samplePeriodMs, 0,
+    RELAY_WINDOW_DUTY_MAX);
+
+  control->setPoint = setPoint;
+  control->temperature = 0;
+}
+
+
+
+/* Readings outside the thermistor range mean an open or shorted sensor. */
+int32_t TEMPERATURE_CONTROL_IsReadingValid(uint32_t filteredReading)
+{
+  uint32_t adcMeasurement = ADC_OVERSAMPLING_TO_ADC_CODE(filteredReading);
+
+  return adcMeasurement >= ADC_MEASUREMENT_MIN &&
+    adcMeasurement <= ADC_MEASUREMENT_MAX;
+}
+
+
+
+/*
+  Returns the heater duty in per mille for one filtered reading, which has to
+  pass TEMPERATURE_CONTROL_IsReadingValid first.
+*/
+int32_t TEMPERATURE_CONTROL_Update(temperatureControl_t *control,
+  uint32_t filteredReading)
+{
+  control->temperature =
+    TEMPERATURE_CONVERSION_ReadingToTemperature(filteredReading);
+  return PID_CONTROLLER_Update(&control->pid, control->setPoint,
+    control->temperature);
+}
@@ -0,0 +1,28 @@
+#include "adc_oversampling.h"
+#include "temperature_conversion.h"
+#include "thermistor_lookup_table.h"
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+/*
+  Linear interpolation between the lookup table entries of two neighbouring
+  ADC codes, weighted by the fractional bits of the oversampled reading.
+  Integer only, the caller guarantees the code is within the valid range.
+*/
+int32_t TEMPERATURE_CONVERSION_ReadingToTemperature(uint32_t filteredReading)
+{
+  const uint32_t fractionMask = (1U << ADC_OVERSAMPLING_EXTRA_BITS) - 1;
+
+  uint32_t adcCode = ADC_OVERSAMPLING_TO_ADC_CODE(filteredReading);
+  int32_t fraction = (int32_t)(filteredReading & fractionMask);
+
+  int32_t lowerTemperature = thermistorLookupTable[adcCode];
+  int32_t upperTemperature = thermistorLookupTable[adcCode + 1];
+
+  return lowerTemperature + (((upperTemperature - lowerTemperature) *
+    fraction) >> ADC_OVERSAMPLING_EXTRA_BITS);
+}
@@ -0,0 +1,523 @@
+/*
+  Generated by Tools/thermistor_lookup_table_generator.c.
+  Do not edit by hand, regenerate instead.
+*/
+
+#include "thermistor_lookup_table.h"
+
+
+
+const int16_t thermistorLookupTable[THERMISTOR_LOOKUP_TABLE_SIZE] = {
+  -7654, -7654, -7654, -7654, -7654, -7654, -7654, -7654,
+  -7654, -7654, -7654, -7654, -7654, -7654, -7654, -7654,
+  -7654, -7654, -7654, -7654, -7654, -7654, -7654, -7654,
+  -7654, -7654, -7654, -7654, -7654, -7654, -7654, -7654,
+  -7654, -7654, -7654, -7654, -7654, -7654, -7654, -7654,
+  -7654, -7654, -7654, -7654, -7654, -7654, -7654, -7654,
+  -7654, -7654, -7654, -7654, -7654, -7654, -7654, -7654,
+  -7654, -7654, -7654, -7654, -7654, -7654, -7654, -7654,
+  -7654, -7654, -7654, -7654, -7654, -7654, -7654, -7654,
+  -7654, -7654, -7654, -7654, -7654, -7654, -7654, -7654,
+  -7654, -7654, -7654, -7654, -7654, -7654, -7654, -7654,
+  -7654, -7654, -7654, -7654, -7654, -7654, -7654, -7654,
+  -7654, -7654, -7654, -7654, -7654, -7654, -7654, -7654,
+  -7654, -7654, -7654, -7654, -7654, -7654, -7654, -7654,
+  -7654, -7654, -7654, -7654, -7654, -7654, -7654, -7654,
+  -7654, -7654, -7654, -7654, -7654, -7654, -7654, -7654,
+  -7654, -7654, -7654, -7654, -7654, -7654, -7654, -7654,
+  -7654, -7654, -7654, -7654, -7654, -7654, -7654, -7654,
+  -7654, -7654, -7654, -7654, -7654, -7654, -7654, -7654,
+  -7654, -7654, -7654, -7654, -7654, -7654, -7654, -7654,
+  -7654, -7654, -7654, -7654, -7654, -7654, -7654, -7654,
+  -7654, -7654, -7654, -7654, -7654, -7654, -7654, -7654,
+  -7654, -7654, -7654, -7654, -7654, -7654, -7654, -7654,
+  -7654, -7654, -7654, -7654, -7654, -7654, -7654, -7654,
+  -7654, -7654, -7654, -7654, -7654, -7654, -7654, -7654,
+  -7654, -7654, -7654, -7629, -7603, -7578, -7578, -7552,
+  -7526, -7501, -7475, -7475, -7450, -7424, -7398, -7398,
+  -7373, -7347, -7322, -7322, -7296, -7270, -7245, -7245,
+  -7219, -7194, -7168, -7168, -7142, -7117, -7091, -7091,
+  -7066, -7040, -7014, -7014, -6989, -6963, -6963, -6938,
+  -6912, -6912, -6886, -6861, -6835, -6835, -6810, -6784,
+  -6784, -6758, -6733, -6733, -6707, -6682, -6682, -6656,
+  -6630, -6630, -6605, -6579, -6579, -6554, -6528, -6528,
+  -6502, -6477, -6477, -6451, -6426, -6426, -6400, -6400,
+  -6374, -6349, -6349, -6323, -6298, -6298, -6272, -6246,
+  -6246, -6221, -6221, -6195, -6170, -6170, -6144, -6144,
+  -6118, -6093, -6093, -6067, -6042, -6042, -6016, -6016,
+  -5990, -5965, -5965, -5939, -5939, -5914, -5914, -5888,
+  -5862, -5862, -5837, -5837, -5811, -5786, -5786, -5760,
+  -5760, -5734, -5734, -5709, -5683, -5683, -5658, -5658,
+  -5632, -5632, -5606, -5606, -5581, -5555, -5555, -5530,
+  -5530, -5504, -5504, -5478, -5478, -5453, -5453, -5427,
+  -5402, -5402, -5376, -5376, -5350, -5350, -5325, -5325,
+  -5299, -5299, -5274, -5274, -5248, -5248, -5222, -5197,
+  -5197, -5171, -5171, -5146, -5146, -5120, -5120, -5094,
+  -5094, -5069, -5069, -5043, -5043, -5018, -5018, -4992,
+  -4992, -4966, -4966, -4941, -4941, -4915, -4915, -4890,
+  -4890, -4864, -4864, -4838, -4838, -4813, -4813, -4787,
+  -4787, -4762, -4762, -4736, -4736, -4736, -4710, -4710,
+  -4685, -4685, -4659, -4659, -4634, -4634, -4608, -4608,
+  -4582, -4582, -4557, -4557, -4531, -4531, -4531, -4506,
+  -4506, -4480, -4480, -4454, -4454, -4429, -4429, -4403,
+  -4403, -4378, -4378, -4378, -4352, -4352, -4326, -4326,
+  -4301, -4301, -4275, -4275, -4275, -4250, -4250, -4224,
+  -4224, -4198, -4198, -4173, -4173, -4173, -4147, -4147,
+  -4122, -4122, -4096, -4096, -4096, -4070, -4070, -4045,
+  -4045, -4019, -4019, -3994, -3994, -3994, -3968, -3968,
+  -3942, -3942, -3917, -3917, -3917, -3891, -3891, -3866,
+  -3866, -3866, -3840, -3840, -3814, -3814, -3789, -3789,
+  -3789, -3763, -3763, -3738, -3738, -3738, -3712, -3712,
+  -3686, -3686, -3661, -3661, -3661, -3635, -3635, -3610,
+  -3610, -3610, -3584, -3584, -3584, -3558, -3558, -3533,
+  -3533, -3507, -3507, -3507, -3482, -3482, -3456, -3456,
+  -3456, -3430, -3430, -3405, -3405, -3405, -3379, -3379,
+  -3379, -3354, -3354, -3328, -3328, -3328, -3302, -3302,
+  -3277, -3277, -3277, -3251, -3251, -3251, -3226, -3226,
+  -3200, -3200, -3200, -3174, -3174, -3149, -3149, -3149,
+  -3123, -3123, -3123, -3098, -3098, -3098, -3072, -3072,
+  -3046, -3046, -3046, -3021, -3021, -3021, -2995, -2995,
+  -2970, -2970, -2970, -2944, -2944, -2944, -2918, -2918,
+  -2893, -2893, -2893, -2867, -2867, -2867, -2842, -2842,
+  -2842, -2816, -2816, -2816, -2790, -2790, -2765, -2765,
+  -2765, -2739, -2739, -2739, -2714, -2714, -2714, -2688,
+  -2688, -2662, -2662, -2662, -2637, -2637, -2637, -2611,
+  -2611, -2611, -2586, -2586, -2586, -2560, -2560, -2560,
+  -2534, -2534, -2534, -2509, -2509, -2483, -2483, -2483,
+  -2458, -2458, -2458, -2432, -2432, -2432, -2406, -2406,
+  -2406, -2381, -2381, -2381, -2355, -2355, -2355, -2330,
+  -2330, -2330, -2304, -2304, -2304, -2278, -2278, -2278,
+  -2253, -2253, -2253, -2227, -2227, -2227, -2202, -2202,
+  -2202, -2176, -2176, -2176, -2150, -2150, -2150, -2125,
+  -2125, -2125, -2099, -2099, -2099, -2074, -2074, -2074,
+  -2048, -2048, -2048, -2022, -2022, -2022, -1997, -1997,
+  -1997, -1971, -1971, -1971, -1946, -1946, -1946, -1920,
+  -1920, -1920, -1894, -1894, -1894, -1869, -1869, -1869,
+  -1869, -1843, -1843, -1843, -1818, -1818, -1818, -1792,
+  -1792, -1792, -1766, -1766, -1766, -1741, -1741, -1741,
+  -1715, -1715, -1715, -1715, -1690, -1690, -1690, -1664,
+  -1664, -1664, -1638, -1638, -1638, -1613, -1613, -1613,
+  -1587, -1587, -1587, -1587, -1562, -1562, -1562, -1536,
+  -1536, -1536, -1510, -1510, -1510, -1510, -1485, -1485,
+  -1485, -1459, -1459, -1459, -1434, -1434, -1434, -1408,
+  -1408, -1408, -1408, -1382, -1382, -1382, -1357, -1357,
+  -1357, -1331, -1331, -1331, -1331, -1306, -1306, -1306,
+  -1280, -1280, -1280, -1254, -1254, -1254, -1254, -1229,
+  -1229, -1229, -1203, -1203, -1203, -1178, -1178, -1178,
+  -1178, -1152, -1152, -1152, -1126, -1126, -1126, -1101,
+  -1101, -1101, -1101, -1075, -1075, -1075, -1050, -1050,
+  -1050, -1050, -1024, -1024, -1024,  -998,  -998,  -998,
+   -998,  -973,  -973,  -973,  -947,  -947,  -947,  -947,
+   -922,  -922,  -922,  -896,  -896,  -896,  -896,  -870,
+   -870,  -870,  -845,  -845,  -845,  -845,  -819,  -819,
+   -819,  -794,  -794,  -794,  -794,  -768,  -768,  -768,
+   -742,  -742,  -742,  -742,  -717,  -717,  -717,  -691,
+   -691,  -691,  -691,  -666,  -666,  -666,  -640,  -640,
+   -640,  -640,  -614,  -614,  -614,  -589,  -589,  -589,
+   -589,  -563,  -563,  -563,  -563,  -538,  -538,  -538,
+   -512,  -512,  -512,  -512,  -486,  -486,  -486,  -486,
+   -461,  -461,  -461,  -435,  -435,  -435,  -435,  -410,
+   -410,  -410,  -410,  -384,  -384,  -384,  -358,  -358,
+   -358,  -358,  -333,  -333,  -333,  -333,  -307,  -307,
+   -307,  -282,  -282,  -282,  -282,  -256,  -256,  -256,
+   -256,  -230,  -230,  -230,  -230,  -205,  -205,  -205,
+   -179,  -179,  -179,  -179,  -154,  -154,  -154,  -154,
+   -128,  -128,  -128,  -128,  -102,  -102,  -102,  -102,
+    -77,   -77,   -77,   -77,   -51,   -51,   -51,   -26,
+    -26,   -26,   -26,     0,     0,     0,     0,    26,
+     26,    26,    26,    51,    51,    51,    51,    77,
+     77,    77,   102,   102,   102,   102,   128,   128,
+    128,   128,   154,   154,   154,   154,   179,   179,
+    179,   205,   205,   205,   205,   230,   230,   230,
+    230,   256,   256,   256,   256,   282,   282,   282,
+    282,   307,   307,   307,   307,   333,   333,   333,
+    358,   358,   358,   358,   384,   384,   384,   384,
+    410,   410,   410,   410,   435,   435,   435,   435,
+    461,   461,   461,   461,   486,   486,   486,   486,
+    512,   512,   512,   512,   538,   538,   538,   538,
+    563,   563,   563,   563,   589,   589,   589,   589,
+    614,   614,   614,   614,   640,   640,   640,   640,
+    666,   666,   666,   666,   691,   691,   691,   691,
+    717,   717,   717,   717,   742,   742,   742,   742,
+    768,   768,   768,   768,   794,   794,   794,   794,
+    819,   819,   819,   819,   845,   845,   845,   845,
+    870,   870,   870,   870,   896,   896,   896,   896,
+    922,   922,   922,   922,   947,   947,   947,   947,
+    973,   973,   973,   973,   973,   998,   998,   998,
+    998,  1024,  1024,  1024,  1024,  1050,  1050,  1050,
+   1050,  1075,  1075,  1075,  1075,  1101,  1101,  1101,
+   1101,  1126,  1126,  1126,  1126,  1152,  1152,  1152,
+   1152,  1152,  1178,  1178,  1178,  1178,  1203,  1203,
+   1203,  1203,  1229,  1229,  1229,  1229,  1254,  1254,
+   1254,  1254,  1280,  1280,  1280,  1280,  1280,  1306,
+   1306,  1306,  1306,  1331,  1331,  1331,  1331,  1357,
+   1357,  1357,  1357,  1382,  1382,  1382,  1382,  1408,
+   1408,  1408,  1408,  1434,  1434,  1434,  1434,  1434,
+   1459,  1459,  1459,  1459,  1485,  1485,  1485,  1485,
+   1510,  1510,  1510,  1510,  1536,  1536,  1536,  1536,
+   1536,  1562,  1562,  1562,  1562,  1587,  1587,  1587,
+   1587,  1613,  1613,  1613,  1613,  1638,  1638,  1638,
+   1638,  1638,  1664,  1664,  1664,  1664,  1690,  1690,
+   1690,  1690,  1715,  1715,  1715,  1715,  1715,  1741,
+   1741,  1741,  1741,  1766,  1766,  1766,  1766,  1792,
+   1792,  1792,  1792,  1792,  1818,  1818,  1818,  1818,
+   1843,  1843,  1843,  1843,  1869,  1869,  1869,  1869,
+   1869,  1894,  1894,  1894,  1894,  1920,  1920,  1920,
+   1920,  1946,  1946,  1946,  1946,  1971,  1971,  1971,
+   1971,  1971,  1997,  1997,  1997,  1997,  2022,  2022,
+   2022,  2022,  2022,  2048,  2048,  2048,  2048,  2074,
+   2074,  2074,  2074,  2074,  2099,  2099,  2099,  2099,
+   2125,  2125,  2125,  2125,  2150,  2150,  2150,  2150,
+   2150,  2176,  2176,  2176,  2176,  2202,  2202,  2202,
+   2202,  2227,  2227,  2227,  2227,  2227,  2253,  2253,
+   2253,  2253,  2278,  2278,  2278,  2278,  2278,  2304,
+   2304,  2304,  2304,  2330,  2330,  2330,  2330,  2330,
+   2355,  2355,  2355,  2355,  2381,  2381,  2381,  2381,
+   2406,  2406,  2406,  2406,  2406,  2432,  2432,  2432,
+   2432,  2458,  2458,  2458,  2458,  2458,  2483,  2483,
+   2483,  2483,  2509,  2509,  2509,  2509,  2509,  2534,
+   2534,  2534,  2534,  2560,  2560,  2560,  2560,  2560,
+   2586,  2586,  2586,  2586,  2611,  2611,  2611,  2611,
+   2611,  2637,  2637,  2637,  2637,  2662,  2662,  2662,
+   2662,  2662,  2688,  2688,  2688,  2688,  2714,  2714,
+   2714,  2714,  2739,  2739,  2739,  2739,  2739,  2765,
+   2765,  2765,  2765,  2765,  2790,  2790,  2790,  2790,
+   2816,  2816,  2816,  2816,  2816,  2842,  2842,  2842,
+   2842,  2867,  2867,  2867,  2867,  2867,  2893,  2893,
+   2893,  2893,  2918,  2918,  2918,  2918,  2918,  2944,
+   2944,  2944,  2944,  2970,  2970,  2970,  2970,  2970,
+   2995,  2995,  2995,  2995,  3021,  3021,  3021,  3021,
+   3021,  3046,  3046,  3046,  3046,  3046,  3072,  3072,
+   3072,  3072,  3098,  3098,  3098,  3098,  3098,  3123,
+   3123,  3123,  3123,  3149,  3149,  3149,  3149,  3149,
+   3174,  3174,  3174,  3174,  3200,  3200,  3200,  3200,
+   3200,  3226,  3226,  3226,  3226,  3226,  3251,  3251,
+   3251,  3251,  3277,  3277,  3277,  3277,  3277,  3302,
+   3302,  3302,  3302,  3328,  3328,  3328,  3328,  3328,
+   3354,  3354,  3354,  3354,  3354,  3379,  3379,  3379,
+   3379,  3405,  3405,  3405,  3405,  3405,  3430,  3430,
+   3430,  3430,  3456,  3456,  3456,  3456,  3456,  3482,
+   3482,  3482,  3482,  3507,  3507,  3507,  3507,  3507,
+   3533,  3533,  3533,  3533,  3533,  3558,  3558,  3558,
+   3558,  3584,  3584,  3584,  3584,  3584,  3610,  3610,
+   3610,  3610,  3610,  3635,  3635,  3635,  3635,  3635,
+   3661,  3661,  3661,  3661,  3686,  3686,  3686,  3686,
+   3686,  3712,  3712,  3712,  3712,  3738,  3738,  3738,
+   3738,  3738,  3763,  3763,  3763,  3763,  3763,  3789,
+   3789,  3789,  3789,  3814,  3814,  3814,  3814,  3814,
+   3840,  3840,  3840,  3840,  3840,  3866,  3866,  3866,
+   3866,  3891,  3891,  3891,  3891,  3891,  3917,  3917,
+   3917,  3917,  3917,  3942,  3942,  3942,  3942,  3968,
+   3968,  3968,  3968,  3968,  3994,  3994,  3994,  3994,
+   4019,  4019,  4019,  4019,  4019,  4045,  4045,  4045,
+   4045,  4045,  4070,  4070,  4070,  4070,  4070,  4096,
+   4096,  4096,  4096,  4122,  4122,  4122,  4122,  4122,
+   4147,  4147,  4147,  4147,  4147,  4173,  4173,  4173,
+   4173,  4198,  4198,  4198,  4198,  4198,  4224,  4224,
+   4224,  4224,  4250,  4250,  4250,  4250,  4250,  4275,
+   4275,  4275,  4275,  4275,  4301,  4301,  4301,  4301,
+   4301,  4326,  4326,  4326,  4326,  4352,  4352,  4352,
+   4352,  4352,  4378,  4378,  4378,  4378,  4378,  4403,
+   4403,  4403,  4403,  4429,  4429,  4429,  4429,  4429,
+   4454,  4454,  4454,  4454,  4454,  4480,  4480,  4480,
+   4480,  4506,  4506,  4506,  4506,  4506,  4531,  4531,
+   4531,  4531,  4557,  4557,  4557,  4557,  4557,  4582,
+   4582,  4582,  4582,  4582,  4608,  4608,  4608,  4608,
+   4608,  4634,  4634,  4634,  4634,  4634,  4659,  4659,
+   4659,  4659,  4685,  4685,  4685,  4685,  4685,  4710,
+   4710,  4710,  4710,  4710,  4736,  4736,  4736,  4736,
+   4762,  4762,  4762,  4762,  4762,  4787,  4787,  4787,
+   4787,  4787,  4813,  4813,  4813,  4813,  4838,  4838,
+   4838,  4838,  4838,  4864,  4864,  4864,  4864,  4864,
+   4890,  4890,  4890,  4890,  4890,  4915,  4915,  4915,
+   4915,  4941,  4941,  4941,  4941,  4941,  4966,  4966,
+   4966,  4966,  4992,  4992,  4992,  4992,  4992,  5018,
+   5018,  5018,  5018,  5018,  5043,  5043,  5043,  5043,
+   5069,  5069,  5069,  5069,  5069,  5094,  5094,  5094,
+   5094,  5094,  5120,  5120,  5120,  5120,  5146,  5146,
+   5146,  5146,  5146,  5146,  5171,  5171,  5171,  5171,
+   5197,  5197,  5197,  5197,  5197,  5222,  5222,  5222,
+   5222,  5248,  5248,  5248,  5248,  5248,  5274,  5274,
+   5274,  5274,  5299,  5299,  5299,  5299,  5299,  5325,
+   5325,  5325,  5325,  5325,  5350,  5350,  5350,  5350,
+   5376,  5376,  5376,  5376,  5376,  5402,  5402,  5402,
+   5402,  5402,  5427,  5427,  5427,  5427,  5427,  5453,
+   5453,  5453,  5453,  5453,  5478,  5478,  5478,  5478,
+   5504,  5504,  5504,  5504,  5504,  5530,  5530,  5530,
+   5530,  5555,  5555,  5555,  5555,  5555,  5581,  5581,
+   5581,  5581,  5581,  5606,  5606,  5606,  5606,  5632,
+   5632,  5632,  5632,  5632,  5658,  5658,  5658,  5658,
+   5658,  5683,  5683,  5683,  5683,  5683,  5709,  5709,
+   5709,  5709,  5734,  5734,  5734,  5734,  5734,  5760,
+   5760,  5760,  5760,  5760,  5786,  5786,  5786,  5786,
+   5811,  5811,  5811,  5811,  5811,  5837,  5837,  5837,
+   5837,  5837,  5862,  5862,  5862,  5862,  5888,  5888,
+   5888,  5888,  5888,  5914,  5914,  5914,  5914,  5914,
+   5939,  5939,  5939,  5939,  5965,  5965,  5965,  5965,
+   5965,  5990,  5990,  5990,  5990,  6016,  6016,  6016,
+   6016,  6016,  6042,  6042,  6042,  6042,  6042,  6067,
+   6067,  6067,  6067,  6093,  6093,  6093,  6093,  6093,
+   6118,  6118,  6118,  6118,  6118,  6144,  6144,  6144,
+   6144,  6170,  6170,  6170,  6170,  6170,  6195,  6195,
+   6195,  6195,  6195,  6221,  6221,  6221,  6221,  6246,
+   6246,  6246,  6246,  6246,  6272,  6272,  6272,  6272,
+   6272,  6298,  6298,  6298,  6298,  6323,  6323,  6323,
+   6323,  6323,  6349,  6349,  6349,  6349,  6349,  6374,
+   6374,  6374,  6374,  6400,  6400,  6400,  6400,  6400,
+   6426,  6426,  6426,  6426,  6451,  6451,  6451,  6451,
+   6451,  6477,  6477,  6477,  6477,  6502,  6502,  6502,
+   6502,  6502,  6528,  6528,  6528,  6528,  6554,  6554,
+   6554,  6554,  6554,  6579,  6579,  6579,  6579,  6605,
+   6605,  6605,  6605,  6605,  6630,  6630,  6630,  6630,
+   6656,  6656,  6656,  6656,  6656,  6682,  6682,  6682,
+   6682,  6682,  6707,  6707,  6707,  6707,  6707,  6733,
+   6733,  6733,  6733,  6758,  6758,  6758,  6758,  6758,
+   6784,  6784,  6784,  6784,  6810,  6810,  6810,  6810,
+   6810,  6835,  6835,  6835,  6835,  6861,  6861,  6861,
+   6861,  6861,  6886,  6886,  6886,  6886,  6912,  6912,
+   6912,  6912,  6912,  6938,  6938,  6938,  6938,  6938,
+   6963,  6963,  6963,  6963,  6989,  6989,  6989,  6989,
+   6989,  7014,  7014,  7014,  7014,  7040,  7040,  7040,
+   7040,  7040,  7066,  7066,  7066,  7066,  7091,  7091,
+   7091,  7091,  7117,  7117,  7117,  7117,  7117,  7142,
+   7142,  7142,  7142,  7142,  7168,  7168,  7168,  7168,
+   7194,  7194,  7194,  7194,  7194,  7219,  7219,  7219,
+   7219,  7219,  7245,  7245,  7245,  7245,  7270,  7270,
+   7270,  7270,  7296,  7296,  7296,  7296,  7296,  7322,
+   7322,  7322,  7322,  7347,  7347,  7347,  7347,  7373,
+   7373,  7373,  7373,  7373,  7398,  7398,  7398,  7398,
+   7424,  7424,  7424,  7424,  7424,  7450,  7450,  7450,
+   7450,  7450,  7475,  7475,  7475,  7475,  7501,  7501,
+   7501,  7501,  7526,  7526,  7526,  7526,  7526,  7552,
+   7552,  7552,  7552,  7578,  7578,  7578,  7578,  7603,
+   7603,  7603,  7603,  7603,  7629,  7629,  7629,  7629,
+   7654,  7654,  7654,  7654,  7654,  7680,  7680,  7680,
+   7680,  7706,  7706,  7706,  7706,  7706,  7731,  7731,
+   7731,  7731,  7731,  7757,  7757,  7757,  7757,  7782,
+   7782,  7782,  7782,  7808,  7808,  7808,  7808,  7808,
+   7834,  7834,  7834,  7834,  7859,  7859,  7859,  7859,
+   7859,  7885,  7885,  7885,  7885,  7910,  7910,  7910,
+   7910,  7936,  7936,  7936,  7936,  7936,  7962,  7962,
+   7962,  7962,  7987,  7987,  7987,  7987,  8013,  8013,
+   8013,  8013,  8013,  8038,  8038,  8038,  8038,  8064,
+   8064,  8064,  8064,  8090,  8090,  8090,  8090,  8115,
+   8115,  8115,  8115,  8115,  8141,  8141,  8141,  8141,
+   8166,  8166,  8166,  8166,  8192,  8192,  8192,  8192,
+   8192,  8218,  8218,  8218,  8218,  8218,  8243,  8243,
+   8243,  8243,  8269,  8269,  8269,  8269,  8294,  8294,
+   8294,  8294,  8320,  8320,  8320,  8320,  8346,  8346,
+   8346,  8346,  8371,  8371,  8371,  8371,  8397,  8397,
+   8397,  8397,  8397,  8422,  8422,  8422,  8422,  8448,
+   8448,  8448,  8448,  8474,  8474,  8474,  8474,  8474,
+   8499,  8499,  8499,  8499,  8525,  8525,  8525,  8525,
+   8525,  8550,  8550,  8550,  8550,  8576,  8576,  8576,
+   8576,  8602,  8602,  8602,  8602,  8627,  8627,  8627,
+   8627,  8653,  8653,  8653,  8653,  8678,  8678,  8678,
+   8678,  8678,  8704,  8704,  8704,  8704,  8730,  8730,
+   8730,  8730,  8730,  8755,  8755,  8755,  8755,  8781,
+   8781,  8781,  8781,  8806,  8806,  8806,  8806,  8832,
+   8832,  8832,  8832,  8858,  8858,  8858,  8858,  8883,
+   8883,  8883,  8883,  8883,  8909,  8909,  8909,  8909,
+   8934,  8934,  8934,  8934,  8960,  8960,  8960,  8960,
+   8986,  8986,  8986,  8986,  9011,  9011,  9011,  9011,
+   9037,  9037,  9037,  9037,  9062,  9062,  9062,  9062,
+   9088,  9088,  9088,  9088,  9114,  9114,  9114,  9114,
+   9139,  9139,  9139,  9139,  9165,  9165,  9165,  9165,
+   9190,  9190,  9190,  9190,  9216,  9216,  9216,  9216,
+   9242,  9242,  9242,  9242,  9242,  9267,  9267,  9267,
+   9267,  9293,  9293,  9293,  9293,  9318,  9318,  9318,
+   9318,  9344,  9344,  9344,  9344,  9370,  9370,  9370,
+   9370,  9395,  9395,  9395,  9395,  9421,  9421,  9421,
+   9421,  9446,  9446,  9446,  9446,  9472,  9472,  9472,
+   9472,  9498,  9498,  9498,  9498,  9498,  9523,  9523,
+   9523,  9523,  9549,  9549,  9549,  9574,  9574,  9574,
+   9574,  9600,  9600,  9600,  9600,  9626,  9626,  9626,
+   9626,  9651,  9651,  9651,  9651,  9677,  9677,  9677,
+   9677,  9702,  9702,  9702,  9702,  9728,  9728,  9728,
+   9728,  9754,  9754,  9754,  9754,  9779,  9779,  9779,
+   9779,  9805,  9805,  9805,  9805,  9830,  9830,  9830,
+   9830,  9856,  9856,  9856,  9856,  9882,  9882,  9882,
+   9882,  9907,  9907,  9907,  9907,  9933,  9933,  9933,
+   9933,  9958,  9958,  9958,  9984,  9984,  9984,  9984,
+  10010, 10010, 10010, 10010, 10035, 10035, 10035, 10035,
+  10061, 10061, 10061, 10061, 10086, 10086, 10086, 10086,
+  10112, 10112, 10112, 10112, 10138, 10138, 10138, 10163,
+  10163, 10163, 10163, 10189, 10189, 10189, 10189, 10214,
+  10214, 10214, 10214, 10240, 10240, 10240, 10240, 10266,
+  10266, 10266, 10266, 10291, 10291, 10291, 10291, 10317,
+  10317, 10317, 10342, 10342, 10342, 10342, 10368, 10368,
+  10368, 10368, 10394, 10394, 10394, 10394, 10419, 10419,
+  10419, 10445, 10445, 10445, 10445, 10470, 10470, 10470,
+  10470, 10496, 10496, 10496, 10496, 10522, 10522, 10522,
+  10547, 10547, 10547, 10547, 10573, 10573, 10573, 10573,
+  10598, 10598, 10598, 10624, 10624, 10624, 10624, 10650,
+  10650, 10650, 10650, 10675, 10675, 10675, 10701, 10701,
+  10701, 10701, 10726, 10726, 10726, 10726, 10752, 10752,
+  10752, 10752, 10778, 10778, 10778, 10803, 10803, 10803,
+  10803, 10829, 10829, 10829, 10854, 10854, 10854, 10854,
+  10880, 10880, 10880, 10880, 10906, 10906, 10906, 10931,
+  10931, 10931, 10931, 10957, 10957, 10957, 10982, 10982,
+  10982, 10982, 11008, 11008, 11008, 11008, 11034, 11034,
+  11034, 11059, 11059, 11059, 11059, 11085, 11085, 11085,
+  11110, 11110, 11110, 11110, 11136, 11136, 11136, 11162,
+  11162, 11162, 11162, 11187, 11187, 11187, 11213, 11213,
+  11213, 11213, 11238, 11238, 11238, 11264, 11264, 11264,
+  11264, 11290, 11290, 11290, 11290, 11315, 11315, 11315,
+  11341, 11341, 11341, 11341, 11366, 11366, 11366, 11392,
+  11392, 11392, 11418, 11418, 11418, 11418, 11443, 11443,
+  11443, 11469, 11469, 11469, 11469, 11494, 11494, 11494,
+  11520, 11520, 11520, 11546, 11546, 11546, 11546, 11546,
+  11571, 11571, 11571, 11597, 11597, 11597, 11622, 11622,
+  11622, 11648, 11648, 11648, 11648, 11674, 11674, 11674,
+  11699, 11699, 11699, 11725, 11725, 11725, 11750, 11750,
+  11750, 11750, 11776, 11776, 11776, 11802, 11802, 11802,
+  11802, 11802, 11827, 11827, 11827, 11853, 11853, 11853,
+  11878, 11878, 11878, 11878, 11904, 11904, 11904, 11930,
+  11930, 11930, 11955, 11955, 11955, 11955, 11981, 11981,
+  11981, 12006, 12006, 12006, 12032, 12032, 12032, 12032,
+  12058, 12058, 12058, 12083, 12083, 12083, 12109, 12109,
+  12109, 12134, 12134, 12134, 12160, 12160, 12160, 12160,
+  12186, 12186, 12186, 12211, 12211, 12211, 12237, 12237,
+  12237, 12262, 12262, 12262, 12288, 12288, 12288, 12288,
+  12314, 12314, 12314, 12314, 12339, 12339, 12339, 12365,
+  12365, 12365, 12390, 12390, 12390, 12416, 12416, 12416,
+  12442, 12442, 12442, 12467, 12467, 12467, 12493, 12493,
+  12493, 12518, 12518, 12518, 12544, 12544, 12544, 12570,
+  12570, 12570, 12570, 12595, 12595, 12595, 12621, 12621,
+  12621, 12621, 12646, 12646, 12646, 12672, 12672, 12672,
+  12698, 12698, 12698, 12723, 12723, 12723, 12749, 12749,
+  12749, 12774, 12774, 12774, 12800, 12800, 12800, 12826,
+  12826, 12826, 12851, 12851, 12851, 12877, 12877, 12877,
+  12902, 12902, 12902, 12928, 12928, 12928, 12954, 12954,
+  12954, 12979, 12979, 12979, 13005, 13005, 13005, 13030,
+  13030, 13030, 13056, 13056, 13056, 13082, 13082, 13082,
+  13107, 13107, 13107, 13133, 13133, 13133, 13158, 13158,
+  13158, 13184, 13184, 13184, 13210, 13210, 13235, 13235,
+  13235, 13261, 13261, 13261, 13286, 13286, 13286, 13312,
+  13312, 13338, 13338, 13338, 13338, 13338, 13363, 13363,
+  13363, 13389, 13389, 13389, 13414, 13414, 13414, 13440,
+  13440, 13440, 13466, 13466, 13491, 13491, 13491, 13517,
+  13517, 13517, 13542, 13542, 13542, 13568, 13568, 13568,
+  13594, 13594, 13594, 13619, 13619, 13619, 13645, 13645,
+  13670, 13670, 13670, 13696, 13696, 13722, 13722, 13722,
+  13747, 13747, 13747, 13773, 13773, 13798, 13798, 13798,
+  13824, 13824, 13824, 13850, 13850, 13850, 13850, 13875,
+  13875, 13875, 13901, 13901, 13901, 13926, 13926, 13952,
+  13952, 13952, 13978, 13978, 13978, 14003, 14003, 14029,
+  14029, 14029, 14054, 14054, 14054, 14080, 14080, 14106,
+  14106, 14106, 14131, 14131, 14131, 14157, 14157, 14182,
+  14182, 14182, 14208, 14208, 14234, 14234, 14234, 14259,
+  14259, 14285, 14285, 14285, 14310, 14310, 14336, 14336,
+  14336, 14362, 14362, 14362, 14362, 14387, 14387, 14387,
+  14413, 14413, 14438, 14438, 14438, 14464, 14464, 14490,
+  14490, 14490, 14515, 14515, 14541, 14541, 14541, 14566,
+  14566, 14592, 14592, 14592, 14618, 14618, 14618, 14643,
+  14643, 14643, 14669, 14669, 14694, 14694, 14720, 14720,
+  14746, 14746, 14746, 14771, 14771, 14797, 14797, 14822,
+  14822, 14822, 14848, 14848, 14874, 14874, 14874, 14874,
+  14874, 14899, 14899, 14925, 14925, 14950, 14950, 14950,
+  14976, 14976, 15002, 15002, 15027, 15027, 15027, 15053,
+  15053, 15078, 15078, 15104, 15104, 15104, 15130, 15130,
+  15130, 15155, 15155, 15155, 15181, 15181, 15206, 15206,
+  15206, 15232, 15232, 15258, 15258, 15283, 15283, 15283,
+  15309, 15309, 15334, 15334, 15334, 15360, 15360, 15386,
+  15386, 15411, 15411, 15437, 15437, 15462, 15462, 15488,
+  15488, 15488, 15514, 15514, 15539, 15539, 15565, 15565,
+  15590, 15590, 15616, 15616, 15642, 15642, 15642, 15642,
+  15642, 15667, 15667, 15693, 15693, 15718, 15718, 15744,
+  15744, 15770, 15770, 15770, 15795, 15795, 15821, 15821,
+  15846, 15846, 15872, 15872, 15898, 15898, 15898, 15923,
+  15923, 15949, 15949, 15949, 15974, 15974, 16000, 16000,
+  16026, 16026, 16051, 16051, 16051, 16077, 16077, 16102,
+  16102, 16128, 16128, 16154, 16154, 16179, 16179, 16205,
+  16205, 16230, 16230, 16256, 16256, 16282, 16282, 16307,
+  16307, 16333, 16333, 16358, 16358, 16384, 16384, 16410,
+  16410, 16410, 16410, 16435, 16435, 16461, 16461, 16486,
+  16486, 16512, 16512, 16538, 16538, 16563, 16563, 16589,
+  16589, 16614, 16614, 16640, 16640, 16666, 16666, 16666,
+  16691, 16691, 16717, 16717, 16742, 16742, 16768, 16768,
+  16794, 16794, 16819, 16819, 16845, 16845, 16870, 16870,
+  16896, 16896, 16922, 16922, 16947, 16973, 16973, 16998,
+  16998, 17024, 17024, 17050, 17075, 17075, 17101, 17101,
+  17126, 17126, 17152, 17178, 17178, 17178, 17178, 17178,
+  17203, 17229, 17229, 17254, 17254, 17280, 17280, 17306,
+  17331, 17331, 17357, 17357, 17382, 17382, 17408, 17434,
+  17434, 17434, 17434, 17459, 17485, 17485, 17510, 17510,
+  17536, 17536, 17562, 17562, 17587, 17613, 17613, 17638,
+  17638, 17664, 17664, 17690, 17690, 17715, 17715, 17741,
+  17741, 17766, 17766, 17792, 17818, 17818, 17843, 17843,
+  17869, 17869, 17894, 17894, 17920, 17946, 17946, 17971,
+  17971, 17997, 18022, 18022, 18048, 18074, 18074, 18099,
+  18125, 18125, 18150, 18176, 18176, 18202, 18202, 18202,
+  18202, 18227, 18253, 18253, 18278, 18304, 18304, 18330,
+  18355, 18355, 18381, 18406, 18406, 18432, 18458, 18458,
+  18458, 18458, 18483, 18509, 18509, 18534, 18560, 18560,
+  18586, 18611, 18611, 18637, 18662, 18662, 18688, 18688,
+  18714, 18714, 18739, 18739, 18765, 18790, 18790, 18816,
+  18842, 18842, 18867, 18893, 18893, 18918, 18944, 18944,
+  18970, 18970, 18995, 19021, 19046, 19046, 19072, 19098,
+  19123, 19149, 19149, 19174, 19200, 19226, 19226, 19226,
+  19226, 19251, 19277, 19277, 19302, 19328, 19354, 19354,
+  19379, 19405, 19430, 19456, 19456, 19482, 19482, 19482,
+  19507, 19507, 19533, 19558, 19584, 19584, 19610, 19635,
+  19661, 19686, 19686, 19712, 19738, 19738, 19738, 19763,
+  19789, 19814, 19814, 19840, 19866, 19891, 19917, 19917,
+  19942, 19968, 19994, 19994, 19994, 20019, 20045, 20045,
+  20070, 20096, 20122, 20147, 20147, 20173, 20198, 20224,
+  20224, 20250, 20250, 20275, 20301, 20326, 20326, 20352,
+  20378, 20403, 20403, 20429, 20454, 20480, 20480, 20506,
+  20531, 20557, 20582, 20608, 20634, 20659, 20685, 20710,
+  20736, 20762, 20762, 20762, 20762, 20787, 20813, 20838,
+  20864, 20890, 20915, 20941, 20966, 20992, 21018, 21018,
+  21018, 21043, 21069, 21094, 21120, 21146, 21171, 21197,
+  21222, 21248, 21274, 21274, 21274, 21299, 21325, 21350,
+  21376, 21402, 21427, 21453, 21478, 21504, 21530, 21530,
+  21530, 21555, 21581, 21606, 21632, 21658, 21683, 21709,
+  21734, 21760, 21786, 21786, 21811, 21837, 21862, 21888,
+  21914, 21939, 21965, 21990, 22016, 22042, 22042, 22067,
+  22093, 22118, 22118, 22144, 22170, 22195, 22221, 22246,
+  22272, 22298, 22323, 22349, 22374, 22400, 22426, 22451,
+  22477, 22502, 22528, 22554, 22579, 22630, 22656, 22707,
+  22733, 22758, 22810, 22810, 22810, 22810, 22835, 22886,
+  22912, 22963, 22989, 23014, 23066, 23066, 23066, 23066,
+  23117, 23142, 23168, 23219, 23245, 23296, 23322, 23322,
+  23322, 23347, 23373, 23424, 23450, 23501, 23526, 23578,
+  23578, 23578, 23603, 23629, 23680, 23706, 23757, 23782,
+  23808, 23834, 23834, 23859, 23910, 23936, 23962, 24013,
+  24038, 24090, 24090, 24090, 24141, 24166, 24218, 24243,
+  24269, 24320, 24346, 24346, 24371, 24397, 24448, 24474,
+  24525, 24550, 24576, 24602, 24627, 24678, 24704, 24730,
+  24781, 24806, 24858, 24858, 24883, 24934, 24960, 25011,
+  25037, 25062, 25114, 25139, 25165, 25190, 25242, 25267,
+  25318, 25344, 25370, 25395, 25421, 25446, 25472, 25498,
+  25523, 25523, 25549, 25574, 25600, 25626, 25626, 25626,
+  25933, 25984, 26061, 26138, 26138, 26138, 26138, 26214,
+  26291, 26342, 26394, 26394, 26394, 26419, 26496, 26573,
+  26624, 26650, 26650, 26701, 26752, 26829, 26906, 26906,
+  26906, 26931, 27008, 27059, 27136, 27162, 27162, 27213,
+  27290, 27341, 27418, 27418, 27418, 27469, 27546, 27622,
+  27674, 27674, 27725, 27776, 27853, 27930, 27930, 27955,
+  28032, 28083, 28160, 28186, 28186, 28262, 28339, 28390,
+  28442, 28467, 28518, 28595, 28672, 28698, 28723, 28800,
+  28851, 28928, 28954, 28979, 29056, 29133, 29184, 29210,
+  29286, 29338, 29414, 29466, 29517, 29594, 29645, 29722,
+  29773, 29824, 29901, 29978, 30003, 30080, 30131, 30208,
+  30285, 30336, 30413, 30490, 30746, 30746, 30746, 30746,
+  30822, 30874, 30950, 31258, 31258, 31258, 31258, 31514,
+  31514, 31514, 31770, 31770, 31770, 32026, 32026, 32026,
+  32026, 32026, 32026, 32026, 32026, 32026, 32026, 32026,
+  32026, 32026, 32026, 32026, 32026, 32026, 32026, 32026,
+  32026, 32026, 32026, 32026, 32026, 32026, 32026, 32026,
+  32026, 32026, 32026, 32026, 32026, 32026, 32026, 32026,
+  32026, 32026, 32026, 32026, 32026, 32026, 32026, 32026,
+  32026, 32026, 32026, 32026, 32026, 32026, 32026, 32026,
+  32026, 32026, 32026, 32026, 32026, 32026, 32026, 32026,
+  32026, 32026, 32026, 32026, 32026, 32026, 32026, 32026,
+  32026, 32026, 32026, 32026, 32026, 32026, 32026, 32026,
+  32026, 32026, 32026, 32026, 32026, 32026, 32026, 32026,
+  32026, 32026, 32026, 32026, 32026, 32026, 32026, 32026,
+  32026, 32026, 32026, 32026, 32026, 32026, 32026, 32026,
+  32026, 32026, 32026, 32026, 32026, 32026, 32026, 32026,
+  32026, 32026, 32026, 32026, 32026, 32026, 32026, 32026,
+  32026, 32026, 32026, 32026, 32026, 32026, 32026, 32026,
+};
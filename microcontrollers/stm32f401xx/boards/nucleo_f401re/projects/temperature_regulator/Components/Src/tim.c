@@ -0,0 +1,177 @@
+#include "tim.h"
+
+#include "stm32f4xx_ll_bus.h"
+#include "stm32f4xx_ll_rcc.h"
+#include "stm32f4xx_ll_tim.h"
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define TIM3_COUNTER_FREQUENCY_HZ 10000U
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+/* Kept to derive the periods again when the timers clock changes. */
+static uint32_t tim2TriggerFrequencyHz;
+static uint32_t tim3SlotFrequencyHz;
+
+
+
+/*****************************************************************************/
+/*                      PRIVATE FUNCTIONS PROTOTYPES                         */
+/*****************************************************************************/
+
+static uint32_t GetApb1TimersClockFrequency(void);
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+void TIM2_Clock_Config(void)
+{
+  LL_APB1_GRP1_EnableClock(LL_APB1_GRP1_PERIPH_TIM2);
+}
+
+
+
+void TIM2_ADC1_Trigger_Config(uint32_t triggerFrequencyHz)
+{
+  /*
+    TIM2 is a 32-bit timer, so the whole range of trigger frequencies is
+    covered without prescaler and the update event period is exact whenever
+    the timers clock is a multiple of the trigger frequency.
+  */
+  tim2TriggerFrequencyHz = triggerFrequencyHz;
+
+  LL_TIM_InitTypeDef TIM2_ADC1_Trigger_InitStruct = {
+    .Prescaler         = 0,
+    .CounterMode       = LL_TIM_COUNTERMODE_UP,
+    .Autoreload        = __LL_TIM_CALC_ARR(GetApb1TimersClockFrequency(), 0,
+                                           triggerFrequencyHz),
+    .ClockDivision     = LL_TIM_CLOCKDIVISION_DIV1,
+    .RepetitionCounter = 0
+  };
+  LL_TIM_Init(TIM2, &TIM2_ADC1_Trigger_InitStruct);
+  LL_TIM_DisableARRPreload(TIM2);
+
+  LL_TIM_SetTriggerOutput(TIM2, LL_TIM_TRGO_UPDATE);
+  LL_TIM_DisableMasterSlaveMode(TIM2);
+}
+
+
+
+void TIM2_ADC1_Trigger_Start(void)
+{
+  LL_TIM_SetCounter(TIM2, 0);
+  LL_TIM_EnableCounter(TIM2);
+}
+
+
+
+/*
+  Called with interrupts disabled after a system clock switch. ARR preload
+  is off, so the counter is scaled with it and the period in progress keeps
+  its phase instead of overrunning the new ARR.
+*/
+void TIM2_ADC1_Trigger_UpdateClock(void)
+{
+  if(tim2TriggerFrequencyHz == 0) {
+    return;
+  }
+
+  uint32_t previousAutoreload = LL_TIM_GetAutoReload(TIM2);
+  uint32_t autoreload = __LL_TIM_CALC_ARR(GetApb1TimersClockFrequency(), 0,
+                                          tim2TriggerFrequencyHz);
+  uint32_t counter = (uint32_t)(((uint64_t)LL_TIM_GetCounter(TIM2) *
+    autoreload) / (previousAutoreload + 1U));
+
+  LL_TIM_SetAutoReload(TIM2, autoreload);
+  LL_TIM_SetCounter(TIM2, counter);
+}
+
+
+
+void TIM3_Clock_Config(void)
+{
+  LL_APB1_GRP1_EnableClock(LL_APB1_GRP1_PERIPH_TIM3);
+}
+
+
+
+void TIM3_LED2_Pattern_Config(uint32_t slotFrequencyHz)
+{
+  /*
+    TIM3 is a 16-bit timer, counting at 10 kHz covers slot frequencies
+    down to 0.2 Hz. One update interrupt per slot of the pattern.
+  */
+  uint32_t timersClockFrequency = GetApb1TimersClockFrequency();
+  uint32_t prescaler = __LL_TIM_CALC_PSC(timersClockFrequency,
+                                         TIM3_COUNTER_FREQUENCY_HZ);
+  tim3SlotFrequencyHz = slotFrequencyHz;
+
+  LL_TIM_InitTypeDef TIM3_LED2_Pattern_InitStruct = {
+    .Prescaler         = prescaler,
+    .CounterMode       = LL_TIM_COUNTERMODE_UP,
+    .Autoreload        = __LL_TIM_CALC_ARR(timersClockFrequency, prescaler,
+                                           slotFrequencyHz),
+    .ClockDivision     = LL_TIM_CLOCKDIVISION_DIV1,
+    .RepetitionCounter = 0
+  };
+  LL_TIM_Init(TIM3, &TIM3_LED2_Pattern_InitStruct);
+  LL_TIM_EnableARRPreload(TIM3);
+
+  LL_TIM_ClearFlag_UPDATE(TIM3);
+  LL_TIM_EnableIT_UPDATE(TIM3);
+}
+
+
+
+void TIM3_LED2_Pattern_Start(void)
+{
+  LL_TIM_SetCounter(TIM3, 0);
+  LL_TIM_EnableCounter(TIM3);
+}
+
+
+
+/*
+  Called with interrupts disabled after a system clock switch. The counter
+  keeps counting at 10 kHz, the prescaler is preloaded and the new one
+  takes over from the next slot.
+*/
+void TIM3_LED2_Pattern_UpdateClock(void)
+{
+  if(tim3SlotFrequencyHz == 0) {
+    return;
+  }
+
+  LL_TIM_SetPrescaler(TIM3, __LL_TIM_CALC_PSC(GetApb1TimersClockFrequency(),
+                                              TIM3_COUNTER_FREQUENCY_HZ));
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+static uint32_t GetApb1TimersClockFrequency(void)
+{
+  LL_RCC_ClocksTypeDef systemClocks;
+  LL_RCC_GetSystemClocksFreq(&systemClocks);
+
+  if(LL_RCC_GetAPB1Prescaler() == LL_RCC_APB1_DIV_1) {
+    return systemClocks.PCLK1_Frequency;
+  } else {
+    return 2 * systemClocks.PCLK1_Frequency;
+  }
+}
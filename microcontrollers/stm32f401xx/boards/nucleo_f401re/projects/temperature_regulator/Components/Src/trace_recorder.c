@@ -0,0 +1,217 @@
+#include "dwt.h"
+#include "trace_recorder.h"
+
+#include "FreeRTOS.h"
+#include "queue.h"
+
+#include "stm32f4xx.h"
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#if (TRACE_RECORDER_RECORDS_COUNT & (TRACE_RECORDER_RECORDS_COUNT - 1U)) != 0
+#error "TRACE_RECORDER_RECORDS_COUNT must be a power of two"
+#endif
+
+#define RECORD_INDEX_MASK (TRACE_RECORDER_RECORDS_COUNT - 1U)
+
+#define EXCEPTION_NUMBER_MASK 0xFFU
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+/* Written at nextRecord, the oldest of recordsCount records is overwritten. */
+static traceRecord_t records[TRACE_RECORDER_RECORDS_COUNT];
+static uint32_t nextRecord;
+static uint32_t recordsCount;
+static uint32_t overwrittenRecordsCount;
+static uint32_t isFrozen;
+
+static uint32_t runningTaskNumber;
+
+static QueueHandle_t queues[TRACE_RECORDER_QUEUES_MAX];
+static uint32_t queuesCount;
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static void Record(uint32_t event, uint32_t object, uint32_t data);
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+/*
+  traceTASK_SWITCHED_IN, with interrupts masked. A switch back to the task
+  that was running is not recorded.
+*/
+void TRACE_RECORDER_TaskSwitchedIn(uint32_t taskNumber)
+{
+  if(taskNumber == runningTaskNumber) {
+    return;
+  }
+
+  runningTaskNumber = taskNumber;
+  Record(TraceEvent_TaskSwitchedIn, taskNumber, 0);
+}
+
+
+
+/* traceTASK_NOTIFY, traceTASK_NOTIFY_FROM_ISR, traceTASK_NOTIFY_WAIT_BLOCK. */
+void TRACE_RECORDER_TaskEvent(uint32_t event, uint32_t taskNumber)
+{
+  Record(event, taskNumber, 0);
+}
+
+
+
+/*
+  traceQUEUE_CREATE, before the queue is used. Queues are numbered in
+  creation order, their names are looked up in the queue registry when the
+  trace is dumped, after osMessageQueueNew has registered them.
+*/
+void TRACE_RECORDER_QueueCreated(void *queue)
+{
+  if(queuesCount == TRACE_RECORDER_QUEUES_MAX) {
+    return;
+  }
+
+  queues[queuesCount++] = queue;
+  vQueueSetQueueNumber(queue, queuesCount);
+}
+
+
+
+/* The queue hooks of queue.c, from tasks and interrupts. */
+void TRACE_RECORDER_QueueEvent(uint32_t event, uint32_t queueNumber,
+  uint32_t messagesWaiting)
+{
+  Record(event, queueNumber, messagesWaiting);
+}
+
+
+
+/* Called first and last in the interrupt handlers of stm32f4xx_it.c. */
+void TRACE_RECORDER_IsrEnter(void)
+{
+  Record(TraceEvent_IsrEnter, __get_IPSR() & EXCEPTION_NUMBER_MASK, 0);
+}
+
+
+
+void TRACE_RECORDER_IsrExit(void)
+{
+  Record(TraceEvent_IsrExit, __get_IPSR() & EXCEPTION_NUMBER_MASK, 0);
+}
+
+
+
+/*
+  Called by system_clock.c once the core runs at the new frequency, the
+  cycle counts of the records before it are at the previous one.
+*/
+void TRACE_RECORDER_ClockSwitch(uint32_t previousFrequencyMHz,
+  uint32_t frequencyMHz)
+{
+  Record(TraceEvent_ClockSwitch, previousFrequencyMHz, frequencyMHz);
+}
+
+
+
+/*
+  Stops recording, so the records can be read while they are sent, and
+  returns how many there are. Older records overwritten since the last
+  restart are counted in overwrittenCount.
+*/
+uint32_t TRACE_RECORDER_Freeze(uint32_t *overwrittenCount)
+{
+  __disable_irq();
+  isFrozen = 1;
+  __enable_irq();
+
+  *overwrittenCount = overwrittenRecordsCount;
+  return recordsCount;
+}
+
+
+
+/* Record index of a frozen recorder, 0 being the oldest. */
+void TRACE_RECORDER_GetRecord(uint32_t index, traceRecord_t *record)
+{
+  uint32_t firstRecord = nextRecord - recordsCount;
+
+  *record = records[(firstRecord + index) & RECORD_INDEX_MASK];
+}
+
+
+
+/* NULL for numbers without a queue or a queue without a registered name. */
+const char *TRACE_RECORDER_GetQueueName(uint32_t queueNumber)
+{
+  if(queueNumber == 0 || queueNumber > queuesCount) {
+    return NULL;
+  }
+
+  return pcQueueGetName(queues[queueNumber - 1]);
+}
+
+
+
+/*
+  Empties the ring and records again, starting with the task calling it,
+  so the next dump covers the time since this one.
+*/
+void TRACE_RECORDER_Restart(void)
+{
+  __disable_irq();
+  recordsCount = 0;
+  overwrittenRecordsCount = 0;
+  isFrozen = 0;
+  __enable_irq();
+
+  Record(TraceEvent_TaskSwitchedIn, runningTaskNumber, 0);
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+/*
+  Interrupts are masked for the few instructions of the write, the hooks
+  are called from tasks, the scheduler and interrupts of any priority.
+*/
+static void Record(uint32_t event, uint32_t object, uint32_t data)
+{
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+
+  if(isFrozen == 0) {
+    traceRecord_t *record = &records[nextRecord & RECORD_INDEX_MASK];
+    record->cycles = DWT_GetCycleCount();
+    record->event = (uint8_t)event;
+    record->object = (uint8_t)object;
+    record->data = (uint16_t)data;
+    ++nextRecord;
+
+    if(recordsCount < TRACE_RECORDER_RECORDS_COUNT) {
+      ++recordsCount;
+    } else if(overwrittenRecordsCount != UINT32_MAX) {
+      ++overwrittenRecordsCount;
+    }
+  }
+
+  __set_PRIMASK(primask);
+}
@@ -2,12 +2,25 @@
 #include "usart.h"
 
 #include "stm32f401xe.h"
+#include "stm32f4xx.h"
 
 #include "stm32f4xx_ll_bus.h"
+#include "stm32f4xx_ll_rcc.h"
 #include "stm32f4xx_ll_usart.h"
 
 
 
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define USART1_BAUD_RATE 115200U
+
+/* Same level as the DMA2 Stream2 interrupt, both only wake the RX task. */
+#define USART1_IRQ_PRIORITY 6
+
+
+
 /*****************************************************************************/
 /*                     PUBLIC FUNCTIONS DEFINITIONS                          */
 /*****************************************************************************/
@@ -23,7 +36,7 @@ void USART1_TX_RX_Config(void)
 {
   LL_USART_InitTypeDef USART1_TX_RX_InitStructure =
   {
-    .BaudRate = 115200,
+    .BaudRate = USART1_BAUD_RATE,
     .DataWidth = LL_USART_DATAWIDTH_8B,
     .StopBits = LL_USART_STOPBITS_1,
     .Parity = LL_USART_PARITY_NONE,
@@ -37,5 +50,30 @@ void USART1_TX_RX_Config(void)
   LL_USART_EnableDMAReq_RX(USART1);
   LL_USART_EnableDMAReq_TX(USART1);
 
+  /*
+    Idle line: one character time without a start bit after a burst, the
+    end of a command shorter than half of the DMA RX buffer.
+  */
+  LL_USART_EnableIT_IDLE(USART1);
+  NVIC_SetPriority(USART1_IRQn,
+    NVIC_EncodePriority(NVIC_GetPriorityGrouping(), USART1_IRQ_PRIORITY, 0));
+  NVIC_EnableIRQ(USART1_IRQn);
+
   LL_USART_Enable(USART1);
 }
+
+
+
+/*
+  Called with interrupts disabled after a system clock switch, once the
+  last frame has left the shift register. A byte being received during the
+  switch is lost.
+*/
+void USART1_UpdateBaudRate(void)
+{
+  LL_RCC_ClocksTypeDef systemClocks;
+  LL_RCC_GetSystemClocksFreq(&systemClocks);
+
+  LL_USART_SetBaudRate(USART1, systemClocks.PCLK2_Frequency,
+    LL_USART_OVERSAMPLING_16, USART1_BAUD_RATE);
+}
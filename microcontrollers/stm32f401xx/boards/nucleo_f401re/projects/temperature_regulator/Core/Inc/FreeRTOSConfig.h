@@ -52,8 +52,13 @@
   #include <stdint.h>
   extern uint32_t SystemCoreClock;
   void xPortSysTickHandler(void);
+  void LOW_POWER_SuppressTicksAndSleep(uint32_t expectedIdleTicks);
+  void DWT_CycleCounter_Config(void);
+  uint32_t DWT_GetCycleCount(void);
+  void RUN_TIME_STATS_TaskSwitchedIn(uint32_t taskNumber);
+  #include "trace_recorder.h"
 #endif
-#define configENABLE_FPU                         0
+#define configENABLE_FPU                         1
 #define configENABLE_MPU                         0
 
 #define configUSE_PREEMPTION                     1
@@ -65,7 +70,7 @@
 #define configTICK_RATE_HZ                       ((TickType_t)1000)
 #define configMAX_PRIORITIES                     ( 56 )
 #define configMINIMAL_STACK_SIZE                 ((uint16_t)128)
-#define configTOTAL_HEAP_SIZE                    ((size_t)15360)
+#define configTOTAL_HEAP_SIZE                    ((size_t)16)
 #define configMAX_TASK_NAME_LEN                  ( 16 )
 #define configUSE_TRACE_FACILITY                 1
 #define configUSE_16_BIT_TICKS                   0
@@ -104,6 +109,7 @@ to exclude the API function. */
 #define INCLUDE_xQueueGetMutexHolder         1
 #define INCLUDE_uxTaskGetStackHighWaterMark  1
 #define INCLUDE_eTaskGetState                1
+#define INCLUDE_xTaskGetIdleTaskHandle       1
 
 /* 
  * The CMSIS-RTOS V2 FreeRTOS wrapper is dependent on the heap implementation used
@@ -154,6 +160,87 @@ standard names. */
 
 /* USER CODE BEGIN Defines */   	      
 /* Section where parameter definitions can be added (for instance, to override default ones in FreeRTOS.h) */
+/*
+  The ARM_CM4F port saves the FPU registers on context switches and enables
+  lazy stacking (FPCCR ASPEN and LSPEN) when the scheduler starts, so only
+  tasks that used the FPU get the extended stack frame. It needs the hard
+  float build (-mfpu=fpv4-sp-d16 -mfloat-abi=hard).
+*/
+#if defined(__GNUC__) && defined(__arm__) && !defined(__ARM_PCS_VFP)
+  #error "ARM_CM4F port requires -mfpu=fpv4-sp-d16 -mfloat-abi=hard"
+#endif
+
+/*
+  Tasks, queues and timers are allocated statically, heap_4 only stays for
+  the CMSIS-RTOS2 wrapper to link. configTOTAL_HEAP_SIZE is too small for
+  any allocation, so an object created without static memory ends in
+  vApplicationMallocFailedHook (freertos.c) instead of using the heap.
+*/
+#define configUSE_MALLOC_FAILED_HOOK             1
+
+/*
+  Tickless idle with an application defined sleep (low_power.c): the RTOS
+  idle task stops the SysTick and sleeps until the RTC wakeup timer or
+  another interrupt ends the idle period, then steps the tick count by the
+  time measured with the RTC. Sleep mode only, the sampling and USART1
+  reception keep running.
+*/
+#define configUSE_TICKLESS_IDLE                  2
+#define portSUPPRESS_TICKS_AND_SLEEP(xExpectedIdleTime) \
+  LOW_POWER_SuppressTicksAndSleep(xExpectedIdleTime)
+
+/*
+  Run time stats count DWT cycles (run_time_stats.c). The cycle counter
+  stops while the core sleeps, low_power.c advances it by the time asleep,
+  so the sleep is charged to the RTOS idle task. The switch in hook keeps
+  the longest activation of every task, identified by its task number.
+*/
+#define configGENERATE_RUN_TIME_STATS            1
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() DWT_CycleCounter_Config()
+#define portGET_RUN_TIME_COUNTER_VALUE()         DWT_GetCycleCount()
+#define traceTASK_SWITCHED_IN() \
+  do { \
+    RUN_TIME_STATS_TaskSwitchedIn(pxCurrentTCB->uxTCBNumber); \
+    TRACE_RECORDER_TaskSwitchedIn(pxCurrentTCB->uxTCBNumber); \
+  } while(0)
+
+/*
+  The event trace (trace_recorder.c) also records task notifications, which
+  carry the CMSIS thread flags, and the queue operations. Queues are
+  numbered by the recorder when they are created.
+*/
+#define traceTASK_NOTIFY() \
+  TRACE_RECORDER_TaskEvent(TraceEvent_TaskNotify, pxTCB->uxTCBNumber)
+#define traceTASK_NOTIFY_FROM_ISR() \
+  TRACE_RECORDER_TaskEvent(TraceEvent_TaskNotify, pxTCB->uxTCBNumber)
+#define traceTASK_NOTIFY_WAIT_BLOCK() \
+  TRACE_RECORDER_TaskEvent(TraceEvent_TaskNotifyWaitBlock, \
+                           pxCurrentTCB->uxTCBNumber)
+
+#define traceQUEUE_CREATE(pxNewQueue) TRACE_RECORDER_QueueCreated(pxNewQueue)
+#define TRACE_QUEUE_EVENT(event, pxQueue) \
+  TRACE_RECORDER_QueueEvent(event, (pxQueue)->uxQueueNumber, \
+                            (pxQueue)->uxMessagesWaiting)
+#define traceQUEUE_SEND(pxQueue) \
+  TRACE_QUEUE_EVENT(TraceEvent_QueueSend, pxQueue)
+#define traceQUEUE_SEND_FROM_ISR(pxQueue) \
+  TRACE_QUEUE_EVENT(TraceEvent_QueueSend, pxQueue)
+#define traceQUEUE_SEND_FAILED(pxQueue) \
+  TRACE_QUEUE_EVENT(TraceEvent_QueueSendFailed, pxQueue)
+#define traceQUEUE_SEND_FROM_ISR_FAILED(pxQueue) \
+  TRACE_QUEUE_EVENT(TraceEvent_QueueSendFailed, pxQueue)
+#define traceBLOCKING_ON_QUEUE_SEND(pxQueue) \
+  TRACE_QUEUE_EVENT(TraceEvent_QueueSendBlock, pxQueue)
+#define traceQUEUE_RECEIVE(pxQueue) \
+  TRACE_QUEUE_EVENT(TraceEvent_QueueReceive, pxQueue)
+#define traceQUEUE_RECEIVE_FROM_ISR(pxQueue) \
+  TRACE_QUEUE_EVENT(TraceEvent_QueueReceive, pxQueue)
+#define traceQUEUE_RECEIVE_FAILED(pxQueue) \
+  TRACE_QUEUE_EVENT(TraceEvent_QueueReceiveFailed, pxQueue)
+#define traceQUEUE_RECEIVE_FROM_ISR_FAILED(pxQueue) \
+  TRACE_QUEUE_EVENT(TraceEvent_QueueReceiveFailed, pxQueue)
+#define traceBLOCKING_ON_QUEUE_RECEIVE(pxQueue) \
+  TRACE_QUEUE_EVENT(TraceEvent_QueueReceiveBlock, pxQueue)
 /* USER CODE END Defines */ 
 
 #endif /* FREERTOS_CONFIG_H */
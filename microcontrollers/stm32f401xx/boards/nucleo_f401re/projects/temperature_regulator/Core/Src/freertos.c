@@ -55,7 +55,12 @@
 
 /* Private application code --------------------------------------------------*/
 /* USER CODE BEGIN Application */
-     
+/* No RTOS object may use the heap, see configTOTAL_HEAP_SIZE. */
+void vApplicationMallocFailedHook(void)
+{
+  configASSERT(0);
+}
+
 /* USER CODE END Application */
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
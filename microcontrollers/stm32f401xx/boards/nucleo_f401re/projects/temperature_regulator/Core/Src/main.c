@@ -1,19 +1,22 @@
 #include "adc_temperature_regulator.h"
+#include "crc32.h"
 #include "dma.h"
+#include "dwt.h"
 #include "gpio.h"
 #include "idle_task.h"
 #include "led.h"
 #include "main.h"
 #include "rtc.h"
+#include "system_clock.h"
+#include "tim.h"
 #include "usart.h"
 
 #include "cmsis_os.h"
 
+#include "FreeRTOS.h"
+#include "task.h"
+
 #include "stm32f4xx_ll_bus.h"
-#include "stm32f4xx_ll_pwr.h"
-#include "stm32f4xx_ll_rcc.h"
-#include "stm32f4xx_ll_system.h"
-#include "stm32f4xx_ll_utils.h"
 
 
 
@@ -21,36 +24,51 @@
 /*                      RTOS VARIABLES DECLARATIONS                          */
 /*****************************************************************************/
 
+/*
+  Every task gets a static control block and stack, the RTOS heap is not
+  used (see configTOTAL_HEAP_SIZE). Stack sizes are in 32-bit words.
+*/
+static StaticTask_t IdleTaskControlBlock;
+static StackType_t IdleTaskStack[256];
+
 osThreadId_t IdleTaskHandle;
 const osThreadAttr_t IdleTaskAttributes = {
   .name = "IdleTask",
   .priority = (osPriority_t) osPriorityIdle,
-  .stack_size = 128 * 4
+  .cb_mem = &IdleTaskControlBlock,
+  .cb_size = sizeof(IdleTaskControlBlock),
+  .stack_mem = IdleTaskStack,
+  .stack_size = sizeof(IdleTaskStack)
 };
 
-osThreadId_t Led2TaskHandle;
-const osThreadAttr_t Led2TaskAttributes = {
-  .name = "Led2Task",
-  .priority = (osPriority_t)osPriorityNormal1,
-  .stack_size = 128 * 4
-};
 
 
+static StaticTask_t Dma2Usart1RxTaskControlBlock;
+static StackType_t Dma2Usart1RxTaskStack[256];
 
 osThreadId_t Dma2Usart1RxTaskHandle;
 const osThreadAttr_t Dma2Usart1RxAttributes = {
   .name = "Dma2Usart1RxTask",
   .priority = (osPriority_t)osPriorityNormal1,
-  .stack_size = 256 * 4
+  .cb_mem = &Dma2Usart1RxTaskControlBlock,
+  .cb_size = sizeof(Dma2Usart1RxTaskControlBlock),
+  .stack_mem = Dma2Usart1RxTaskStack,
+  .stack_size = sizeof(Dma2Usart1RxTaskStack)
 };
 
 
 
+static StaticTask_t Adc1TemperatureRegulatorTaskControlBlock;
+static StackType_t Adc1TemperatureRegulatorTaskStack[256];
+
 osThreadId_t Adc1TemperatureRegulatorTaskHandle;
 const osThreadAttr_t Adc1TemperatureRegulatorAttributes = {
   .name = "Adc1TemperatureRegulatorTask",
   .priority = (osPriority_t)osPriorityNormal2,
-  .stack_size = 256 * 4
+  .cb_mem = &Adc1TemperatureRegulatorTaskControlBlock,
+  .cb_size = sizeof(Adc1TemperatureRegulatorTaskControlBlock),
+  .stack_mem = Adc1TemperatureRegulatorTaskStack,
+  .stack_size = sizeof(Adc1TemperatureRegulatorTaskStack)
 };
 
 
@@ -62,7 +80,6 @@ const osThreadAttr_t Adc1TemperatureRegulatorAttributes = {
 static void HardwareInitialSetup(void);
 static void SYSCFG_PWR_Clock_Enable(void);
 static void NVIC_PendSV_SysTick_IRQn_Config(void);
-static void SystemClock_Config(void);
 static void ComponentsSetup(void);
 
 
@@ -79,13 +96,18 @@ int main(void)
   osKernelInitialize();
 
   IdleTaskHandle = osThreadNew(StartIdleTask, NULL, &IdleTaskAttributes);
-  Led2TaskHandle = osThreadNew(StartLed2Task, NULL, &Led2TaskAttributes);
   Dma2Usart1RxTaskHandle = osThreadNew(StartDma2Usart1RxTask, NULL, 
     &Dma2Usart1RxAttributes);
   Adc1TemperatureRegulatorTaskHandle =
   osThreadNew(StartAdc1TemperatureRegulatorTask, NULL,
     &Adc1TemperatureRegulatorAttributes);
 
+  IDLE_TASK_RegisterCommands(IdleTaskHandle);
+  LED2_RegisterCommands();
+  ADC1_TEMPERATURE_REGULATOR_RegisterCommands();
+
+  ADC1_TEMPERATURE_REGULATOR_RunConversionBenchmark();
+
   osKernelStart();
  
   while(1);
@@ -103,7 +125,8 @@ static void HardwareInitialSetup(void)
 {
   SYSCFG_PWR_Clock_Enable();
   NVIC_PendSV_SysTick_IRQn_Config();
-  SystemClock_Config();
+  SYSTEM_CLOCK_Config();
+  DWT_CycleCounter_Config();
 }
 
 
@@ -116,37 +139,6 @@ static void SYSCFG_PWR_Clock_Enable(void)
 
 
 
-static void SystemClock_Config(void)
-{
-  LL_FLASH_SetLatency(LL_FLASH_LATENCY_0);
-
-  if(LL_FLASH_GetLatency() != LL_FLASH_LATENCY_0) {
-    Error_Handler();  
-  }
-  LL_PWR_SetRegulVoltageScaling(LL_PWR_REGU_VOLTAGE_SCALE2);
-  LL_RCC_HSI_SetCalibTrimming(16);
-
-  LL_RCC_HSI_Enable();
-  while(LL_RCC_HSI_IsReady() != 1) {
-    ;
-  }
-
-  LL_RCC_SetAHBPrescaler(LL_RCC_SYSCLK_DIV_1);
-  LL_RCC_SetAPB1Prescaler(LL_RCC_APB1_DIV_1);
-  LL_RCC_SetAPB2Prescaler(LL_RCC_APB2_DIV_1);
-  LL_RCC_SetSysClkSource(LL_RCC_SYS_CLKSOURCE_HSI);
-
-  while(LL_RCC_GetSysClkSource() != LL_RCC_SYS_CLKSOURCE_STATUS_HSI) {
-    ;
-  }
-  
-  LL_Init1msTick(16000000);
-  LL_SetSystemCoreClock(16000000);
-  LL_RCC_SetTIMPrescaler(LL_RCC_TIM_PRESCALER_TWICE);
-}
-
-
-
 static void NVIC_PendSV_SysTick_IRQn_Config(void)
 {
   NVIC_SetPriorityGrouping(NVIC_PRIORITYGROUP_4);
@@ -166,18 +158,26 @@ static void ComponentsSetup(void)
   GPIOA_LED2_Config();
   GPIOA_USART1_TX_RX_Config();
 
+  TIM2_Clock_Config();
+  TIM3_Clock_Config();
+  LED2_Start();
+
   ADC1_TEMPERATURE_REGULATOR_Clock_Config();
   ADC1_TEMPERATURE_REGULATOR_Settings_Config();
 
   DMA2_Clock_Config();
+  ADC1_TEMPERATURE_REGULATOR_DMA_Config();
   DMA2_USART1_RX_Config();
   DMA2_USART1_TX_Config();
 
+  CRC32_Clock_Config();
+
   USART1_Clock_Config();
   USART1_TX_RX_Config();
 
   RTC_Clock_Config();
   RTC_InitialSettings_Config();
+  RTC_WakeupTimer_Config();
 }
 
 
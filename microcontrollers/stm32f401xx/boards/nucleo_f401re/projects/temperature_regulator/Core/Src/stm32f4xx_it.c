@@ -25,6 +25,17 @@
 #include "task.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "adc_temperature_regulator.h"
+#include "dma.h"
+#include "led.h"
+#include "trace_recorder.h"
+
+#include "stm32f4xx_ll_adc.h"
+#include "stm32f4xx_ll_dma.h"
+#include "stm32f4xx_ll_exti.h"
+#include "stm32f4xx_ll_rtc.h"
+#include "stm32f4xx_ll_tim.h"
+#include "stm32f4xx_ll_usart.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -180,6 +191,129 @@ void SysTick_Handler(void)
 /* please refer to the startup file (startup_stm32f4xx.s).                    */
 /******************************************************************************/
 
+/**
+  * @brief This function handles ADC1 global interrupt.
+  */
+void ADC_IRQHandler(void)
+{
+  /* USER CODE BEGIN ADC_IRQn 0 */
+  TRACE_RECORDER_IsrEnter();
+  if(LL_ADC_IsActiveFlag_AWD1(ADC1))
+  {
+    LL_ADC_ClearFlag_AWD1(ADC1);
+    ADC1_TEMPERATURE_REGULATOR_AnalogWatchdog_Callback();
+  }
+  TRACE_RECORDER_IsrExit();
+  /* USER CODE END ADC_IRQn 0 */
+}
+
+/**
+  * @brief This function handles TIM3 global interrupt.
+  */
+void TIM3_IRQHandler(void)
+{
+  /* USER CODE BEGIN TIM3_IRQn 0 */
+  TRACE_RECORDER_IsrEnter();
+  if(LL_TIM_IsActiveFlag_UPDATE(TIM3))
+  {
+    LL_TIM_ClearFlag_UPDATE(TIM3);
+    LED2_PatternTimer_Callback();
+  }
+  TRACE_RECORDER_IsrExit();
+  /* USER CODE END TIM3_IRQn 0 */
+}
+
+/**
+  * @brief This function handles USART1 global interrupt.
+  */
+void USART1_IRQHandler(void)
+{
+  /* USER CODE BEGIN USART1_IRQn 0 */
+  TRACE_RECORDER_IsrEnter();
+  if(LL_USART_IsEnabledIT_IDLE(USART1) && LL_USART_IsActiveFlag_IDLE(USART1))
+  {
+    LL_USART_ClearFlag_IDLE(USART1);
+    DMA2_USART1_RX_Callback();
+  }
+  TRACE_RECORDER_IsrExit();
+  /* USER CODE END USART1_IRQn 0 */
+}
+
+/**
+  * @brief This function handles DMA2 stream0 global interrupt.
+  */
+void DMA2_Stream0_IRQHandler(void)
+{
+  /* USER CODE BEGIN DMA2_Stream0_IRQn 0 */
+  TRACE_RECORDER_IsrEnter();
+  if(LL_DMA_IsActiveFlag_HT0(DMA2))
+  {
+    LL_DMA_ClearFlag_HT0(DMA2);
+    ADC1_TEMPERATURE_REGULATOR_DMA_HalfTransfer_Callback();
+  }
+  if(LL_DMA_IsActiveFlag_TC0(DMA2))
+  {
+    LL_DMA_ClearFlag_TC0(DMA2);
+    ADC1_TEMPERATURE_REGULATOR_DMA_TransferComplete_Callback();
+  }
+  TRACE_RECORDER_IsrExit();
+  /* USER CODE END DMA2_Stream0_IRQn 0 */
+}
+
+/**
+  * @brief This function handles DMA2 stream2 global interrupt.
+  */
+void DMA2_Stream2_IRQHandler(void)
+{
+  /* USER CODE BEGIN DMA2_Stream2_IRQn 0 */
+  TRACE_RECORDER_IsrEnter();
+  if(LL_DMA_IsActiveFlag_HT2(DMA2))
+  {
+    LL_DMA_ClearFlag_HT2(DMA2);
+    DMA2_USART1_RX_Callback();
+  }
+  if(LL_DMA_IsActiveFlag_TC2(DMA2))
+  {
+    LL_DMA_ClearFlag_TC2(DMA2);
+    DMA2_USART1_RX_TransferComplete_Callback();
+  }
+  TRACE_RECORDER_IsrExit();
+  /* USER CODE END DMA2_Stream2_IRQn 0 */
+}
+
+/**
+  * @brief This function handles DMA2 stream7 global interrupt.
+  */
+void DMA2_Stream7_IRQHandler(void)
+{
+  /* USER CODE BEGIN DMA2_Stream7_IRQn 0 */
+  TRACE_RECORDER_IsrEnter();
+  if(LL_DMA_IsActiveFlag_TC7(DMA2))
+  {
+    LL_DMA_ClearFlag_TC7(DMA2);
+  }
+  DMA2_USART1_TX_TransferComplete_Callback();
+  TRACE_RECORDER_IsrExit();
+  /* USER CODE END DMA2_Stream7_IRQn 0 */
+}
+
+/**
+  * @brief This function handles RTC wakeup interrupt through EXTI line 22.
+  */
+void RTC_WKUP_IRQHandler(void)
+{
+  /* USER CODE BEGIN RTC_WKUP_IRQn 0 */
+  TRACE_RECORDER_IsrEnter();
+  /* Only ends a tickless idle period, low_power.c measures the time. */
+  if(LL_RTC_IsActiveFlag_WUT(RTC))
+  {
+    LL_RTC_ClearFlag_WUT(RTC);
+  }
+  LL_EXTI_ClearFlag_0_31(LL_EXTI_LINE_22);
+  TRACE_RECORDER_IsrExit();
+  /* USER CODE END RTC_WKUP_IRQn 0 */
+}
+
 /* USER CODE BEGIN 1 */
 
 /* USER CODE END 1 */
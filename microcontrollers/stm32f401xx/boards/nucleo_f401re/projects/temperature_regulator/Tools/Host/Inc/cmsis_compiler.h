@@ -0,0 +1,155 @@
+#ifndef __CMSIS_COMPILER_H
+#define __CMSIS_COMPILER_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include "simulated_core.h"
+
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/*                            PUBLIC DEFINES                                 */
+/*****************************************************************************/
+
+/*
+  Stands in for CMSIS/Include/cmsis_compiler.h on the host target: same
+  guard, so the original is skipped, the same compiler keywords, and the
+  core register intrinsics the firmware uses go to the simulated core
+  instead of the Cortex-M4 instructions.
+*/
+#define __ASM                 __asm
+#define __INLINE              inline
+#define __STATIC_INLINE       static inline
+#define __STATIC_FORCEINLINE  __attribute__((always_inline)) static inline
+#define __NO_RETURN           __attribute__((__noreturn__))
+#define __USED                __attribute__((used))
+#define __WEAK                __attribute__((weak))
+#define __PACKED              __attribute__((packed, aligned(1)))
+#define __PACKED_STRUCT       struct __attribute__((packed, aligned(1)))
+#define __PACKED_UNION        union __attribute__((packed, aligned(1)))
+#define __ALIGNED(x)          __attribute__((aligned(x)))
+#define __RESTRICT            __restrict
+#define __COMPILER_BARRIER()  __asm volatile("" ::: "memory")
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+__STATIC_FORCEINLINE void __enable_irq(void)
+{
+  SIMULATED_CORE_SetPrimask(0);
+}
+
+
+
+__STATIC_FORCEINLINE void __disable_irq(void)
+{
+  SIMULATED_CORE_SetPrimask(1);
+}
+
+
+
+__STATIC_FORCEINLINE uint32_t __get_PRIMASK(void)
+{
+  return SIMULATED_CORE_GetPrimask();
+}
+
+
+
+__STATIC_FORCEINLINE void __set_PRIMASK(uint32_t priMask)
+{
+  SIMULATED_CORE_SetPrimask(priMask);
+}
+
+
+
+__STATIC_FORCEINLINE uint32_t __get_BASEPRI(void)
+{
+  return SIMULATED_CORE_GetBasepri();
+}
+
+
+
+__STATIC_FORCEINLINE void __set_BASEPRI(uint32_t basePri)
+{
+  SIMULATED_CORE_SetBasepri(basePri);
+}
+
+
+
+__STATIC_FORCEINLINE uint32_t __get_IPSR(void)
+{
+  return SIMULATED_CORE_GetIpsr();
+}
+
+
+
+__STATIC_FORCEINLINE void __WFI(void)
+{
+  SIMULATED_CORE_WaitForInterrupt();
+}
+
+
+
+__STATIC_FORCEINLINE void __DSB(void)
+{
+  __sync_synchronize();
+}
+
+
+
+__STATIC_FORCEINLINE void __ISB(void)
+{
+  __sync_synchronize();
+}
+
+
+
+__STATIC_FORCEINLINE void __DMB(void)
+{
+  __sync_synchronize();
+}
+
+
+
+__STATIC_FORCEINLINE void __NOP(void)
+{
+  __COMPILER_BARRIER();
+}
+
+
+
+__STATIC_FORCEINLINE uint8_t __CLZ(uint32_t value)
+{
+  return value == 0 ? 32U : (uint8_t)__builtin_clz(value);
+}
+
+
+
+__STATIC_FORCEINLINE uint32_t __RBIT(uint32_t value)
+{
+  uint32_t result = 0;
+
+  for(uint32_t bit = 0; bit < 32U; ++bit) {
+    result = (result << 1) | ((value >> bit) & 1U);
+  }
+
+  return result;
+}
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* __CMSIS_COMPILER_H */
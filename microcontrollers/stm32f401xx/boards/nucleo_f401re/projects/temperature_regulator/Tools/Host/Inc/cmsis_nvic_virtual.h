@@ -0,0 +1,26 @@
+#ifndef CMSIS_NVIC_VIRTUAL_H
+#define CMSIS_NVIC_VIRTUAL_H
+
+/*
+  Included by core_cm4.h with CMSIS_NVIC_VIRTUAL defined. Enabling and
+  pending interrupts is what the simulated core acts on, so those go to it.
+  Priorities and the priority grouping stay in the NVIC and SCB registers,
+  where the simulated core reads them.
+*/
+#define NVIC_SetPriorityGrouping    __NVIC_SetPriorityGrouping
+#define NVIC_GetPriorityGrouping    __NVIC_GetPriorityGrouping
+#define NVIC_EnableIRQ(IRQn)        SIMULATED_CORE_EnableIrq((int32_t)(IRQn))
+#define NVIC_GetEnableIRQ(IRQn)     SIMULATED_CORE_GetEnableIrq((int32_t)(IRQn))
+#define NVIC_DisableIRQ(IRQn)       SIMULATED_CORE_DisableIrq((int32_t)(IRQn))
+#define NVIC_GetPendingIRQ(IRQn)  \
+  SIMULATED_CORE_GetPendingIrq((int32_t)(IRQn))
+#define NVIC_SetPendingIRQ(IRQn)  \
+  SIMULATED_CORE_SetPendingIrq((int32_t)(IRQn))
+#define NVIC_ClearPendingIRQ(IRQn)  \
+  SIMULATED_CORE_ClearPendingIrq((int32_t)(IRQn))
+#define NVIC_GetActive(IRQn)        SIMULATED_CORE_GetActive((int32_t)(IRQn))
+#define NVIC_SetPriority            __NVIC_SetPriority
+#define NVIC_GetPriority            __NVIC_GetPriority
+#define NVIC_SystemReset            SIMULATED_CORE_SystemReset
+
+#endif  /* CMSIS_NVIC_VIRTUAL_H */
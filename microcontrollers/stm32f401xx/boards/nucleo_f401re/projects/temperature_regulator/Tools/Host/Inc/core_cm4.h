@@ -0,0 +1,15 @@
+#ifndef HOST_CORE_CM4_H
+#define HOST_CORE_CM4_H
+
+/*
+  The CMSIS core header of the board, with the compiler layer of the host
+  target and the NVIC functions routed to the simulated core. The register
+  structures and addresses stay the ones of the Cortex-M4.
+*/
+#include "cmsis_compiler.h"
+
+#define CMSIS_NVIC_VIRTUAL
+
+#include_next <core_cm4.h>
+
+#endif  /* HOST_CORE_CM4_H */
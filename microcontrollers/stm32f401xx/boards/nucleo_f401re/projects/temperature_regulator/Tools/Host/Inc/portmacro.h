@@ -0,0 +1,145 @@
+#ifndef PORTMACRO_H
+#define PORTMACRO_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include "simulated_core.h"
+
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/*                            PUBLIC DEFINES                                 */
+/*****************************************************************************/
+
+/*
+  The FreeRTOS port of the host target, in place of the GCC/ARM_CM4F one:
+  same types, same BASEPRI critical sections and the context switch in the
+  PendSV handler, on the simulated core. Every task runs on a thread of its
+  own and only the thread of the running task is let go (port.c).
+*/
+#define portCHAR        char
+#define portFLOAT       float
+#define portDOUBLE      double
+#define portLONG        long
+#define portSHORT       short
+#define portSTACK_TYPE  uint32_t
+#define portBASE_TYPE   long
+
+/* The kernel aligns the stacks and the heap through pointer casts. */
+#define portPOINTER_SIZE_TYPE uintptr_t
+
+typedef portSTACK_TYPE StackType_t;
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+
+#if(configUSE_16_BIT_TICKS == 1)
+  typedef uint16_t TickType_t;
+  #define portMAX_DELAY (TickType_t)0xffff
+#else
+  typedef uint32_t TickType_t;
+  #define portMAX_DELAY (TickType_t)0xffffffffUL
+  #define portTICK_TYPE_IS_ATOMIC 1
+#endif
+
+#define portSTACK_GROWTH    (-1)
+#define portTICK_PERIOD_MS  ((TickType_t)1000 / configTICK_RATE_HZ)
+#define portBYTE_ALIGNMENT  8
+
+/* PendSV_IRQn, the device header may not be included yet. */
+#define portPENDSV_IRQN     (-2)
+
+#define portYIELD()  SIMULATED_CORE_SetPendingIrq(portPENDSV_IRQN)
+#define portEND_SWITCHING_ISR(xSwitchRequired) \
+  if((xSwitchRequired) != pdFALSE) portYIELD()
+#define portYIELD_FROM_ISR(x) portEND_SWITCHING_ISR(x)
+
+#define portSET_INTERRUPT_MASK_FROM_ISR()     ulPortRaiseBASEPRI()
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR(x)  vPortSetBASEPRI(x)
+#define portDISABLE_INTERRUPTS()              vPortRaiseBASEPRI()
+#define portENABLE_INTERRUPTS()               vPortSetBASEPRI(0)
+#define portENTER_CRITICAL()                  vPortEnterCritical()
+#define portEXIT_CRITICAL()                   vPortExitCritical()
+
+#define portTASK_FUNCTION_PROTO(vFunction, pvParameters) \
+  void vFunction(void *pvParameters)
+#define portTASK_FUNCTION(vFunction, pvParameters) \
+  void vFunction(void *pvParameters)
+
+#ifndef portSUPPRESS_TICKS_AND_SLEEP
+  extern void vPortSuppressTicksAndSleep(TickType_t xExpectedIdleTime);
+  #define portSUPPRESS_TICKS_AND_SLEEP(xExpectedIdleTime) \
+    vPortSuppressTicksAndSleep(xExpectedIdleTime)
+#endif
+
+#ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
+  #define configUSE_PORT_OPTIMISED_TASK_SELECTION 0
+#endif
+
+#if configUSE_PORT_OPTIMISED_TASK_SELECTION == 1
+  #error "the host port has no optimised task selection"
+#endif
+
+#define portNOP()
+#define portINLINE              __inline
+#define portFORCE_INLINE        inline __attribute__((always_inline))
+#define portMEMORY_BARRIER()    __asm volatile("" ::: "memory")
+
+
+
+/*****************************************************************************/
+/*                      PUBLIC FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+extern void vPortEnterCritical(void);
+extern void vPortExitCritical(void);
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+portFORCE_INLINE static BaseType_t xPortIsInsideInterrupt(void)
+{
+  return SIMULATED_CORE_GetIpsr() != 0 ? 1 : 0;
+}
+
+
+
+portFORCE_INLINE static void vPortRaiseBASEPRI(void)
+{
+  SIMULATED_CORE_SetBasepri(configMAX_SYSCALL_INTERRUPT_PRIORITY);
+}
+
+
+
+portFORCE_INLINE static uint32_t ulPortRaiseBASEPRI(void)
+{
+  uint32_t ulOriginalBASEPRI = SIMULATED_CORE_GetBasepri();
+
+  SIMULATED_CORE_SetBasepri(configMAX_SYSCALL_INTERRUPT_PRIORITY);
+
+  return ulOriginalBASEPRI;
+}
+
+
+
+portFORCE_INLINE static void vPortSetBASEPRI(uint32_t ulNewMaskValue)
+{
+  SIMULATED_CORE_SetBasepri(ulNewMaskValue);
+}
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* PORTMACRO_H */
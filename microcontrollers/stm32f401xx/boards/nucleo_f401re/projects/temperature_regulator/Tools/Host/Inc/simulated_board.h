@@ -0,0 +1,73 @@
+#ifndef SIMULATED_BOARD_H
+#define SIMULATED_BOARD_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/*                            PUBLIC DEFINES                                 */
+/*****************************************************************************/
+
+/* Delivered every SIMULATED_BOARD_STEP_US to the thread owning the core. */
+#define SIMULATED_BOARD_STEP_SIGNAL SIGALRM
+#define SIMULATED_BOARD_STEP_US     100
+
+#define SIMULATED_BOARD_NEVER       UINT64_MAX
+#define NANOSECONDS_IN_SECOND       1000000000ULL
+
+
+
+/*****************************************************************************/
+/*                           PUBLIC STRUCTURES                               */
+/*****************************************************************************/
+
+/*
+  A counter clocked at frequencyHz from anchorTimeNs on, 0 Hz when stopped.
+  The frequency is rebased when it changes, so the ticks counted so far
+  are kept.
+*/
+typedef struct simulatedCounter {
+  uint64_t anchorTimeNs;
+  uint64_t anchorTicks;
+  uint32_t frequencyHz;
+}simulatedCounter_t;
+
+
+
+/*****************************************************************************/
+/*                      PUBLIC FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+void SIMULATED_BOARD_WriteRegister(volatile void *reg, uint32_t value,
+  uint32_t size);
+
+uint64_t SIMULATED_BOARD_GetTime(void);
+void SIMULATED_BOARD_Synchronize(void);
+void SIMULATED_BOARD_Lock(void);
+void SIMULATED_BOARD_Unlock(void);
+void SIMULATED_BOARD_Sleep(void);
+
+uint64_t SIMULATED_BOARD_GetCounterTicks(const simulatedCounter_t *counter,
+  uint64_t timeNs);
+uint64_t SIMULATED_BOARD_GetCounterTime(const simulatedCounter_t *counter,
+  uint64_t ticks);
+void SIMULATED_BOARD_SetCounterFrequency(simulatedCounter_t *counter,
+  uint64_t timeNs, uint32_t frequencyHz);
+void SIMULATED_BOARD_SetCounterTicks(simulatedCounter_t *counter,
+  uint64_t timeNs, uint64_t ticks);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* SIMULATED_BOARD_H */
@@ -0,0 +1,60 @@
+#ifndef SIMULATED_CORE_H
+#define SIMULATED_CORE_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/*                      PUBLIC FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+/*
+  The Cortex-M4 of the host target: interrupt masks, NVIC, exception entry,
+  SysTick and the DWT cycle counter. Interrupt numbers are IRQn_Type values,
+  PendSV and SysTick included, passed as int32_t since this header comes
+  before the device header.
+*/
+void SIMULATED_CORE_Reset(void);
+void SIMULATED_CORE_Advance(uint64_t timeNs);
+uint64_t SIMULATED_CORE_GetNextEventTime(void);
+
+uint32_t SIMULATED_CORE_GetPrimask(void);
+void SIMULATED_CORE_SetPrimask(uint32_t priMask);
+uint32_t SIMULATED_CORE_GetBasepri(void);
+void SIMULATED_CORE_SetBasepri(uint32_t basePri);
+uint32_t SIMULATED_CORE_GetIpsr(void);
+void SIMULATED_CORE_WaitForInterrupt(void);
+
+void SIMULATED_CORE_EnableIrq(int32_t irq);
+void SIMULATED_CORE_DisableIrq(int32_t irq);
+uint32_t SIMULATED_CORE_GetEnableIrq(int32_t irq);
+void SIMULATED_CORE_SetPendingIrq(int32_t irq);
+void SIMULATED_CORE_ClearPendingIrq(int32_t irq);
+uint32_t SIMULATED_CORE_GetPendingIrq(int32_t irq);
+uint32_t SIMULATED_CORE_GetActive(int32_t irq);
+void SIMULATED_CORE_RaiseIrq(int32_t irq);
+void SIMULATED_CORE_SystemReset(void) __attribute__((__noreturn__));
+
+void SIMULATED_CORE_TakeInterrupts(void);
+void SIMULATED_CORE_EnterThreadMode(void);
+int SIMULATED_CORE_IsWakeupPending(void);
+
+unsigned long SIMULATED_CORE_GetInterruptsCount(void);
+unsigned long SIMULATED_CORE_GetPendSvCount(void);
+unsigned long SIMULATED_CORE_GetSleepsCount(void);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* SIMULATED_CORE_H */
@@ -0,0 +1,121 @@
+#ifndef SIMULATED_PERIPHERALS_H
+#define SIMULATED_PERIPHERALS_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include "thermal_plant.h"
+
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/*                            PUBLIC DEFINES                                 */
+/*****************************************************************************/
+
+/* DMA2 streams serving the peripherals, as in the request map of RM0368. */
+#define SIMULATED_DMA2_STREAM_ADC1        0
+#define SIMULATED_DMA2_STREAM_USART1_RX   2
+#define SIMULATED_DMA2_STREAM_USART1_TX   7
+
+/* ADC_CR2 EXTSEL codes of the timer trigger outputs. */
+#define SIMULATED_ADC1_TRIGGER_TIM2_TRGO  6
+#define SIMULATED_ADC1_TRIGGER_TIM3_TRGO  8
+
+
+
+/*****************************************************************************/
+/*                           PUBLIC STRUCTURES                               */
+/*****************************************************************************/
+
+/* Derived from the RCC registers, 0 Hz for a clock that is off. */
+typedef struct simulatedClocks {
+  uint32_t hclkHz;
+  uint32_t pclk1Hz;
+  uint32_t pclk2Hz;
+  uint32_t apb1TimersHz;
+  uint32_t rtcHz;
+}simulatedClocks_t;
+
+
+
+typedef struct simulatedUsart1Statistics {
+  unsigned long rxBytesCount;
+  unsigned long rxOverrunsCount;
+  unsigned long txBytesCount;
+  unsigned long txDroppedBytesCount;
+}simulatedUsart1Statistics_t;
+
+
+
+/*****************************************************************************/
+/*                      PUBLIC FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+/*
+  Every model keeps its registers in the mapped register block. Write
+  functions get the register offset in the block and store the value with
+  the side effects of the hardware, Advance functions bring the model to
+  timeNs and GetNextEventTime returns when the next thing happens on its
+  own, SIMULATED_BOARD_NEVER for nothing.
+*/
+void SIMULATED_CLOCK_Reset(void);
+void SIMULATED_CLOCK_WriteRcc(uint32_t offset, uint32_t value);
+const simulatedClocks_t *SIMULATED_CLOCK_Get(void);
+
+void SIMULATED_TIMERS_Reset(void);
+void SIMULATED_TIMERS_WriteTim2(uint32_t offset, uint32_t value);
+void SIMULATED_TIMERS_WriteTim3(uint32_t offset, uint32_t value);
+void SIMULATED_TIMERS_Advance(uint64_t timeNs);
+uint64_t SIMULATED_TIMERS_GetNextEventTime(void);
+
+int SIMULATED_ADC1_Init(const thermalPlantParameters_t *parameters,
+  double adcNoise);
+void SIMULATED_ADC1_Reset(void);
+void SIMULATED_ADC1_Write(uint32_t offset, uint32_t value);
+void SIMULATED_ADC1_Advance(uint64_t timeNs);
+uint64_t SIMULATED_ADC1_GetNextEventTime(void);
+void SIMULATED_ADC1_Trigger(uint32_t externalTrigger);
+double SIMULATED_ADC1_GetTemperature(void);
+
+void SIMULATED_DMA2_Reset(void);
+void SIMULATED_DMA2_Write(uint32_t offset, uint32_t value);
+int SIMULATED_DMA2_WritePeripheralData(uint32_t stream, uint32_t data);
+int SIMULATED_DMA2_ReadPeripheralData(uint32_t stream, uint32_t *data);
+
+int SIMULATED_USART1_Open(uint32_t baudRate);
+void SIMULATED_USART1_Close(void);
+int SIMULATED_USART1_GetTerminalFd(void);
+void SIMULATED_USART1_Reset(void);
+void SIMULATED_USART1_Write(uint32_t offset, uint32_t value);
+void SIMULATED_USART1_Advance(uint64_t timeNs);
+uint64_t SIMULATED_USART1_GetNextEventTime(void);
+void SIMULATED_USART1_StartTransmission(void);
+const simulatedUsart1Statistics_t *SIMULATED_USART1_GetStatistics(void);
+
+void SIMULATED_RTC_Reset(void);
+void SIMULATED_RTC_ResetBackupDomain(void);
+void SIMULATED_RTC_Write(uint32_t offset, uint32_t value);
+void SIMULATED_RTC_WriteExti(uint32_t offset, uint32_t value);
+void SIMULATED_RTC_Advance(uint64_t timeNs);
+uint64_t SIMULATED_RTC_GetNextEventTime(void);
+
+void SIMULATED_GPIOA_Reset(void);
+void SIMULATED_GPIOA_Write(uint32_t offset, uint32_t value);
+int SIMULATED_GPIOA_IsHeaterOn(void);
+
+void SIMULATED_CRC_Reset(void);
+void SIMULATED_CRC_Write(uint32_t offset, uint32_t value);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* SIMULATED_PERIPHERALS_H */
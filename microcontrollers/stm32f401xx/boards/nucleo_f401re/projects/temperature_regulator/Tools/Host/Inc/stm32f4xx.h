@@ -0,0 +1,27 @@
+#ifndef HOST_STM32F4XX_H
+#define HOST_STM32F4XX_H
+
+/*
+  The device header of the board, with the register write macros routed
+  to the simulated peripherals. The LL drivers write every register through
+  them, so status flags, ready bits and started transfers follow right
+  away, as they do on the MCU. Reads stay plain memory reads: the register
+  blocks are mapped at their real addresses.
+*/
+#include_next <stm32f4xx.h>
+
+#include "simulated_board.h"
+
+#undef WRITE_REG
+#undef SET_BIT
+#undef CLEAR_BIT
+#undef MODIFY_REG
+
+#define WRITE_REG(REG, VAL)  \
+  SIMULATED_BOARD_WriteRegister(&(REG), (uint32_t)(VAL), sizeof(REG))
+#define SET_BIT(REG, BIT)    WRITE_REG((REG), READ_REG(REG) | (BIT))
+#define CLEAR_BIT(REG, BIT)  WRITE_REG((REG), READ_REG(REG) & ~(BIT))
+#define MODIFY_REG(REG, CLEARMASK, SETMASK)  \
+  WRITE_REG((REG), (READ_REG(REG) & ~(CLEARMASK)) | (SETMASK))
+
+#endif  /* HOST_STM32F4XX_H */
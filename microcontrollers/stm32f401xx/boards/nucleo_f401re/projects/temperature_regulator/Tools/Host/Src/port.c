@@ -0,0 +1,281 @@
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "simulated_board.h"
+#include "simulated_core.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+/* The SysTick and system handler priority registers of the ARM_CM4F port. */
+#define portNVIC_SYSTICK_CTRL_REG     (*((volatile uint32_t *)0xe000e010))
+#define portNVIC_SYSTICK_LOAD_REG     (*((volatile uint32_t *)0xe000e014))
+#define portNVIC_SYSTICK_CURRENT_VALUE_REG \
+  (*((volatile uint32_t *)0xe000e018))
+#define portNVIC_SYSPRI2_REG          (*((volatile uint32_t *)0xe000ed20))
+
+#define portNVIC_SYSTICK_CLK_BIT      (1UL << 2UL)
+#define portNVIC_SYSTICK_INT_BIT      (1UL << 1UL)
+#define portNVIC_SYSTICK_ENABLE_BIT   (1UL << 0UL)
+
+#define portNVIC_PENDSV_PRI  \
+  (((uint32_t)configKERNEL_INTERRUPT_PRIORITY) << 16UL)
+#define portNVIC_SYSTICK_PRI \
+  (((uint32_t)configKERNEL_INTERRUPT_PRIORITY) << 24UL)
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE STRUCTURES                              */
+/*****************************************************************************/
+
+/*
+  The thread of a task, kept at the top of the task stack and pointed to
+  by pxTopOfStack, the first member of the TCB. A thread runs while it owns
+  the core and waits on resume otherwise.
+*/
+typedef struct hostThread {
+  pthread_t thread;
+  sem_t resume;
+  TaskFunction_t code;
+  void *parameters;
+}hostThread_t;
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+/* Not 0 before the scheduler starts, as in the ARM_CM4F port. */
+static UBaseType_t uxCriticalNesting = 0xaaaaaaaa;
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+void vPortSetupTimerInterrupt(void);
+
+static void *ThreadEntry(void *argument);
+static hostThread_t *GetCurrentThread(void);
+static void BlockSteps(sigset_t *savedMask);
+static void WaitForResume(hostThread_t *thread);
+static void TaskExitError(void);
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+/*
+  The thread of the task is created here, blocked until the task is first
+  switched to. Only the top of the task stack holds anything: the task
+  runs on the stack of its thread, so the stack high water marks of the
+  kernel stay at the full stack size.
+*/
+StackType_t *pxPortInitialiseStack(StackType_t *pxTopOfStack,
+  TaskFunction_t pxCode, void *pvParameters)
+{
+  uintptr_t address = (uintptr_t)(pxTopOfStack + 1) - sizeof(hostThread_t);
+  hostThread_t *thread = (hostThread_t *)(address &
+    ~(uintptr_t)(portBYTE_ALIGNMENT - 1));
+
+  thread->code = pxCode;
+  thread->parameters = pvParameters;
+  sem_init(&thread->resume, 0, 0);
+
+  sigset_t savedMask;
+  BlockSteps(&savedMask);
+  int error = pthread_create(&thread->thread, NULL, ThreadEntry, thread);
+  pthread_sigmask(SIG_SETMASK, &savedMask, NULL);
+  if(error != 0) {
+    fprintf(stderr, "task thread: %d\n", error);
+    abort();
+  }
+
+  return (StackType_t *)thread;
+}
+
+
+
+/*
+  The thread calling vTaskStartScheduler() hands the core to the first
+  task and stays blocked for good.
+*/
+BaseType_t xPortStartScheduler(void)
+{
+  configASSERT(configMAX_SYSCALL_INTERRUPT_PRIORITY);
+
+  portNVIC_SYSPRI2_REG |= portNVIC_PENDSV_PRI;
+  portNVIC_SYSPRI2_REG |= portNVIC_SYSTICK_PRI;
+
+  vPortSetupTimerInterrupt();
+  uxCriticalNesting = 0;
+
+  sigset_t savedMask;
+  BlockSteps(&savedMask);
+  sem_post(&GetCurrentThread()->resume);
+  for(;;) {
+    pause();
+  }
+
+  return 0;
+}
+
+
+
+void vPortEndScheduler(void)
+{
+  configASSERT(uxCriticalNesting == 1000UL);
+}
+
+
+
+void vPortEnterCritical(void)
+{
+  portDISABLE_INTERRUPTS();
+  uxCriticalNesting++;
+
+  if(uxCriticalNesting == 1) {
+    configASSERT(xPortIsInsideInterrupt() == pdFALSE);
+  }
+}
+
+
+
+void vPortExitCritical(void)
+{
+  configASSERT(uxCriticalNesting);
+  uxCriticalNesting--;
+  if(uxCriticalNesting == 0) {
+    portENABLE_INTERRUPTS();
+  }
+}
+
+
+
+/*
+  The context switch: the next task is picked with the kernel interrupts
+  masked, then its thread is let go and this one waits until it is
+  switched back to, returning from the handler into its task.
+*/
+void xPortPendSVHandler(void)
+{
+  hostThread_t *currentThread = GetCurrentThread();
+
+  vPortRaiseBASEPRI();
+  vTaskSwitchContext();
+  vPortSetBASEPRI(0);
+
+  hostThread_t *nextThread = GetCurrentThread();
+  if(nextThread == currentThread) {
+    return;
+  }
+
+  sigset_t savedMask;
+  BlockSteps(&savedMask);
+  sem_post(&nextThread->resume);
+  WaitForResume(currentThread);
+  pthread_sigmask(SIG_SETMASK, &savedMask, NULL);
+}
+
+
+
+void xPortSysTickHandler(void)
+{
+  portDISABLE_INTERRUPTS();
+  if(xTaskIncrementTick() != pdFALSE) {
+    portYIELD();
+  }
+  portENABLE_INTERRUPTS();
+}
+
+
+
+/* One tick per configTICK_RATE_HZ of the core clock, as on the MCU. */
+__attribute__((weak)) void vPortSetupTimerInterrupt(void)
+{
+  portNVIC_SYSTICK_CTRL_REG = 0UL;
+  portNVIC_SYSTICK_CURRENT_VALUE_REG = 0UL;
+
+  portNVIC_SYSTICK_LOAD_REG = (configCPU_CLOCK_HZ / configTICK_RATE_HZ) - 1UL;
+  portNVIC_SYSTICK_CTRL_REG = portNVIC_SYSTICK_CLK_BIT |
+    portNVIC_SYSTICK_INT_BIT | portNVIC_SYSTICK_ENABLE_BIT;
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+/*
+  The exception return into a task run for the first time: thread mode,
+  nothing masked, and the steps delivered to this thread from now on.
+*/
+static void *ThreadEntry(void *argument)
+{
+  hostThread_t *thread = argument;
+
+  WaitForResume(thread);
+  SIMULATED_CORE_EnterThreadMode();
+
+  sigset_t stepSignal;
+  sigemptyset(&stepSignal);
+  sigaddset(&stepSignal, SIMULATED_BOARD_STEP_SIGNAL);
+  pthread_sigmask(SIG_UNBLOCK, &stepSignal, NULL);
+  SIMULATED_CORE_TakeInterrupts();
+
+  thread->code(thread->parameters);
+  TaskExitError();
+
+  return NULL;
+}
+
+
+
+static hostThread_t *GetCurrentThread(void)
+{
+  return *(hostThread_t **)xTaskGetCurrentTaskHandle();
+}
+
+
+
+static void BlockSteps(sigset_t *savedMask)
+{
+  sigset_t stepSignal;
+  sigemptyset(&stepSignal);
+  sigaddset(&stepSignal, SIMULATED_BOARD_STEP_SIGNAL);
+  pthread_sigmask(SIG_BLOCK, &stepSignal, savedMask);
+}
+
+
+
+static void WaitForResume(hostThread_t *thread)
+{
+  while(sem_wait(&thread->resume) != 0 && errno == EINTR) {
+  }
+}
+
+
+
+/* A task function must never return, see prvTaskExitError() of the port. */
+static void TaskExitError(void)
+{
+  fprintf(stderr, "task returned\n");
+  abort();
+}
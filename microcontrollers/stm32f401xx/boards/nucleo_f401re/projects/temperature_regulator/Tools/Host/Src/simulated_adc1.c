@@ -0,0 +1,194 @@
+#include "simulated_peripherals.h"
+
+#include "simulated_adc.h"
+#include "simulated_board.h"
+#include "simulated_core.h"
+
+#include "stm32f4xx.h"
+
+#include <stddef.h>
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define REGISTER(offset) (*(volatile uint32_t *)(ADC1_BASE + (offset)))
+
+/* Step of the plant, as in regulator_simulation.c. */
+#define PLANT_STEP_NS (10ULL * 1000000ULL)
+
+/* The thermistor divider of the board is on PA0, ADC1 channel 0. */
+#define THERMISTOR_CHANNEL 0U
+
+#define RESOLUTION_SHIFT(control1) \
+  (2U * (((control1) & ADC_CR1_RES) >> ADC_CR1_RES_Pos))
+#define LEFT_ALIGN_SHIFT 4U
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+static thermalPlant_t plant;
+static double noise;
+static uint64_t plantTimeNs;
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static void Convert(void);
+static void CheckAnalogWatchdog(uint32_t channel, uint32_t code);
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+/* The oven starts at the ambient temperature. */
+int SIMULATED_ADC1_Init(const thermalPlantParameters_t *parameters,
+  double adcNoise)
+{
+  noise = adcNoise;
+  plantTimeNs = 0;
+
+  return THERMAL_PLANT_Init(&plant, parameters,
+    (double)PLANT_STEP_NS / NANOSECONDS_IN_SECOND,
+    parameters->ambientTemperature);
+}
+
+
+
+void SIMULATED_ADC1_Reset(void)
+{
+  REGISTER(offsetof(ADC_TypeDef, HTR)) = ADC_HTR_HT;
+}
+
+
+
+/*
+  SWSTART converts right away, the conversions take no time. SR flags are
+  cleared by writing 0.
+*/
+void SIMULATED_ADC1_Write(uint32_t offset, uint32_t value)
+{
+  switch(offset) {
+    case offsetof(ADC_TypeDef, SR):
+      REGISTER(offset) &= value;
+      break;
+
+    case offsetof(ADC_TypeDef, CR2):
+      REGISTER(offset) = value & ~ADC_CR2_SWSTART;
+      if((value & (ADC_CR2_SWSTART | ADC_CR2_ADON)) ==
+        (ADC_CR2_SWSTART | ADC_CR2_ADON)) {
+        Convert();
+      }
+      break;
+
+    default:
+      REGISTER(offset) = value;
+      break;
+  }
+}
+
+
+
+/*
+  The plant catches up step by step. The heater only changes with a GPIOA
+  write, which brings every model to the time of the write first.
+*/
+void SIMULATED_ADC1_Advance(uint64_t timeNs)
+{
+  while(plantTimeNs + PLANT_STEP_NS <= timeNs) {
+    THERMAL_PLANT_Step(&plant, SIMULATED_GPIOA_IsHeaterOn() != 0 ? 1.0 : 0.0);
+    plantTimeNs += PLANT_STEP_NS;
+  }
+}
+
+
+
+uint64_t SIMULATED_ADC1_GetNextEventTime(void)
+{
+  return SIMULATED_BOARD_NEVER;
+}
+
+
+
+/* A timer trigger output, converted on the rising edge selected. */
+void SIMULATED_ADC1_Trigger(uint32_t externalTrigger)
+{
+  uint32_t control2 = REGISTER(offsetof(ADC_TypeDef, CR2));
+
+  if((control2 & ADC_CR2_ADON) != 0 && (control2 & ADC_CR2_EXTEN) != 0 &&
+    (control2 & ADC_CR2_EXTSEL) >> ADC_CR2_EXTSEL_Pos == externalTrigger) {
+    Convert();
+  }
+}
+
+
+
+double SIMULATED_ADC1_GetTemperature(void)
+{
+  return plant.temperature;
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+/*
+  The first rank of the regular sequence only, the other channels read 0.
+  The result goes to DR and, with DMA set, to DMA2 stream 0.
+*/
+static void Convert(void)
+{
+  uint32_t control1 = REGISTER(offsetof(ADC_TypeDef, CR1));
+  uint32_t control2 = REGISTER(offsetof(ADC_TypeDef, CR2));
+  uint32_t channel = REGISTER(offsetof(ADC_TypeDef, SQR3)) & ADC_SQR3_SQ1;
+
+  SIMULATED_ADC1_Advance(SIMULATED_BOARD_GetTime());
+  uint32_t code = 0;
+  if(channel == THERMISTOR_CHANNEL) {
+    code = SIMULATED_ADC_Convert(plant.temperature, noise);
+  }
+  code >>= RESOLUTION_SHIFT(control1);
+  CheckAnalogWatchdog(channel, code);
+
+  uint32_t data = (control2 & ADC_CR2_ALIGN) != 0 ?
+    code << LEFT_ALIGN_SHIFT : code;
+  REGISTER(offsetof(ADC_TypeDef, DR)) = data;
+  REGISTER(offsetof(ADC_TypeDef, SR)) |= ADC_SR_STRT | ADC_SR_EOC;
+
+  if((control2 & ADC_CR2_DMA) != 0) {
+    SIMULATED_DMA2_WritePeripheralData(SIMULATED_DMA2_STREAM_ADC1, data);
+  }
+}
+
+
+
+static void CheckAnalogWatchdog(uint32_t channel, uint32_t code)
+{
+  uint32_t control1 = REGISTER(offsetof(ADC_TypeDef, CR1));
+
+  if((control1 & ADC_CR1_AWDEN) == 0 || ((control1 & ADC_CR1_AWDSGL) != 0 &&
+    (control1 & ADC_CR1_AWDCH) != channel)) {
+    return;
+  }
+  if(code <= REGISTER(offsetof(ADC_TypeDef, HTR)) &&
+    code >= REGISTER(offsetof(ADC_TypeDef, LTR))) {
+    return;
+  }
+
+  REGISTER(offsetof(ADC_TypeDef, SR)) |= ADC_SR_AWD;
+  if((control1 & ADC_CR1_AWDIE) != 0) {
+    SIMULATED_CORE_RaiseIrq(ADC_IRQn);
+  }
+}
@@ -0,0 +1,660 @@
+/* MAP_FIXED_NOREPLACE, ppoll. */
+#define _GNU_SOURCE
+
+#include "simulated_board.h"
+
+#include "simulated_core.h"
+#include "simulated_peripherals.h"
+
+#include "stm32f4xx.h"
+
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+/* Plant of regulator_simulation.c, fitted to TemperatureSetPoint_50C. */
+#define AMBIENT_TEMPERATURE_DEFAULT 22.0
+#define HEATER_GAIN_DEFAULT         23.5
+#define TIME_CONSTANT_DEFAULT       1300.0
+#define DEAD_TIME_DEFAULT           15.0
+
+#define ADC_NOISE_DEFAULT 2.0
+#define SPEED_DEFAULT     1.0
+
+/* APB1/APB2 and AHB1 peripherals, then the private peripheral bus. */
+#define PERIPHERALS_SIZE        0x80000U
+#define PRIVATE_PERIPHERALS_BASE 0xE0000000U
+#define PRIVATE_PERIPHERALS_SIZE 0x100000U
+
+#define REGISTER_BLOCK_SIZE 0x400U
+
+/* Longest wait for the terminal, so a stop request is not missed. */
+#define TERMINAL_WAIT_MAX_NS 100000000ULL
+
+#define SECONDS_IN_HOUR 3600
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE STRUCTURES                              */
+/*****************************************************************************/
+
+typedef struct boardSettings {
+  thermalPlantParameters_t plant;
+  double hours;
+  double speed;
+  double adcNoise;
+  uint32_t baudRate;
+}boardSettings_t;
+
+
+
+/* A register block whose writes have side effects. */
+typedef struct registerBlock {
+  uintptr_t baseAddress;
+  void (*Write)(uint32_t offset, uint32_t value);
+}registerBlock_t;
+
+
+
+/* A model running on the virtual clock. */
+typedef struct clockedModel {
+  void (*Advance)(uint64_t timeNs);
+  uint64_t (*GetNextEventTime)(void);
+}clockedModel_t;
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+static const registerBlock_t REGISTER_BLOCKS[] = {
+  { TIM2_BASE,   SIMULATED_TIMERS_WriteTim2 },
+  { TIM3_BASE,   SIMULATED_TIMERS_WriteTim3 },
+  { RTC_BASE,    SIMULATED_RTC_Write },
+  { USART1_BASE, SIMULATED_USART1_Write },
+  { ADC1_BASE,   SIMULATED_ADC1_Write },
+  { EXTI_BASE,   SIMULATED_RTC_WriteExti },
+  { GPIOA_BASE,  SIMULATED_GPIOA_Write },
+  { CRC_BASE,    SIMULATED_CRC_Write },
+  { RCC_BASE,    SIMULATED_CLOCK_WriteRcc },
+  { DMA2_BASE,   SIMULATED_DMA2_Write }
+};
+
+static const clockedModel_t CLOCKED_MODELS[] = {
+  { SIMULATED_CORE_Advance,   SIMULATED_CORE_GetNextEventTime },
+  { SIMULATED_TIMERS_Advance, SIMULATED_TIMERS_GetNextEventTime },
+  { SIMULATED_ADC1_Advance,   SIMULATED_ADC1_GetNextEventTime },
+  { SIMULATED_USART1_Advance, SIMULATED_USART1_GetNextEventTime },
+  { SIMULATED_RTC_Advance,    SIMULATED_RTC_GetNextEventTime }
+};
+
+static boardSettings_t settings = {
+  .plant = {
+    .ambientTemperature  = AMBIENT_TEMPERATURE_DEFAULT,
+    .heaterGain          = HEATER_GAIN_DEFAULT,
+    .timeConstantSeconds = TIME_CONSTANT_DEFAULT,
+    .deadTimeSeconds     = DEAD_TIME_DEFAULT
+  },
+  .speed = SPEED_DEFAULT,
+  .adcNoise = ADC_NOISE_DEFAULT
+};
+
+static uint64_t timeNs;
+static uint64_t stopTimeNs = SIMULATED_BOARD_NEVER;
+static uint64_t startWallNs;
+static uint64_t lastStepWallNs;
+
+static volatile sig_atomic_t lockCount;
+static volatile sig_atomic_t isStepDeferred;
+static volatile sig_atomic_t isStopRequested;
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+int __real_main(void);
+
+static int ParseArguments(int argc, char *argv[]);
+static void PrintUsage(const char *programName);
+static int MapRegisterBlocks(void);
+static void ResetPeripherals(void);
+static int StartSteps(void);
+static void Step(void);
+static void StepHandler(int signalNumber);
+static void AdvanceTo(uint64_t targetNs);
+static void AdvanceModels(uint64_t eventTimeNs);
+static uint64_t GetNextEventTime(void);
+static void WaitForTerminal(uint64_t deadlineWallNs);
+static uint64_t GetAllowedTime(uint64_t wallNs);
+static uint64_t GetWallTime(void);
+static void StopWhenDone(void);
+static void PrintStatistics(void);
+static void RequestStop(int signalNumber);
+
+
+
+/*****************************************************************************/
+/*                                 MAIN                                      */
+/*****************************************************************************/
+
+/*
+  The firmware main() on a Linux host: Core/Src/main.c, the Components and
+  the FreeRTOS kernel run unchanged on the port of Tools/Host, against
+  simulated ADC1, GPIOA, TIM2/TIM3, DMA2, USART1, RTC, RCC and CRC register
+  blocks mapped at their real addresses. The heater relay drives the plant
+  of regulator_simulation.c, the thermistor input follows it and USART1 is
+  a pseudo-terminal, so telemetry_decoder and command_frame_encoder talk to
+  it as to the board. Time is virtual: code runs at the speed of the host,
+  sleeping jumps to the next event, -x times faster than the wall clock, 0
+  for as fast as the host allows. Runs -h hours of virtual time, or until
+  interrupted, and prints the statistics of the run.
+
+  Linked with -Wl,--wrap=main, the firmware main() becomes __real_main().
+*/
+int __wrap_main(int argc, char *argv[])
+{
+  if(ParseArguments(argc, argv) != 0) {
+    PrintUsage(argv[0]);
+    return EXIT_FAILURE;
+  }
+  if(settings.hours > 0.0) {
+    stopTimeNs = (uint64_t)(settings.hours * SECONDS_IN_HOUR *
+      NANOSECONDS_IN_SECOND);
+  }
+
+  if(MapRegisterBlocks() != 0) {
+    return EXIT_FAILURE;
+  }
+  if(SIMULATED_ADC1_Init(&settings.plant, settings.adcNoise) != 0) {
+    fprintf(stderr, "dead time too long\n");
+    return EXIT_FAILURE;
+  }
+  ResetPeripherals();
+  if(SIMULATED_USART1_Open(settings.baudRate) != 0) {
+    return EXIT_FAILURE;
+  }
+
+  signal(SIGINT, RequestStop);
+  signal(SIGTERM, RequestStop);
+  startWallNs = GetWallTime();
+  lastStepWallNs = startWallNs;
+  if(StartSteps() != 0) {
+    return EXIT_FAILURE;
+  }
+
+  SystemInit();
+  return __real_main();
+}
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+/*
+  Plain memory writes for the blocks without side effects. An interrupt
+  raised by the write is taken right after it.
+*/
+void SIMULATED_BOARD_WriteRegister(volatile void *reg, uint32_t value,
+  uint32_t size)
+{
+  uintptr_t address = (uintptr_t)reg;
+
+  for(size_t block = 0;
+    block < sizeof(REGISTER_BLOCKS) / sizeof(REGISTER_BLOCKS[0]); ++block) {
+    if(address - REGISTER_BLOCKS[block].baseAddress < REGISTER_BLOCK_SIZE) {
+      SIMULATED_BOARD_Lock();
+      REGISTER_BLOCKS[block].Write(
+        (uint32_t)(address - REGISTER_BLOCKS[block].baseAddress), value);
+      SIMULATED_BOARD_Unlock();
+      SIMULATED_CORE_TakeInterrupts();
+      return;
+    }
+  }
+
+  if(size == sizeof(uint8_t)) {
+    *(volatile uint8_t *)reg = (uint8_t)value;
+  } else if(size == sizeof(uint16_t)) {
+    *(volatile uint16_t *)reg = (uint16_t)value;
+  } else {
+    *(volatile uint32_t *)reg = value;
+  }
+}
+
+
+
+uint64_t SIMULATED_BOARD_GetTime(void)
+{
+  return timeNs;
+}
+
+
+
+/* Brings every model to now, before and after a clock tree change. */
+void SIMULATED_BOARD_Synchronize(void)
+{
+  AdvanceModels(timeNs);
+}
+
+
+
+/*
+  Held while the models run. A step falling inside is deferred to the
+  unlock, so the models never see each other half updated.
+*/
+void SIMULATED_BOARD_Lock(void)
+{
+  ++lockCount;
+  __atomic_signal_fence(__ATOMIC_SEQ_CST);
+}
+
+
+
+void SIMULATED_BOARD_Unlock(void)
+{
+  __atomic_signal_fence(__ATOMIC_SEQ_CST);
+  if(lockCount == 1 && isStepDeferred != 0) {
+    isStepDeferred = 0;
+    Step();
+    --lockCount;
+    SIMULATED_CORE_TakeInterrupts();
+    return;
+  }
+  --lockCount;
+}
+
+
+
+/*
+  The core waits for an interrupt, with the models locked and the steps
+  blocked. Once the time run since the last step is counted, virtual time
+  jumps from event to event until one of them wakes
+  the core. Throttled, the wait for the wall clock is spent polling the
+  terminal, so commands are taken as they come.
+*/
+void SIMULATED_BOARD_Sleep(void)
+{
+  Step();
+  while(SIMULATED_CORE_IsWakeupPending() == 0) {
+    StopWhenDone();
+
+    uint64_t eventNs = GetNextEventTime();
+    uint64_t targetNs = eventNs;
+    if(settings.speed > 0.0) {
+      if(eventNs > GetAllowedTime(GetWallTime())) {
+        WaitForTerminal(eventNs == SIMULATED_BOARD_NEVER ?
+          SIMULATED_BOARD_NEVER :
+          startWallNs + (uint64_t)(eventNs / settings.speed));
+        uint64_t allowedNs = GetAllowedTime(GetWallTime());
+        targetNs = eventNs < allowedNs ? eventNs : allowedNs;
+      }
+    } else if(eventNs == SIMULATED_BOARD_NEVER) {
+      WaitForTerminal(SIMULATED_BOARD_NEVER);
+      targetNs = timeNs;
+    }
+
+    AdvanceTo(targetNs > timeNs ? targetNs : timeNs);
+  }
+
+  lastStepWallNs = GetWallTime();
+}
+
+
+
+uint64_t SIMULATED_BOARD_GetCounterTicks(const simulatedCounter_t *counter,
+  uint64_t timeNs)
+{
+  if(timeNs <= counter->anchorTimeNs) {
+    return counter->anchorTicks;
+  }
+
+  return counter->anchorTicks + (uint64_t)(((unsigned __int128)
+    (timeNs - counter->anchorTimeNs) * counter->frequencyHz) /
+    NANOSECONDS_IN_SECOND);
+}
+
+
+
+/* First time the counter reaches ticks. */
+uint64_t SIMULATED_BOARD_GetCounterTime(const simulatedCounter_t *counter,
+  uint64_t ticks)
+{
+  if(ticks <= counter->anchorTicks) {
+    return counter->anchorTimeNs;
+  }
+  if(counter->frequencyHz == 0) {
+    return SIMULATED_BOARD_NEVER;
+  }
+
+  return counter->anchorTimeNs + (uint64_t)(((unsigned __int128)
+    (ticks - counter->anchorTicks) * NANOSECONDS_IN_SECOND +
+    counter->frequencyHz - 1) / counter->frequencyHz);
+}
+
+
+
+void SIMULATED_BOARD_SetCounterFrequency(simulatedCounter_t *counter,
+  uint64_t timeNs, uint32_t frequencyHz)
+{
+  if(frequencyHz == counter->frequencyHz) {
+    return;
+  }
+
+  SIMULATED_BOARD_SetCounterTicks(counter, timeNs,
+    SIMULATED_BOARD_GetCounterTicks(counter, timeNs));
+  counter->frequencyHz = frequencyHz;
+}
+
+
+
+void SIMULATED_BOARD_SetCounterTicks(simulatedCounter_t *counter,
+  uint64_t timeNs, uint64_t ticks)
+{
+  counter->anchorTimeNs = timeNs;
+  counter->anchorTicks = ticks;
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+static int ParseArguments(int argc, char *argv[])
+{
+  int option;
+
+  while((option = getopt(argc, argv, "h:x:n:b:")) != -1) {
+    switch(option) {
+      case 'h': settings.hours = atof(optarg); break;
+      case 'x': settings.speed = atof(optarg); break;
+      case 'n': settings.adcNoise = atof(optarg); break;
+      case 'b': settings.baudRate = (uint32_t)atol(optarg); break;
+      default: return -1;
+    }
+  }
+
+  if(settings.hours < 0.0 || settings.speed < 0.0 ||
+    settings.adcNoise < 0.0) {
+    return -1;
+  }
+
+  return 0;
+}
+
+
+
+static void PrintUsage(const char *programName)
+{
+  fprintf(stderr,
+    "usage: %s [-h hours, 0 until interrupted] [-x speed, 0 unthrottled]\n"
+    "       [-n ADC noise codes] [-b baud rate, 0 from USART1 BRR]\n",
+    programName);
+}
+
+
+
+/*
+  Built without PIE, so the firmware keeps its data below 4 GiB and the
+  32-bit DMA address registers can hold it.
+*/
+static int MapRegisterBlocks(void)
+{
+  static const struct {
+    uintptr_t baseAddress;
+    size_t size;
+  }REGIONS[] = {
+    { PERIPH_BASE,              PERIPHERALS_SIZE },
+    { PRIVATE_PERIPHERALS_BASE, PRIVATE_PERIPHERALS_SIZE }
+  };
+
+  for(size_t region = 0; region < sizeof(REGIONS) / sizeof(REGIONS[0]);
+    ++region) {
+    void *block = mmap((void *)REGIONS[region].baseAddress,
+      REGIONS[region].size, PROT_READ | PROT_WRITE,
+      MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    if(block != (void *)REGIONS[region].baseAddress) {
+      perror("register blocks");
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+
+
+static void ResetPeripherals(void)
+{
+  SIMULATED_CORE_Reset();
+  SIMULATED_CLOCK_Reset();
+  SIMULATED_TIMERS_Reset();
+  SIMULATED_ADC1_Reset();
+  SIMULATED_DMA2_Reset();
+  SIMULATED_USART1_Reset();
+  SIMULATED_RTC_Reset();
+  SIMULATED_GPIOA_Reset();
+  SIMULATED_CRC_Reset();
+
+  PWR->CSR = PWR_CSR_VOSRDY;
+}
+
+
+
+/*
+  Every thread but the one owning the core blocks the step signal, so the
+  steps always interrupt the code that runs.
+*/
+static int StartSteps(void)
+{
+  struct sigaction action = {
+    .sa_handler = StepHandler,
+    .sa_flags = SA_RESTART
+  };
+  sigemptyset(&action.sa_mask);
+
+  struct itimerval period = {
+    .it_interval = { .tv_usec = SIMULATED_BOARD_STEP_US },
+    .it_value = { .tv_usec = SIMULATED_BOARD_STEP_US }
+  };
+
+  if(sigaction(SIMULATED_BOARD_STEP_SIGNAL, &action, NULL) != 0 ||
+    setitimer(ITIMER_REAL, &period, NULL) != 0) {
+    perror("steps");
+    return -1;
+  }
+
+  return 0;
+}
+
+
+
+/*
+  Running code takes as long in virtual time as on the host, only capped
+  to the wall clock when slowed down.
+*/
+static void Step(void)
+{
+  uint64_t wallNs = GetWallTime();
+  uint64_t targetNs = timeNs + (wallNs - lastStepWallNs);
+
+  lastStepWallNs = wallNs;
+  if(settings.speed > 0.0 && settings.speed < 1.0) {
+    uint64_t allowedNs = GetAllowedTime(wallNs);
+    if(targetNs > allowedNs) {
+      targetNs = allowedNs > timeNs ? allowedNs : timeNs;
+    }
+  }
+
+  AdvanceTo(targetNs);
+  StopWhenDone();
+}
+
+
+
+static void StepHandler(int signalNumber)
+{
+  int savedErrno = errno;
+  (void)signalNumber;
+
+  if(lockCount != 0) {
+    isStepDeferred = 1;
+  } else {
+    SIMULATED_BOARD_Lock();
+    Step();
+    SIMULATED_BOARD_Unlock();
+    SIMULATED_CORE_TakeInterrupts();
+  }
+
+  errno = savedErrno;
+}
+
+
+
+static void AdvanceTo(uint64_t targetNs)
+{
+  uint64_t eventNs;
+
+  while((eventNs = GetNextEventTime()) <= targetNs) {
+    if(eventNs > timeNs) {
+      timeNs = eventNs;
+    }
+    AdvanceModels(timeNs);
+  }
+
+  if(targetNs > timeNs) {
+    timeNs = targetNs;
+  }
+  AdvanceModels(timeNs);
+}
+
+
+
+static void AdvanceModels(uint64_t eventTimeNs)
+{
+  for(size_t model = 0;
+    model < sizeof(CLOCKED_MODELS) / sizeof(CLOCKED_MODELS[0]); ++model) {
+    CLOCKED_MODELS[model].Advance(eventTimeNs);
+  }
+}
+
+
+
+static uint64_t GetNextEventTime(void)
+{
+  uint64_t nextEventNs = SIMULATED_BOARD_NEVER;
+
+  for(size_t model = 0;
+    model < sizeof(CLOCKED_MODELS) / sizeof(CLOCKED_MODELS[0]); ++model) {
+    uint64_t eventNs = CLOCKED_MODELS[model].GetNextEventTime();
+    if(eventNs < nextEventNs) {
+      nextEventNs = eventNs;
+    }
+  }
+
+  return nextEventNs;
+}
+
+
+
+static void WaitForTerminal(uint64_t deadlineWallNs)
+{
+  uint64_t wallNs = GetWallTime();
+  if(deadlineWallNs <= wallNs) {
+    return;
+  }
+
+  uint64_t waitNs = deadlineWallNs - wallNs;
+  if(waitNs > TERMINAL_WAIT_MAX_NS) {
+    waitNs = TERMINAL_WAIT_MAX_NS;
+  }
+  struct timespec timeout = {
+    .tv_sec = (time_t)(waitNs / NANOSECONDS_IN_SECOND),
+    .tv_nsec = (long)(waitNs % NANOSECONDS_IN_SECOND)
+  };
+  struct pollfd pollFd = {
+    .fd = SIMULATED_USART1_GetTerminalFd(),
+    .events = POLLIN
+  };
+
+  (void)ppoll(&pollFd, pollFd.fd >= 0 ? 1 : 0, &timeout, NULL);
+}
+
+
+
+static uint64_t GetAllowedTime(uint64_t wallNs)
+{
+  return (uint64_t)((double)(wallNs - startWallNs) * settings.speed);
+}
+
+
+
+static uint64_t GetWallTime(void)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+
+  return (uint64_t)now.tv_sec * NANOSECONDS_IN_SECOND +
+    (uint64_t)now.tv_nsec;
+}
+
+
+
+static void StopWhenDone(void)
+{
+  if(isStopRequested == 0 && timeNs < stopTimeNs) {
+    return;
+  }
+
+  SIMULATED_USART1_Close();
+  PrintStatistics();
+  exit(EXIT_SUCCESS);
+}
+
+
+
+static void PrintStatistics(void)
+{
+  const simulatedUsart1Statistics_t *usart1 =
+    SIMULATED_USART1_GetStatistics();
+  double virtualSeconds = (double)timeNs / NANOSECONDS_IN_SECOND;
+  double wallSeconds =
+    (double)(GetWallTime() - startWallNs) / NANOSECONDS_IN_SECOND;
+
+  fprintf(stderr, "simulated          %.0f s in %.2f s (x%.0f)\n",
+    virtualSeconds, wallSeconds, virtualSeconds / wallSeconds);
+  fprintf(stderr, "core               %lu interrupts, %lu PendSV, %lu "
+    "sleeps\n", SIMULATED_CORE_GetInterruptsCount(),
+    SIMULATED_CORE_GetPendSvCount(),
+    SIMULATED_CORE_GetSleepsCount());
+  fprintf(stderr, "USART1             RX %lu bytes, %lu overruns, TX %lu "
+    "bytes, %lu dropped\n", usart1->rxBytesCount, usart1->rxOverrunsCount,
+    usart1->txBytesCount, usart1->txDroppedBytesCount);
+  fprintf(stderr, "oven               %.1f C\n",
+    SIMULATED_ADC1_GetTemperature());
+}
+
+
+
+static void RequestStop(int signalNumber)
+{
+  (void)signalNumber;
+  isStopRequested = 1;
+}
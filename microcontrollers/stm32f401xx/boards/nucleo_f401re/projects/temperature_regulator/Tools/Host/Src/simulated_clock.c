@@ -0,0 +1,164 @@
+#include "simulated_peripherals.h"
+
+#include "simulated_board.h"
+
+#include "stm32f4xx.h"
+
+#include "stm32f4xx_ll_rcc.h"
+
+#include <stddef.h>
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define REGISTER(offset) (*(volatile uint32_t *)(RCC_BASE + (offset)))
+
+#define RCC_CR_RESET       0x00000083U
+#define RCC_PLLCFGR_RESET  0x24003010U
+
+/* The oscillators start at once, their ready flags follow their enables. */
+#define CR_READY_BITS \
+  (RCC_CR_HSIRDY | RCC_CR_HSERDY | RCC_CR_PLLRDY | RCC_CR_PLLI2SRDY)
+
+#define RTC_CLOCK_HZ LSE_VALUE
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+static simulatedClocks_t clocks;
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static uint32_t UpdateReadyFlags(uint32_t offset, uint32_t value);
+static void UpdateClocks(void);
+static uint32_t GetApb1TimersFrequency(const LL_RCC_ClocksTypeDef *rcc);
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+void SIMULATED_CLOCK_Reset(void)
+{
+  REGISTER(offsetof(RCC_TypeDef, CR)) = RCC_CR_RESET;
+  REGISTER(offsetof(RCC_TypeDef, PLLCFGR)) = RCC_PLLCFGR_RESET;
+  UpdateClocks();
+}
+
+
+
+/*
+  Every model runs to now on the clocks of before the write, and on the new
+  ones from there on.
+*/
+void SIMULATED_CLOCK_WriteRcc(uint32_t offset, uint32_t value)
+{
+  SIMULATED_BOARD_Synchronize();
+  REGISTER(offset) = UpdateReadyFlags(offset, value);
+  UpdateClocks();
+  SIMULATED_BOARD_Synchronize();
+}
+
+
+
+const simulatedClocks_t *SIMULATED_CLOCK_Get(void)
+{
+  return &clocks;
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+/*
+  A backup domain reset clears the RTC, its clock selection included, but
+  leaves the LSE running: rtc.c enables the LSE before finding the RTC on
+  another clock, and does not enable it again after the reset.
+*/
+static uint32_t UpdateReadyFlags(uint32_t offset, uint32_t value)
+{
+  switch(offset) {
+    case offsetof(RCC_TypeDef, CR):
+      value &= ~CR_READY_BITS;
+      value |= (value & (RCC_CR_HSION | RCC_CR_HSEON | RCC_CR_PLLON |
+        RCC_CR_PLLI2SON)) << 1U;
+      break;
+
+    case offsetof(RCC_TypeDef, CFGR):
+      value &= ~RCC_CFGR_SWS;
+      value |= (value & RCC_CFGR_SW) << RCC_CFGR_SWS_Pos;
+      break;
+
+    case offsetof(RCC_TypeDef, BDCR):
+      if((value & RCC_BDCR_BDRST) != 0) {
+        SIMULATED_RTC_ResetBackupDomain();
+        value &= ~(RCC_BDCR_RTCSEL | RCC_BDCR_RTCEN);
+      }
+      value &= ~RCC_BDCR_LSERDY;
+      value |= (value & RCC_BDCR_LSEON) << 1U;
+      break;
+
+    case offsetof(RCC_TypeDef, CSR):
+      value &= ~RCC_CSR_LSIRDY;
+      value |= (value & RCC_CSR_LSION) << 1U;
+      break;
+
+    default:
+      break;
+  }
+
+  return value;
+}
+
+
+
+static void UpdateClocks(void)
+{
+  LL_RCC_ClocksTypeDef rcc;
+  LL_RCC_GetSystemClocksFreq(&rcc);
+
+  clocks.hclkHz = rcc.HCLK_Frequency;
+  clocks.pclk1Hz = rcc.PCLK1_Frequency;
+  clocks.pclk2Hz = rcc.PCLK2_Frequency;
+  clocks.apb1TimersHz = GetApb1TimersFrequency(&rcc);
+
+  uint32_t backupDomain = REGISTER(offsetof(RCC_TypeDef, BDCR));
+  clocks.rtcHz = (backupDomain & RCC_BDCR_LSERDY) != 0 &&
+    (backupDomain & RCC_BDCR_RTCEN) != 0 &&
+    (backupDomain & RCC_BDCR_RTCSEL) == RCC_BDCR_RTCSEL_0 ? RTC_CLOCK_HZ : 0;
+}
+
+
+
+/*
+  RM0368 6.2: twice PCLK1 with an APB1 prescaler, up to four times it with
+  TIMPRE set, never above HCLK.
+*/
+static uint32_t GetApb1TimersFrequency(const LL_RCC_ClocksTypeDef *rcc)
+{
+  uint32_t apb1Prescaler =
+    REGISTER(offsetof(RCC_TypeDef, CFGR)) & RCC_CFGR_PPRE1;
+
+  if((REGISTER(offsetof(RCC_TypeDef, DCKCFGR)) & RCC_DCKCFGR_TIMPRE) == 0) {
+    return apb1Prescaler == RCC_CFGR_PPRE1_DIV1 ?
+      rcc->PCLK1_Frequency : 2U * rcc->PCLK1_Frequency;
+  }
+
+  return apb1Prescaler == RCC_CFGR_PPRE1_DIV1 ||
+    apb1Prescaler == RCC_CFGR_PPRE1_DIV2 ||
+    apb1Prescaler == RCC_CFGR_PPRE1_DIV4 ?
+    rcc->HCLK_Frequency : 4U * rcc->PCLK1_Frequency;
+}
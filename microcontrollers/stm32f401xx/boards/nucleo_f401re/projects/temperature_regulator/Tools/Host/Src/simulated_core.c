@@ -0,0 +1,534 @@
+#include "simulated_core.h"
+
+#include "simulated_board.h"
+#include "simulated_peripherals.h"
+
+#include "stm32f4xx.h"
+#include "stm32f4xx_it.h"
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+/* Exception numbers: IRQn + 16, the IPSR value of the handler. */
+#define EXCEPTIONS_COUNT   (16 + SPI4_IRQn + 1)
+#define EXCEPTION(IRQn)    ((uint32_t)((IRQn) + 16))
+#define FIRST_EXCEPTION    EXCEPTION(MemoryManagement_IRQn)
+
+/* Below every exception priority: the core runs a thread. */
+#define THREAD_PRIORITY    0x100U
+#define PRIORITY_MASK      ((0xFFU << (8U - __NVIC_PRIO_BITS)) & 0xFFU)
+
+/* Reset values of the Cortex-M4 r0p1 of the STM32F401. */
+#define CPUID_RESET        0x410FC241U
+#define AIRCR_RESET        0xFA050000U
+#define FPCCR_RESET        (FPU_FPCCR_ASPEN_Msk | FPU_FPCCR_LSPEN_Msk)
+#define DWT_CTRL_RESET     (4U << DWT_CTRL_NUMCOMP_Pos)
+
+#define SYSTICK_VALUE_MAX  SysTick_LOAD_RELOAD_Msk
+#define SYSTICK_DIVIDER    8U
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+/* The FreeRTOS port's, stm32f4xx_it.h leaves it out. */
+void PendSV_Handler(void);
+
+static void (*const VECTORS[EXCEPTIONS_COUNT])(void) = {
+  [EXCEPTION(PendSV_IRQn)]        = PendSV_Handler,
+  [EXCEPTION(SysTick_IRQn)]       = SysTick_Handler,
+  [EXCEPTION(RTC_WKUP_IRQn)]      = RTC_WKUP_IRQHandler,
+  [EXCEPTION(ADC_IRQn)]           = ADC_IRQHandler,
+  [EXCEPTION(TIM3_IRQn)]          = TIM3_IRQHandler,
+  [EXCEPTION(USART1_IRQn)]        = USART1_IRQHandler,
+  [EXCEPTION(DMA2_Stream0_IRQn)]  = DMA2_Stream0_IRQHandler,
+  [EXCEPTION(DMA2_Stream2_IRQn)]  = DMA2_Stream2_IRQHandler,
+  [EXCEPTION(DMA2_Stream7_IRQn)]  = DMA2_Stream7_IRQHandler
+};
+
+static volatile uint8_t isExceptionPending[EXCEPTIONS_COUNT];
+static volatile uint8_t isExceptionEnabled[EXCEPTIONS_COUNT];
+
+static volatile uint32_t priMask;
+static volatile uint32_t basePri;
+static volatile uint32_t ipsr;
+static volatile uint32_t activePriority = THREAD_PRIORITY;
+static volatile uint32_t isSleeping;
+
+static simulatedCounter_t sysTickCounter;
+static uint64_t sysTickZeroTicks = SIMULATED_BOARD_NEVER;
+static uint32_t sysTickLatchedLoad;
+static uint32_t sysTickShadowCtrl;
+static uint32_t sysTickShadowValue;
+
+static simulatedCounter_t cycleCounter;
+static uint32_t shadowCycleCount;
+
+static unsigned long interruptsCount;
+static unsigned long pendSvCount;
+static unsigned long sleepsCount;
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static uint32_t SelectException(uint32_t isPriMaskIgnored);
+static uint32_t GetGroupPriority(uint32_t exception);
+static void AdvanceSysTick(uint64_t timeNs);
+static void AdvanceCycleCounter(uint64_t timeNs);
+static void UpdateInterruptControl(void);
+static void SetPending(uint32_t exception, uint32_t isPending);
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+void SIMULATED_CORE_Reset(void)
+{
+  *(volatile uint32_t *)&SCB->CPUID = CPUID_RESET;
+  SCB->AIRCR = AIRCR_RESET;
+  FPU->FPCCR = FPCCR_RESET;
+  DWT->CTRL = DWT_CTRL_RESET;
+
+  priMask = 0;
+  basePri = 0;
+  ipsr = 0;
+  activePriority = THREAD_PRIORITY;
+}
+
+
+
+void SIMULATED_CORE_Advance(uint64_t timeNs)
+{
+  AdvanceSysTick(timeNs);
+  AdvanceCycleCounter(timeNs);
+  UpdateInterruptControl();
+}
+
+
+
+uint64_t SIMULATED_CORE_GetNextEventTime(void)
+{
+  if((SysTick->CTRL & SysTick_CTRL_TICKINT_Msk) == 0) {
+    return SIMULATED_BOARD_NEVER;
+  }
+
+  return SIMULATED_BOARD_GetCounterTime(&sysTickCounter, sysTickZeroTicks);
+}
+
+
+
+uint32_t SIMULATED_CORE_GetPrimask(void)
+{
+  return priMask;
+}
+
+
+
+void SIMULATED_CORE_SetPrimask(uint32_t newPriMask)
+{
+  priMask = newPriMask & 1U;
+  __atomic_signal_fence(__ATOMIC_SEQ_CST);
+  if(priMask == 0) {
+    SIMULATED_CORE_TakeInterrupts();
+  }
+}
+
+
+
+uint32_t SIMULATED_CORE_GetBasepri(void)
+{
+  return basePri;
+}
+
+
+
+void SIMULATED_CORE_SetBasepri(uint32_t newBasePri)
+{
+  uint32_t oldBasePri = basePri;
+
+  basePri = newBasePri & PRIORITY_MASK;
+  __atomic_signal_fence(__ATOMIC_SEQ_CST);
+  if(basePri == 0 || (oldBasePri != 0 && basePri > oldBasePri)) {
+    SIMULATED_CORE_TakeInterrupts();
+  }
+}
+
+
+
+uint32_t SIMULATED_CORE_GetIpsr(void)
+{
+  return ipsr;
+}
+
+
+
+/*
+  The core clock, and with it the cycle counter, stops until an interrupt
+  that could preempt the running code is pending, PRIMASK or not.
+*/
+void SIMULATED_CORE_WaitForInterrupt(void)
+{
+  sigset_t stepSignal, savedMask;
+  sigemptyset(&stepSignal);
+  sigaddset(&stepSignal, SIMULATED_BOARD_STEP_SIGNAL);
+  pthread_sigmask(SIG_BLOCK, &stepSignal, &savedMask);
+
+  SIMULATED_BOARD_Lock();
+  ++sleepsCount;
+  AdvanceCycleCounter(SIMULATED_BOARD_GetTime());
+  isSleeping = 1;
+  SIMULATED_BOARD_Sleep();
+  isSleeping = 0;
+  AdvanceCycleCounter(SIMULATED_BOARD_GetTime());
+  SIMULATED_BOARD_Unlock();
+
+  pthread_sigmask(SIG_SETMASK, &savedMask, NULL);
+  SIMULATED_CORE_TakeInterrupts();
+}
+
+
+
+void SIMULATED_CORE_EnableIrq(int32_t irq)
+{
+  if(irq >= 0) {
+    isExceptionEnabled[EXCEPTION(irq)] = 1;
+    SIMULATED_CORE_TakeInterrupts();
+  }
+}
+
+
+
+void SIMULATED_CORE_DisableIrq(int32_t irq)
+{
+  if(irq >= 0) {
+    isExceptionEnabled[EXCEPTION(irq)] = 0;
+  }
+}
+
+
+
+uint32_t SIMULATED_CORE_GetEnableIrq(int32_t irq)
+{
+  return irq >= 0 ? isExceptionEnabled[EXCEPTION(irq)] : 0;
+}
+
+
+
+/* From the running code, the interrupt is taken right away if it can be. */
+void SIMULATED_CORE_SetPendingIrq(int32_t irq)
+{
+  SIMULATED_BOARD_Lock();
+  SetPending(EXCEPTION(irq), 1);
+  SIMULATED_BOARD_Unlock();
+  SIMULATED_CORE_TakeInterrupts();
+}
+
+
+
+void SIMULATED_CORE_ClearPendingIrq(int32_t irq)
+{
+  SIMULATED_BOARD_Lock();
+  SetPending(EXCEPTION(irq), 0);
+  SIMULATED_BOARD_Unlock();
+}
+
+
+
+uint32_t SIMULATED_CORE_GetPendingIrq(int32_t irq)
+{
+  return isExceptionPending[EXCEPTION(irq)];
+}
+
+
+
+uint32_t SIMULATED_CORE_GetActive(int32_t irq)
+{
+  return ipsr == EXCEPTION(irq);
+}
+
+
+
+/*
+  From the models, with the models locked: the interrupt is taken once
+  they are unlocked.
+*/
+void SIMULATED_CORE_RaiseIrq(int32_t irq)
+{
+  SetPending(EXCEPTION(irq), 1);
+}
+
+
+
+void SIMULATED_CORE_SystemReset(void)
+{
+  fprintf(stderr, "system reset requested\n");
+  exit(EXIT_FAILURE);
+}
+
+
+
+/*
+  Exception entry: the pending exception of highest priority runs, on the
+  thread owning the core, if the masks and the priority of what runs allow
+  it. Handlers nest by priority, PendSV only preempts threads.
+*/
+void SIMULATED_CORE_TakeInterrupts(void)
+{
+  for(;;) {
+    SIMULATED_BOARD_Lock();
+    uint32_t exception = SelectException(0);
+    uint32_t interruptedIpsr = ipsr;
+    uint32_t interruptedPriority = activePriority;
+    if(exception != 0) {
+      SetPending(exception, 0);
+      if(exception == EXCEPTION(PendSV_IRQn)) {
+        ++pendSvCount;
+      } else {
+        ++interruptsCount;
+      }
+      ipsr = exception;
+      activePriority = GetGroupPriority(exception);
+    }
+    SIMULATED_BOARD_Unlock();
+
+    if(exception == 0) {
+      return;
+    }
+    if(VECTORS[exception] == NULL) {
+      fprintf(stderr, "no handler for exception %u\n", exception);
+      abort();
+    }
+
+    VECTORS[exception]();
+
+    ipsr = interruptedIpsr;
+    activePriority = interruptedPriority;
+    __atomic_signal_fence(__ATOMIC_SEQ_CST);
+  }
+}
+
+
+
+/*
+  Exception return into a task run for the first time, its thread having
+  been started from the PendSV handler of another one.
+*/
+void SIMULATED_CORE_EnterThreadMode(void)
+{
+  priMask = 0;
+  basePri = 0;
+  ipsr = 0;
+  activePriority = THREAD_PRIORITY;
+}
+
+
+
+int SIMULATED_CORE_IsWakeupPending(void)
+{
+  return SelectException(1) != 0;
+}
+
+
+
+unsigned long SIMULATED_CORE_GetInterruptsCount(void)
+{
+  return interruptsCount;
+}
+
+
+
+unsigned long SIMULATED_CORE_GetPendSvCount(void)
+{
+  return pendSvCount;
+}
+
+
+
+unsigned long SIMULATED_CORE_GetSleepsCount(void)
+{
+  return sleepsCount;
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+/* Lower priority values first, then lower exception numbers. */
+static uint32_t SelectException(uint32_t isPriMaskIgnored)
+{
+  if(priMask != 0 && isPriMaskIgnored == 0) {
+    return 0;
+  }
+
+  uint32_t priorityLimit = activePriority;
+  uint32_t basePriLimit = GetGroupPriority(0) & basePri;
+  if(basePri != 0 && basePriLimit < priorityLimit) {
+    priorityLimit = basePriLimit;
+  }
+
+  uint32_t selectedException = 0;
+  for(uint32_t exception = FIRST_EXCEPTION; exception < EXCEPTIONS_COUNT;
+    ++exception) {
+    if(isExceptionPending[exception] == 0 || (exception >= EXCEPTION(0) &&
+      isExceptionEnabled[exception] == 0)) {
+      continue;
+    }
+    uint32_t priority = GetGroupPriority(exception);
+    if(priority < priorityLimit) {
+      priorityLimit = priority;
+      selectedException = exception;
+    }
+  }
+
+  return selectedException;
+}
+
+
+
+/*
+  The preemption part of the priority, as split by PRIGROUP. Exception 0
+  gives the mask alone.
+*/
+static uint32_t GetGroupPriority(uint32_t exception)
+{
+  uint32_t priorityGroup =
+    (SCB->AIRCR & SCB_AIRCR_PRIGROUP_Msk) >> SCB_AIRCR_PRIGROUP_Pos;
+  uint32_t groupMask = (0xFFU << (priorityGroup + 1U)) & PRIORITY_MASK;
+
+  if(exception == 0) {
+    return groupMask;
+  }
+  if(exception >= EXCEPTION(0)) {
+    return NVIC->IP[exception - EXCEPTION(0)] & groupMask;
+  }
+
+  return SCB->SHP[exception - 4U] & groupMask;
+}
+
+
+
+/*
+  SysTick is written directly by the firmware, not through the register
+  macros: writes are found against the values left at the previous step.
+  A reload value only counts from the next reload, so a first period
+  shortened by writing LOAD, VAL and LOAD again runs at full length.
+*/
+static void AdvanceSysTick(uint64_t timeNs)
+{
+  uint32_t control = SysTick->CTRL;
+  uint32_t frequencyHz = 0;
+
+  if((control & SysTick_CTRL_ENABLE_Msk) != 0) {
+    frequencyHz = SIMULATED_CLOCK_Get()->hclkHz;
+    if((control & SysTick_CTRL_CLKSOURCE_Msk) == 0) {
+      frequencyHz /= SYSTICK_DIVIDER;
+    }
+  }
+  SIMULATED_BOARD_SetCounterFrequency(&sysTickCounter, timeNs, frequencyHz);
+  uint64_t ticks = SIMULATED_BOARD_GetCounterTicks(&sysTickCounter, timeNs);
+
+  if(SysTick->VAL != sysTickShadowValue) {
+    sysTickLatchedLoad = SysTick->LOAD & SYSTICK_VALUE_MAX;
+    sysTickZeroTicks = ticks + 1U + sysTickLatchedLoad;
+  } else if((control & SysTick_CTRL_ENABLE_Msk) != 0 &&
+    (sysTickShadowCtrl & SysTick_CTRL_ENABLE_Msk) == 0) {
+    sysTickLatchedLoad = SYSTICK_VALUE_MAX;
+    sysTickZeroTicks = ticks + (SysTick->VAL & SYSTICK_VALUE_MAX);
+  }
+
+  if(frequencyHz != 0) {
+    while(sysTickZeroTicks <= ticks) {
+      control |= SysTick_CTRL_COUNTFLAG_Msk;
+      if((control & SysTick_CTRL_TICKINT_Msk) != 0) {
+        SetPending(EXCEPTION(SysTick_IRQn), 1);
+      }
+      sysTickLatchedLoad = SysTick->LOAD & SYSTICK_VALUE_MAX;
+      if(sysTickLatchedLoad == 0) {
+        sysTickZeroTicks = SIMULATED_BOARD_NEVER;
+        break;
+      }
+      sysTickZeroTicks += sysTickLatchedLoad + 1U;
+    }
+
+    uint64_t value = sysTickZeroTicks - ticks;
+    SysTick->VAL = value > sysTickLatchedLoad ? 0 : (uint32_t)value;
+  }
+
+  SysTick->CTRL = control;
+  sysTickShadowCtrl = control;
+  sysTickShadowValue = SysTick->VAL;
+}
+
+
+
+/* Counts core clock cycles, also checked against firmware writes. */
+static void AdvanceCycleCounter(uint64_t timeNs)
+{
+  uint32_t frequencyHz = 0;
+
+  if((CoreDebug->DEMCR & CoreDebug_DEMCR_TRCENA_Msk) != 0 &&
+    (DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) != 0 && isSleeping == 0) {
+    frequencyHz = SIMULATED_CLOCK_Get()->hclkHz;
+  }
+  SIMULATED_BOARD_SetCounterFrequency(&cycleCounter, timeNs, frequencyHz);
+
+  if(DWT->CYCCNT != shadowCycleCount) {
+    SIMULATED_BOARD_SetCounterTicks(&cycleCounter, timeNs, DWT->CYCCNT);
+  }
+
+  shadowCycleCount =
+    (uint32_t)SIMULATED_BOARD_GetCounterTicks(&cycleCounter, timeNs);
+  DWT->CYCCNT = shadowCycleCount;
+}
+
+
+
+/* Clear bits written directly to ICSR. */
+static void UpdateInterruptControl(void)
+{
+  uint32_t control = SCB->ICSR;
+
+  if((control & SCB_ICSR_PENDSTCLR_Msk) != 0) {
+    SetPending(EXCEPTION(SysTick_IRQn), 0);
+  }
+  if((control & SCB_ICSR_PENDSVCLR_Msk) != 0) {
+    SetPending(EXCEPTION(PendSV_IRQn), 0);
+  }
+}
+
+
+
+/* Kept in the ICSR pending bits of SysTick and PendSV too, low_power.c
+   reads them. */
+static void SetPending(uint32_t exception, uint32_t isPending)
+{
+  if(exception >= EXCEPTIONS_COUNT) {
+    return;
+  }
+  isExceptionPending[exception] = (uint8_t)isPending;
+
+  uint32_t control = ipsr;
+  if(isExceptionPending[EXCEPTION(SysTick_IRQn)] != 0) {
+    control |= SCB_ICSR_PENDSTSET_Msk;
+  }
+  if(isExceptionPending[EXCEPTION(PendSV_IRQn)] != 0) {
+    control |= SCB_ICSR_PENDSVSET_Msk;
+  }
+  SCB->ICSR = control;
+}
@@ -0,0 +1,82 @@
+#include "simulated_peripherals.h"
+
+#include "stm32f4xx.h"
+
+#include <stddef.h>
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define REGISTER(offset) (*(volatile uint32_t *)(CRC_BASE + (offset)))
+
+#define DR_RESET        0xFFFFFFFFU
+#define CRC32_POLYNOMIAL 0x04C11DB7U
+#define BITS_IN_WORD    32U
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static uint32_t UpdateCrc(uint32_t crc, uint32_t data);
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+void SIMULATED_CRC_Reset(void)
+{
+  REGISTER(offsetof(CRC_TypeDef, DR)) = DR_RESET;
+}
+
+
+
+/*
+  The CRC-32 of the STM32F4: every word written to DR is shifted in most
+  significant bit first, with no reflection and no final inversion. IDR is
+  8 bits wide.
+*/
+void SIMULATED_CRC_Write(uint32_t offset, uint32_t value)
+{
+  switch(offset) {
+    case offsetof(CRC_TypeDef, DR):
+      REGISTER(offset) = UpdateCrc(REGISTER(offset), value);
+      break;
+
+    case offsetof(CRC_TypeDef, IDR):
+      *(volatile uint8_t *)(CRC_BASE + offset) = (uint8_t)value;
+      break;
+
+    case offsetof(CRC_TypeDef, CR):
+      if((value & CRC_CR_RESET) != 0) {
+        REGISTER(offsetof(CRC_TypeDef, DR)) = DR_RESET;
+      }
+      break;
+
+    default:
+      break;
+  }
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+static uint32_t UpdateCrc(uint32_t crc, uint32_t data)
+{
+  crc ^= data;
+  for(uint32_t bit = 0; bit < BITS_IN_WORD; ++bit) {
+    crc = (crc & 0x80000000U) != 0 ? (crc << 1) ^ CRC32_POLYNOMIAL :
+      crc << 1;
+  }
+
+  return crc;
+}
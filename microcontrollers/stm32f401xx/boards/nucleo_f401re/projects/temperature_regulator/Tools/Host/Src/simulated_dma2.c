@@ -0,0 +1,249 @@
+#include "simulated_peripherals.h"
+
+#include "simulated_core.h"
+
+#include "stm32f4xx.h"
+
+#include <stddef.h>
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define REGISTER(offset) (*(volatile uint32_t *)(DMA2_BASE + (offset)))
+
+#define STREAMS_COUNT       8U
+#define STREAMS_OFFSET      (DMA2_Stream0_BASE - DMA2_BASE)
+#define STREAM_SIZE         (DMA2_Stream1_BASE - DMA2_Stream0_BASE)
+#define STREAM_REGISTER(stream, member) \
+  REGISTER(STREAMS_OFFSET + (stream) * STREAM_SIZE + \
+    offsetof(DMA_Stream_TypeDef, member))
+
+/* Streams 0 to 3 have their flags in LISR, 4 to 7 in HISR. */
+#define STREAMS_PER_FLAGS_REGISTER 4U
+
+#define FLAG_HT   0x10U
+#define FLAG_TC   0x20U
+
+#define FCR_RESET 0x00000021U
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+static const uint32_t FLAGS_SHIFTS[STREAMS_PER_FLAGS_REGISTER] = {
+  0, 6, 16, 22
+};
+
+static const int32_t STREAM_IRQS[STREAMS_COUNT] = {
+  DMA2_Stream0_IRQn, DMA2_Stream1_IRQn, DMA2_Stream2_IRQn, DMA2_Stream3_IRQn,
+  DMA2_Stream4_IRQn, DMA2_Stream5_IRQn, DMA2_Stream6_IRQn, DMA2_Stream7_IRQn
+};
+
+/* NDTR as latched when the stream was enabled. */
+static uint32_t reloadLengths[STREAMS_COUNT];
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static void WriteStream(uint32_t stream, uint32_t offset, uint32_t value);
+static uintptr_t StartTransfer(uint32_t stream, uint32_t *size);
+static void EndTransfer(uint32_t stream);
+static void SetFlags(uint32_t stream, uint32_t flags);
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+void SIMULATED_DMA2_Reset(void)
+{
+  for(uint32_t stream = 0; stream < STREAMS_COUNT; ++stream) {
+    STREAM_REGISTER(stream, FCR) = FCR_RESET;
+    reloadLengths[stream] = 0;
+  }
+}
+
+
+
+/* Flags are cleared through the IFCR registers, which read as 0. */
+void SIMULATED_DMA2_Write(uint32_t offset, uint32_t value)
+{
+  switch(offset) {
+    case offsetof(DMA_TypeDef, LISR):
+    case offsetof(DMA_TypeDef, HISR):
+      break;
+
+    case offsetof(DMA_TypeDef, LIFCR):
+      REGISTER(offsetof(DMA_TypeDef, LISR)) &= ~value;
+      break;
+
+    case offsetof(DMA_TypeDef, HIFCR):
+      REGISTER(offsetof(DMA_TypeDef, HISR)) &= ~value;
+      break;
+
+    default:
+      if(offset >= STREAMS_OFFSET &&
+        offset < STREAMS_OFFSET + STREAMS_COUNT * STREAM_SIZE) {
+        WriteStream((offset - STREAMS_OFFSET) / STREAM_SIZE,
+          (offset - STREAMS_OFFSET) % STREAM_SIZE, value);
+      }
+      break;
+  }
+}
+
+
+
+/*
+  A peripheral to memory request: the data is stored at the next memory
+  address of the stream. Fails when the stream is not enabled.
+*/
+int SIMULATED_DMA2_WritePeripheralData(uint32_t stream, uint32_t data)
+{
+  uint32_t size;
+  uintptr_t address = StartTransfer(stream, &size);
+
+  if(address == 0) {
+    return -1;
+  }
+  if(size == sizeof(uint8_t)) {
+    *(uint8_t *)address = (uint8_t)data;
+  } else if(size == sizeof(uint16_t)) {
+    *(uint16_t *)address = (uint16_t)data;
+  } else {
+    *(uint32_t *)address = data;
+  }
+
+  EndTransfer(stream);
+  return 0;
+}
+
+
+
+/* A memory to peripheral request, the reverse. */
+int SIMULATED_DMA2_ReadPeripheralData(uint32_t stream, uint32_t *data)
+{
+  uint32_t size;
+  uintptr_t address = StartTransfer(stream, &size);
+
+  if(address == 0) {
+    return -1;
+  }
+  if(size == sizeof(uint8_t)) {
+    *data = *(const uint8_t *)address;
+  } else if(size == sizeof(uint16_t)) {
+    *data = *(const uint16_t *)address;
+  } else {
+    *data = *(const uint32_t *)address;
+  }
+
+  EndTransfer(stream);
+  return 0;
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+/*
+  Enabling a stream latches its data length. The USART1 transmitter takes
+  the data of stream 7 as soon as it is enabled.
+*/
+static void WriteStream(uint32_t stream, uint32_t offset, uint32_t value)
+{
+  uint32_t previousValue = STREAM_REGISTER(stream, CR);
+
+  REGISTER(STREAMS_OFFSET + stream * STREAM_SIZE + offset) = value;
+  if(offset != offsetof(DMA_Stream_TypeDef, CR) ||
+    (previousValue & DMA_SxCR_EN) != 0 || (value & DMA_SxCR_EN) == 0) {
+    return;
+  }
+
+  reloadLengths[stream] = STREAM_REGISTER(stream, NDTR) & DMA_SxNDT;
+  if(stream == SIMULATED_DMA2_STREAM_USART1_TX) {
+    SIMULATED_USART1_StartTransmission();
+  }
+}
+
+
+
+/* The memory address of the next data item, 0 for no transfer. */
+static uintptr_t StartTransfer(uint32_t stream, uint32_t *size)
+{
+  uint32_t control = STREAM_REGISTER(stream, CR);
+  uint32_t dataLength = STREAM_REGISTER(stream, NDTR) & DMA_SxNDT;
+
+  if((control & DMA_SxCR_EN) == 0 || dataLength == 0) {
+    return 0;
+  }
+
+  *size = 1U << ((control & DMA_SxCR_MSIZE) >> DMA_SxCR_MSIZE_Pos);
+  uintptr_t address = (control & DMA_SxCR_CT) != 0 ?
+    STREAM_REGISTER(stream, M1AR) : STREAM_REGISTER(stream, M0AR);
+  if((control & DMA_SxCR_MINC) != 0) {
+    address += (uintptr_t)(reloadLengths[stream] - dataLength) * *size;
+  }
+
+  return address;
+}
+
+
+
+/*
+  Half transfer and transfer complete flags. The stream starts over in
+  circular mode, on the other memory in double buffer mode, and stops
+  otherwise.
+*/
+static void EndTransfer(uint32_t stream)
+{
+  uint32_t control = STREAM_REGISTER(stream, CR);
+  uint32_t dataLength = (STREAM_REGISTER(stream, NDTR) & DMA_SxNDT) - 1U;
+  uint32_t reloadLength = reloadLengths[stream];
+
+  STREAM_REGISTER(stream, NDTR) = dataLength;
+  if(reloadLength - dataLength == reloadLength / 2U) {
+    SetFlags(stream, FLAG_HT);
+  }
+  if(dataLength != 0) {
+    return;
+  }
+
+  if((control & (DMA_SxCR_CIRC | DMA_SxCR_DBM)) != 0) {
+    STREAM_REGISTER(stream, NDTR) = reloadLength;
+    if((control & DMA_SxCR_DBM) != 0) {
+      STREAM_REGISTER(stream, CR) = control ^ DMA_SxCR_CT;
+    }
+  } else {
+    STREAM_REGISTER(stream, CR) = control & ~DMA_SxCR_EN;
+  }
+  SetFlags(stream, FLAG_TC);
+}
+
+
+
+static void SetFlags(uint32_t stream, uint32_t flags)
+{
+  uint32_t control = STREAM_REGISTER(stream, CR);
+  uint32_t shift = FLAGS_SHIFTS[stream % STREAMS_PER_FLAGS_REGISTER];
+
+  if(stream < STREAMS_PER_FLAGS_REGISTER) {
+    REGISTER(offsetof(DMA_TypeDef, LISR)) |= flags << shift;
+  } else {
+    REGISTER(offsetof(DMA_TypeDef, HISR)) |= flags << shift;
+  }
+
+  if(((flags & FLAG_HT) != 0 && (control & DMA_SxCR_HTIE) != 0) ||
+    ((flags & FLAG_TC) != 0 && (control & DMA_SxCR_TCIE) != 0)) {
+    SIMULATED_CORE_RaiseIrq(STREAM_IRQS[stream]);
+  }
+}
@@ -0,0 +1,105 @@
+#include "simulated_peripherals.h"
+
+#include "simulated_board.h"
+
+#include "stm32f4xx.h"
+
+#include <stddef.h>
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define REGISTER(offset) (*(volatile uint32_t *)(GPIOA_BASE + (offset)))
+
+/* PA13, PA14 and PA15 in their debug alternate functions. */
+#define MODER_RESET    0xA8000000U
+#define PUPDR_RESET    0x64000000U
+#define OSPEEDR_RESET  0x0C000000U
+
+#define PINS_COUNT     16U
+#define PINS_MASK      0xFFFFU
+#define MODE_OUTPUT    1U
+
+/* The relay input of the heater is active low. */
+#define HEATER_PIN     8U
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static void UpdateInputs(void);
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+void SIMULATED_GPIOA_Reset(void)
+{
+  REGISTER(offsetof(GPIO_TypeDef, MODER)) = MODER_RESET;
+  REGISTER(offsetof(GPIO_TypeDef, PUPDR)) = PUPDR_RESET;
+  REGISTER(offsetof(GPIO_TypeDef, OSPEEDR)) = OSPEEDR_RESET;
+  UpdateInputs();
+}
+
+
+
+/*
+  BSRR sets and resets ODR bits, a set wins, and reads as 0. Every
+  model is brought to now first, so the plant sees the heater change at
+  the time of the write.
+*/
+void SIMULATED_GPIOA_Write(uint32_t offset, uint32_t value)
+{
+  SIMULATED_BOARD_Synchronize();
+
+  if(offset == offsetof(GPIO_TypeDef, BSRR)) {
+    uint32_t output = REGISTER(offsetof(GPIO_TypeDef, ODR));
+    output &= ~(value >> PINS_COUNT);
+    output |= value & PINS_MASK;
+    REGISTER(offsetof(GPIO_TypeDef, ODR)) = output;
+  } else {
+    REGISTER(offset) = value;
+  }
+
+  UpdateInputs();
+}
+
+
+
+int SIMULATED_GPIOA_IsHeaterOn(void)
+{
+  uint32_t mode = (REGISTER(offsetof(GPIO_TypeDef, MODER)) >>
+    (2U * HEATER_PIN)) & GPIO_MODER_MODER0_Msk;
+
+  return mode == MODE_OUTPUT &&
+    (REGISTER(offsetof(GPIO_TypeDef, ODR)) & (1U << HEATER_PIN)) == 0;
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+/* Outputs read back their level, nothing drives the other pins. */
+static void UpdateInputs(void)
+{
+  uint32_t modes = REGISTER(offsetof(GPIO_TypeDef, MODER));
+  uint32_t output = REGISTER(offsetof(GPIO_TypeDef, ODR));
+  uint32_t input = 0;
+
+  for(uint32_t pin = 0; pin < PINS_COUNT; ++pin) {
+    if(((modes >> (2U * pin)) & GPIO_MODER_MODER0_Msk) == MODE_OUTPUT) {
+      input |= output & (1U << pin);
+    }
+  }
+
+  REGISTER(offsetof(GPIO_TypeDef, IDR)) = input;
+}
@@ -0,0 +1,414 @@
+#include "simulated_peripherals.h"
+
+#include "simulated_board.h"
+#include "simulated_core.h"
+
+#include "stm32f4xx.h"
+
+#include <stddef.h>
+#include <string.h>
+#include <time.h>
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define REGISTER(offset) (*(volatile uint32_t *)(RTC_BASE + (offset)))
+#define EXTI_REGISTER(offset) \
+  (*(volatile uint32_t *)(EXTI_BASE + (offset)))
+
+#define RTC_REGISTERS_SIZE  (offsetof(RTC_TypeDef, BKP19R) + sizeof(uint32_t))
+
+#define ISR_RESET   (RTC_ISR_ALRAWF | RTC_ISR_ALRBWF | RTC_ISR_WUTWF)
+#define PRER_RESET  0x007F00FFU
+#define WUTR_RESET  0x0000FFFFU
+#define DR_RESET    0x00002101U
+
+/* Flags cleared by writing 0, INIT is the only other writable bit. */
+#define ISR_CLEARABLE_FLAGS (RTC_ISR_RSF | RTC_ISR_WUTF | RTC_ISR_ALRAF | \
+  RTC_ISR_ALRBF | RTC_ISR_TSF | RTC_ISR_TSOVF | RTC_ISR_TAMP1F)
+
+#define WAKEUP_EXTI_LINE EXTI_IMR_MR22
+
+#define SECONDS_IN_MINUTE 60U
+#define SECONDS_IN_HOUR   3600U
+#define SECONDS_IN_DAY    86400U
+#define MONTHS_IN_YEAR    12
+
+/* The calendar counts from 2000-01-01, a Saturday. */
+#define CALENDAR_EPOCH_YEAR     2000
+#define CALENDAR_EPOCH_WEEKDAY  6U
+#define CALENDAR_EPOCH_DAYS     10957
+#define DAYS_IN_WEEK            7U
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+/* RTCCLK ticks, as selected and enabled in the RCC backup domain. */
+static simulatedCounter_t rtcClock;
+
+/* The calendar shows calendarSeconds at calendarStartTicks. */
+static uint64_t calendarStartTicks;
+static uint64_t calendarSeconds;
+
+static uint64_t wakeupTicks = SIMULATED_BOARD_NEVER;
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static void WriteInterruptStatus(uint32_t value, uint64_t ticks);
+static void WriteControl(uint32_t value, uint64_t ticks);
+static void UpdateCalendar(uint64_t ticks);
+static void LoadCalendar(uint64_t ticks);
+static void Wakeup(void);
+static uint64_t GetWakeupPeriod(void);
+static uint64_t GetTicksPerSecond(void);
+static int64_t GetDaysFromCivil(int64_t year, uint32_t month, uint32_t day);
+static void GetCivilFromDays(int64_t days, int64_t *year, uint32_t *month,
+  uint32_t *day);
+static uint32_t ToBcd(uint32_t value);
+static uint32_t FromBcd(uint32_t value);
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+void SIMULATED_RTC_Reset(void)
+{
+  SIMULATED_RTC_ResetBackupDomain();
+}
+
+
+
+/* The RTC registers, the calendar and the backup registers. */
+void SIMULATED_RTC_ResetBackupDomain(void)
+{
+  memset((void *)RTC_BASE, 0, RTC_REGISTERS_SIZE);
+  REGISTER(offsetof(RTC_TypeDef, DR)) = DR_RESET;
+  REGISTER(offsetof(RTC_TypeDef, ISR)) = ISR_RESET;
+  REGISTER(offsetof(RTC_TypeDef, PRER)) = PRER_RESET;
+  REGISTER(offsetof(RTC_TypeDef, WUTR)) = WUTR_RESET;
+
+  uint64_t ticks = SIMULATED_BOARD_GetCounterTicks(&rtcClock,
+    SIMULATED_BOARD_GetTime());
+  LoadCalendar(ticks);
+  wakeupTicks = SIMULATED_BOARD_NEVER;
+}
+
+
+
+/*
+  Only ISR and CR have side effects, the write protection is not
+  modelled.
+*/
+void SIMULATED_RTC_Write(uint32_t offset, uint32_t value)
+{
+  uint64_t timeNs = SIMULATED_BOARD_GetTime();
+  SIMULATED_RTC_Advance(timeNs);
+  uint64_t ticks = SIMULATED_BOARD_GetCounterTicks(&rtcClock, timeNs);
+
+  switch(offset) {
+    case offsetof(RTC_TypeDef, ISR):
+      WriteInterruptStatus(value, ticks);
+      break;
+
+    case offsetof(RTC_TypeDef, CR):
+      WriteControl(value, ticks);
+      break;
+
+    default:
+      REGISTER(offset) = value;
+      break;
+  }
+}
+
+
+
+/* PR is cleared by writing 1. */
+void SIMULATED_RTC_WriteExti(uint32_t offset, uint32_t value)
+{
+  if(offset == offsetof(EXTI_TypeDef, PR)) {
+    EXTI_REGISTER(offset) &= ~value;
+  } else {
+    EXTI_REGISTER(offset) = value;
+  }
+}
+
+
+
+/*
+  The shadow registers follow the calendar, RSF is set again as soon as
+  the firmware clears it.
+*/
+void SIMULATED_RTC_Advance(uint64_t timeNs)
+{
+  uint64_t ticks = SIMULATED_BOARD_GetCounterTicks(&rtcClock, timeNs);
+
+  while(wakeupTicks <= ticks) {
+    Wakeup();
+  }
+
+  if((REGISTER(offsetof(RTC_TypeDef, ISR)) & RTC_ISR_INITF) == 0) {
+    UpdateCalendar(ticks);
+    REGISTER(offsetof(RTC_TypeDef, ISR)) |= RTC_ISR_RSF;
+  }
+
+  SIMULATED_BOARD_SetCounterFrequency(&rtcClock, timeNs,
+    SIMULATED_CLOCK_Get()->rtcHz);
+}
+
+
+
+uint64_t SIMULATED_RTC_GetNextEventTime(void)
+{
+  return SIMULATED_BOARD_GetCounterTime(&rtcClock, wakeupTicks);
+}
+
+
+
+/*
+  mktime() of the firmware, linked with -Wl,--wrap=mktime. The calendar is
+  UTC and nothing is locked, as with newlib on the board: the glibc one
+  takes the time zone lock, which a task switched out while holding it
+  would keep from every other task.
+*/
+time_t __wrap_mktime(struct tm *time)
+{
+  int64_t month = time->tm_mon;
+  int64_t year = (int64_t)time->tm_year + 1900 + month / MONTHS_IN_YEAR;
+
+  month %= MONTHS_IN_YEAR;
+  if(month < 0) {
+    month += MONTHS_IN_YEAR;
+    --year;
+  }
+
+  int64_t days = GetDaysFromCivil(year, (uint32_t)month + 1U, 1U) +
+    time->tm_mday - 1;
+  int64_t seconds = days * SECONDS_IN_DAY +
+    (int64_t)time->tm_hour * SECONDS_IN_HOUR +
+    (int64_t)time->tm_min * SECONDS_IN_MINUTE + time->tm_sec;
+
+  days = seconds >= 0 ? seconds / SECONDS_IN_DAY :
+    -((-seconds + SECONDS_IN_DAY - 1) / SECONDS_IN_DAY);
+  time->tm_wday = (int)(((days % DAYS_IN_WEEK) + DAYS_IN_WEEK + 4) %
+    DAYS_IN_WEEK);
+  time->tm_yday = (int)(days - GetDaysFromCivil(year, 1U, 1U));
+  time->tm_isdst = 0;
+
+  return (time_t)seconds;
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+/*
+  INITF follows INIT at once. Leaving the initialization mode starts the
+  calendar from TR and DR.
+*/
+static void WriteInterruptStatus(uint32_t value, uint64_t ticks)
+{
+  uint32_t status = REGISTER(offsetof(RTC_TypeDef, ISR));
+  int isInitExited = (status & RTC_ISR_INIT) != 0 &&
+    (value & RTC_ISR_INIT) == 0;
+
+  status &= ~(RTC_ISR_INIT | RTC_ISR_INITF) &
+    (value | ~ISR_CLEARABLE_FLAGS);
+  if((value & RTC_ISR_INIT) != 0) {
+    status |= RTC_ISR_INIT | RTC_ISR_INITF;
+  }
+  REGISTER(offsetof(RTC_TypeDef, ISR)) = status;
+
+  if(isInitExited != 0) {
+    LoadCalendar(ticks);
+  }
+}
+
+
+
+/* The wakeup counter restarts when WUTE is set, WUTWF is then cleared. */
+static void WriteControl(uint32_t value, uint64_t ticks)
+{
+  uint32_t previousValue = REGISTER(offsetof(RTC_TypeDef, CR));
+
+  REGISTER(offsetof(RTC_TypeDef, CR)) = value;
+  if((value & RTC_CR_WUTE) == 0) {
+    REGISTER(offsetof(RTC_TypeDef, ISR)) |= RTC_ISR_WUTWF;
+    wakeupTicks = SIMULATED_BOARD_NEVER;
+  } else if((previousValue & RTC_CR_WUTE) == 0) {
+    REGISTER(offsetof(RTC_TypeDef, ISR)) &= ~RTC_ISR_WUTWF;
+    wakeupTicks = ticks + GetWakeupPeriod();
+  }
+}
+
+
+
+/* SSR counts down from PREDIV_S, BCD time and date, Monday being 1. */
+static void UpdateCalendar(uint64_t ticks)
+{
+  uint32_t prescalers = REGISTER(offsetof(RTC_TypeDef, PRER));
+  uint64_t asynchronousDivider =
+    ((prescalers & RTC_PRER_PREDIV_A) >> RTC_PRER_PREDIV_A_Pos) + 1U;
+  uint64_t synchronousDivider = (prescalers & RTC_PRER_PREDIV_S) + 1U;
+
+  uint64_t subseconds = (ticks - calendarStartTicks) / asynchronousDivider;
+  uint64_t seconds = calendarSeconds + subseconds / synchronousDivider;
+  uint32_t secondOfDay = (uint32_t)(seconds % SECONDS_IN_DAY);
+  int64_t days = (int64_t)(seconds / SECONDS_IN_DAY);
+
+  int64_t year;
+  uint32_t month, day;
+  GetCivilFromDays(days, &year, &month, &day);
+  uint32_t weekday = (uint32_t)((days + CALENDAR_EPOCH_WEEKDAY - 1) %
+    DAYS_IN_WEEK) + 1U;
+
+  REGISTER(offsetof(RTC_TypeDef, SSR)) = (uint32_t)(synchronousDivider - 1U -
+    subseconds % synchronousDivider);
+  REGISTER(offsetof(RTC_TypeDef, TR)) =
+    ToBcd(secondOfDay / SECONDS_IN_HOUR) << RTC_TR_HU_Pos |
+    ToBcd(secondOfDay % SECONDS_IN_HOUR / SECONDS_IN_MINUTE) << RTC_TR_MNU_Pos |
+    ToBcd(secondOfDay % SECONDS_IN_MINUTE) << RTC_TR_SU_Pos;
+  REGISTER(offsetof(RTC_TypeDef, DR)) =
+    ToBcd((uint32_t)(year - CALENDAR_EPOCH_YEAR)) << RTC_DR_YU_Pos |
+    weekday << RTC_DR_WDU_Pos |
+    ToBcd(month) << RTC_DR_MU_Pos |
+    ToBcd(day) << RTC_DR_DU_Pos;
+}
+
+
+
+/* The 24 hour format only. */
+static void LoadCalendar(uint64_t ticks)
+{
+  uint32_t time = REGISTER(offsetof(RTC_TypeDef, TR));
+  uint32_t date = REGISTER(offsetof(RTC_TypeDef, DR));
+
+  int64_t days = GetDaysFromCivil(CALENDAR_EPOCH_YEAR +
+    FromBcd((date & (RTC_DR_YT | RTC_DR_YU)) >> RTC_DR_YU_Pos),
+    FromBcd((date & (RTC_DR_MT | RTC_DR_MU)) >> RTC_DR_MU_Pos),
+    FromBcd((date & (RTC_DR_DT | RTC_DR_DU)) >> RTC_DR_DU_Pos)) -
+    GetDaysFromCivil(CALENDAR_EPOCH_YEAR, 1U, 1U);
+
+  calendarSeconds = (uint64_t)days * SECONDS_IN_DAY +
+    FromBcd((time & (RTC_TR_HT | RTC_TR_HU)) >> RTC_TR_HU_Pos) *
+    SECONDS_IN_HOUR +
+    FromBcd((time & (RTC_TR_MNT | RTC_TR_MNU)) >> RTC_TR_MNU_Pos) *
+    SECONDS_IN_MINUTE +
+    FromBcd((time & (RTC_TR_ST | RTC_TR_SU)) >> RTC_TR_SU_Pos);
+  calendarStartTicks = ticks;
+}
+
+
+
+/* Through EXTI line 22, on its rising edge. */
+static void Wakeup(void)
+{
+  wakeupTicks += GetWakeupPeriod();
+  REGISTER(offsetof(RTC_TypeDef, ISR)) |= RTC_ISR_WUTF;
+
+  if((REGISTER(offsetof(RTC_TypeDef, CR)) & RTC_CR_WUTIE) == 0 ||
+    (EXTI_REGISTER(offsetof(EXTI_TypeDef, RTSR)) & WAKEUP_EXTI_LINE) == 0) {
+    return;
+  }
+  EXTI_REGISTER(offsetof(EXTI_TypeDef, PR)) |= WAKEUP_EXTI_LINE;
+  if((EXTI_REGISTER(offsetof(EXTI_TypeDef, IMR)) & WAKEUP_EXTI_LINE) != 0) {
+    SIMULATED_CORE_RaiseIrq(RTC_WKUP_IRQn);
+  }
+}
+
+
+
+/*
+  In RTCCLK ticks: WUTR + 1 periods of RTCCLK / 16 to / 2, or of ck_spre,
+  plus 2^16 of them for the largest WUCKSEL values.
+*/
+static uint64_t GetWakeupPeriod(void)
+{
+  static const uint64_t RTCCLK_DIVIDERS[] = { 16, 8, 4, 2 };
+  uint32_t clockSelection =
+    REGISTER(offsetof(RTC_TypeDef, CR)) & RTC_CR_WUCKSEL;
+  uint64_t reload = (REGISTER(offsetof(RTC_TypeDef, WUTR)) & RTC_WUTR_WUT) +
+    1U;
+
+  if(clockSelection < sizeof(RTCCLK_DIVIDERS) / sizeof(RTCCLK_DIVIDERS[0])) {
+    return reload * RTCCLK_DIVIDERS[clockSelection];
+  }
+  if((clockSelection & RTC_CR_WUCKSEL_1) != 0) {
+    reload += RTC_WUTR_WUT + 1U;
+  }
+
+  return reload * GetTicksPerSecond();
+}
+
+
+
+static uint64_t GetTicksPerSecond(void)
+{
+  uint32_t prescalers = REGISTER(offsetof(RTC_TypeDef, PRER));
+
+  return (((prescalers & RTC_PRER_PREDIV_A) >> RTC_PRER_PREDIV_A_Pos) + 1U) *
+    ((prescalers & RTC_PRER_PREDIV_S) + 1U);
+}
+
+
+
+/* Days since 1970-01-01, H. Hinnant's algorithm. */
+static int64_t GetDaysFromCivil(int64_t year, uint32_t month, uint32_t day)
+{
+  year -= month <= 2U;
+  int64_t era = (year >= 0 ? year : year - 399) / 400;
+  int64_t yearOfEra = year - era * 400;
+  int64_t dayOfYear = (153 * (month > 2U ? month - 3 : month + 9) + 2) / 5 +
+    day - 1;
+  int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 +
+    dayOfYear;
+
+  return era * 146097 + dayOfEra - 719468;
+}
+
+
+
+/* The reverse, from days since 2000-01-01. */
+static void GetCivilFromDays(int64_t days, int64_t *year, uint32_t *month,
+  uint32_t *day)
+{
+  days += CALENDAR_EPOCH_DAYS + 719468;
+  int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+  int64_t dayOfEra = days - era * 146097;
+  int64_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 -
+    dayOfEra / 146096) / 365;
+  int64_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 -
+    yearOfEra / 100);
+  int64_t monthIndex = (5 * dayOfYear + 2) / 153;
+
+  *day = (uint32_t)(dayOfYear - (153 * monthIndex + 2) / 5 + 1);
+  *month = (uint32_t)(monthIndex < 10 ? monthIndex + 3 : monthIndex - 9);
+  *year = yearOfEra + era * 400 + (*month <= 2U);
+}
+
+
+
+static uint32_t ToBcd(uint32_t value)
+{
+  return (value / 10U) << 4U | value % 10U;
+}
+
+
+
+static uint32_t FromBcd(uint32_t value)
+{
+  return (value >> 4U) * 10U + (value & 0x0FU);
+}
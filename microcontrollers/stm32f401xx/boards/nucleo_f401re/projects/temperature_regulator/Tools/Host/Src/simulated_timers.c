@@ -0,0 +1,265 @@
+#include "simulated_peripherals.h"
+
+#include "simulated_board.h"
+#include "simulated_core.h"
+
+#include "stm32f4xx.h"
+
+#include <stddef.h>
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define REGISTER(timer, offset) \
+  (*(volatile uint32_t *)((timer)->baseAddress + (offset)))
+
+#define TIMERS_COUNT 2
+
+#define MMS_RESET  0U
+#define MMS_UPDATE (2U << TIM_CR2_MMS_Pos)
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE STRUCTURES                              */
+/*****************************************************************************/
+
+/*
+  An upcounting timer. The timer clock is counted from the start and the
+  counter derived from it: CNT is startCount at startTicks, one more every
+  prescaler + 1 ticks, until the update event at updateTicks.
+*/
+typedef struct simulatedTimer {
+  uintptr_t baseAddress;
+  int32_t irq;
+  uint32_t trigger;
+  uint32_t counterMax;
+  simulatedCounter_t clock;
+  uint64_t startTicks;
+  uint64_t updateTicks;
+  uint32_t startCount;
+  uint32_t prescaler;
+  uint32_t autoreload;
+  int isUpdateEvent;
+}simulatedTimer_t;
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+static simulatedTimer_t timers[TIMERS_COUNT] = {
+  {
+    .baseAddress = TIM2_BASE,
+    .irq = TIM2_IRQn,
+    .trigger = SIMULATED_ADC1_TRIGGER_TIM2_TRGO,
+    .counterMax = 0xFFFFFFFFU
+  },
+  {
+    .baseAddress = TIM3_BASE,
+    .irq = TIM3_IRQn,
+    .trigger = SIMULATED_ADC1_TRIGGER_TIM3_TRGO,
+    .counterMax = 0xFFFFU
+  }
+};
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static void Write(simulatedTimer_t *timer, uint32_t offset, uint32_t value);
+static void AdvanceTimer(simulatedTimer_t *timer, uint64_t timeNs);
+static void Restart(simulatedTimer_t *timer, uint64_t ticks,
+  uint32_t count);
+static void GenerateUpdate(simulatedTimer_t *timer, uint64_t ticks,
+  int isSoftware);
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+void SIMULATED_TIMERS_Reset(void)
+{
+  for(size_t index = 0; index < TIMERS_COUNT; ++index) {
+    simulatedTimer_t *timer = &timers[index];
+    REGISTER(timer, offsetof(TIM_TypeDef, ARR)) = timer->counterMax;
+    timer->autoreload = timer->counterMax;
+    timer->prescaler = 0;
+    Restart(timer, 0, 0);
+  }
+}
+
+
+
+void SIMULATED_TIMERS_WriteTim2(uint32_t offset, uint32_t value)
+{
+  Write(&timers[0], offset, value);
+}
+
+
+
+void SIMULATED_TIMERS_WriteTim3(uint32_t offset, uint32_t value)
+{
+  Write(&timers[1], offset, value);
+}
+
+
+
+void SIMULATED_TIMERS_Advance(uint64_t timeNs)
+{
+  for(size_t index = 0; index < TIMERS_COUNT; ++index) {
+    AdvanceTimer(&timers[index], timeNs);
+  }
+}
+
+
+
+uint64_t SIMULATED_TIMERS_GetNextEventTime(void)
+{
+  uint64_t nextEventNs = SIMULATED_BOARD_NEVER;
+
+  for(size_t index = 0; index < TIMERS_COUNT; ++index) {
+    uint64_t eventNs = SIMULATED_BOARD_GetCounterTime(&timers[index].clock,
+      timers[index].updateTicks);
+    if(eventNs < nextEventNs) {
+      nextEventNs = eventNs;
+    }
+  }
+
+  return nextEventNs;
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+/*
+  PSC is only loaded at the next update event, ARR too with ARPE set. UG
+  is an update event right away, without UIF when URS is set.
+*/
+static void Write(simulatedTimer_t *timer, uint32_t offset, uint32_t value)
+{
+  uint64_t timeNs = SIMULATED_BOARD_GetTime();
+  AdvanceTimer(timer, timeNs);
+  uint64_t ticks = SIMULATED_BOARD_GetCounterTicks(&timer->clock, timeNs);
+
+  switch(offset) {
+    case offsetof(TIM_TypeDef, SR):
+      REGISTER(timer, offset) &= value;
+      break;
+
+    case offsetof(TIM_TypeDef, EGR):
+      if((value & TIM_EGR_UG) != 0) {
+        GenerateUpdate(timer, ticks, 1);
+      }
+      break;
+
+    case offsetof(TIM_TypeDef, CNT):
+      REGISTER(timer, offset) = value & timer->counterMax;
+      Restart(timer, ticks, value & timer->counterMax);
+      break;
+
+    case offsetof(TIM_TypeDef, ARR):
+      REGISTER(timer, offset) = value & timer->counterMax;
+      if((REGISTER(timer, offsetof(TIM_TypeDef, CR1)) & TIM_CR1_ARPE) == 0) {
+        timer->autoreload = value & timer->counterMax;
+        Restart(timer, ticks, REGISTER(timer, offsetof(TIM_TypeDef, CNT)));
+      }
+      break;
+
+    default:
+      REGISTER(timer, offset) = value;
+      break;
+  }
+
+  AdvanceTimer(timer, timeNs);
+}
+
+
+
+/* Counts while CEN is set, on the APB1 timer clock. */
+static void AdvanceTimer(simulatedTimer_t *timer, uint64_t timeNs)
+{
+  uint64_t ticks = SIMULATED_BOARD_GetCounterTicks(&timer->clock, timeNs);
+
+  while(timer->updateTicks <= ticks) {
+    uint64_t updateTicks = timer->updateTicks;
+    if(timer->isUpdateEvent != 0) {
+      GenerateUpdate(timer, updateTicks, 0);
+    } else {
+      Restart(timer, updateTicks, 0);
+    }
+  }
+
+  REGISTER(timer, offsetof(TIM_TypeDef, CNT)) = timer->startCount +
+    (uint32_t)((ticks - timer->startTicks) / (timer->prescaler + 1U));
+
+  uint32_t frequencyHz = 0;
+  if((REGISTER(timer, offsetof(TIM_TypeDef, CR1)) & TIM_CR1_CEN) != 0) {
+    frequencyHz = SIMULATED_CLOCK_Get()->apb1TimersHz;
+  }
+  SIMULATED_BOARD_SetCounterFrequency(&timer->clock, timeNs, frequencyHz);
+}
+
+
+
+/*
+  Counting on from count: the counter reaches ARR and overflows with an
+  update event, or, above ARR, wraps around at its full width without
+  one.
+*/
+static void Restart(simulatedTimer_t *timer, uint64_t ticks, uint32_t count)
+{
+  uint64_t countsToOverflow;
+
+  timer->isUpdateEvent = count <= timer->autoreload;
+  if(timer->isUpdateEvent != 0) {
+    countsToOverflow = (uint64_t)timer->autoreload + 1U - count;
+  } else {
+    countsToOverflow = (uint64_t)timer->counterMax + 1U - count;
+  }
+
+  timer->startTicks = ticks;
+  timer->startCount = count;
+  timer->updateTicks = ticks + countsToOverflow * (timer->prescaler + 1U);
+}
+
+
+
+/*
+  The counter and the prescaler restart with the preloaded values, UIF is
+  set and TRGO pulses when MMS selects the update, or the reset for UG.
+*/
+static void GenerateUpdate(simulatedTimer_t *timer, uint64_t ticks,
+  int isSoftware)
+{
+  uint32_t control = REGISTER(timer, offsetof(TIM_TypeDef, CR1));
+  uint32_t masterMode =
+    REGISTER(timer, offsetof(TIM_TypeDef, CR2)) & TIM_CR2_MMS;
+
+  timer->prescaler = REGISTER(timer, offsetof(TIM_TypeDef, PSC)) & 0xFFFFU;
+  timer->autoreload = REGISTER(timer, offsetof(TIM_TypeDef, ARR));
+  Restart(timer, ticks, 0);
+  REGISTER(timer, offsetof(TIM_TypeDef, CNT)) = 0;
+
+  if(isSoftware == 0 || (control & TIM_CR1_URS) == 0) {
+    REGISTER(timer, offsetof(TIM_TypeDef, SR)) |= TIM_SR_UIF;
+    if((REGISTER(timer, offsetof(TIM_TypeDef, DIER)) & TIM_DIER_UIE) != 0) {
+      SIMULATED_CORE_RaiseIrq(timer->irq);
+    }
+  }
+
+  if(masterMode == MMS_UPDATE || (isSoftware != 0 && masterMode == MMS_RESET)) {
+    SIMULATED_ADC1_Trigger(timer->trigger);
+  }
+}
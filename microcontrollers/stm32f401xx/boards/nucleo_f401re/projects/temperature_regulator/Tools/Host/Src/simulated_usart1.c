@@ -0,0 +1,428 @@
+/* posix_openpt and the rest of the pseudo-terminal API, cfmakeraw. */
+#define _DEFAULT_SOURCE
+#define _XOPEN_SOURCE 600
+
+#include "simulated_peripherals.h"
+
+#include "simulated_board.h"
+#include "simulated_core.h"
+
+#include "stm32f4xx.h"
+
+#include <fcntl.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+
+/* The output delay flags of <termios.h> take the USART register names. */
+#undef CR1
+#undef CR2
+#undef CR3
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define REGISTER(offset) (*(volatile uint32_t *)(USART1_BASE + (offset)))
+
+#define SR_RESET (USART_SR_TXE | USART_SR_TC)
+
+/* Start bit, 8 data bits and stop bit. */
+#define BITS_PER_BYTE 10U
+
+#define RX_FIFO_SIZE   4096U
+#define TX_OUTPUT_SIZE 4096U
+
+#define RECEIVER_ENABLED    (USART_CR1_UE | USART_CR1_RE)
+#define TRANSMITTER_ENABLED (USART_CR1_UE | USART_CR1_TE)
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE STRUCTURES                              */
+/*****************************************************************************/
+
+/* Bytes come in from the terminal, a byte time apart. */
+typedef struct receiver {
+  uint8_t fifo[RX_FIFO_SIZE];
+  uint32_t head;
+  uint32_t count;
+  uint64_t nextByteNs;
+  uint64_t idleNs;
+}receiver_t;
+
+
+
+/*
+  The shift register sends a byte until endNs, with another one possibly
+  waiting in DR. The bytes sent are buffered until the end of the advance.
+*/
+typedef struct transmitter {
+  int isBusy;
+  int isDataPending;
+  uint8_t pendingData;
+  uint64_t endNs;
+  uint8_t output[TX_OUTPUT_SIZE];
+  uint32_t outputCount;
+}transmitter_t;
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+static int terminalFd = -1;
+static int terminalSlaveFd = -1;
+static uint32_t fixedBaudRate;
+
+static receiver_t receiver;
+static transmitter_t transmitter;
+static simulatedUsart1Statistics_t statistics;
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static void WriteData(uint32_t value);
+static void ReadTerminal(uint64_t timeNs);
+static void ReceiveByte(uint64_t timeNs);
+static void SetIdle(void);
+static void TransmitNext(uint64_t timeNs);
+static void FlushOutput(void);
+static uint64_t GetByteEndTime(uint64_t timeNs);
+static int IsEnabled(uint32_t bits);
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+/*
+  A raw pseudo-terminal. The slave side stays open, so the terminal keeps
+  working whoever opens it and closes it. A baud rate of 0 follows BRR.
+*/
+int SIMULATED_USART1_Open(uint32_t baudRate)
+{
+  fixedBaudRate = baudRate;
+
+  terminalFd = posix_openpt(O_RDWR | O_NOCTTY);
+  if(terminalFd < 0 || grantpt(terminalFd) != 0 ||
+    unlockpt(terminalFd) != 0) {
+    perror("pseudo-terminal");
+    return -1;
+  }
+
+  const char *slaveName = ptsname(terminalFd);
+  terminalSlaveFd = slaveName != NULL ?
+    open(slaveName, O_RDWR | O_NOCTTY) : -1;
+  if(terminalSlaveFd < 0) {
+    perror("pseudo-terminal slave");
+    return -1;
+  }
+
+  struct termios settings;
+  tcgetattr(terminalSlaveFd, &settings);
+  cfmakeraw(&settings);
+  tcsetattr(terminalSlaveFd, TCSANOW, &settings);
+
+  fcntl(terminalFd, F_SETFL, fcntl(terminalFd, F_GETFL) | O_NONBLOCK);
+
+  fprintf(stderr, "USART1 on %s\n", slaveName);
+
+  return 0;
+}
+
+
+
+void SIMULATED_USART1_Close(void)
+{
+  FlushOutput();
+  close(terminalSlaveFd);
+  close(terminalFd);
+  terminalSlaveFd = -1;
+  terminalFd = -1;
+}
+
+
+
+/* -1 while no byte can be taken from the terminal. */
+int SIMULATED_USART1_GetTerminalFd(void)
+{
+  if(IsEnabled(RECEIVER_ENABLED) == 0 || receiver.count == RX_FIFO_SIZE) {
+    return -1;
+  }
+
+  return terminalFd;
+}
+
+
+
+void SIMULATED_USART1_Reset(void)
+{
+  REGISTER(offsetof(USART_TypeDef, SR)) = SR_RESET;
+
+  receiver.count = 0;
+  receiver.nextByteNs = SIMULATED_BOARD_NEVER;
+  receiver.idleNs = SIMULATED_BOARD_NEVER;
+  transmitter.isBusy = 0;
+  transmitter.isDataPending = 0;
+  transmitter.endNs = SIMULATED_BOARD_NEVER;
+}
+
+
+
+/*
+  DR keeps the received data, the data written goes to the transmitter.
+  TC and RXNE are cleared by writing 0, the other flags are read only.
+*/
+void SIMULATED_USART1_Write(uint32_t offset, uint32_t value)
+{
+  switch(offset) {
+    case offsetof(USART_TypeDef, SR):
+      REGISTER(offset) &= value | ~(USART_SR_TC | USART_SR_RXNE);
+      break;
+
+    case offsetof(USART_TypeDef, DR):
+      WriteData(value);
+      break;
+
+    default:
+      REGISTER(offset) = value;
+      break;
+  }
+}
+
+
+
+void SIMULATED_USART1_Advance(uint64_t timeNs)
+{
+  ReadTerminal(timeNs);
+  while(receiver.nextByteNs <= timeNs) {
+    ReceiveByte(receiver.nextByteNs);
+  }
+  if(receiver.idleNs <= timeNs) {
+    SetIdle();
+  }
+
+  while(transmitter.endNs <= timeNs) {
+    TransmitNext(transmitter.endNs);
+  }
+  FlushOutput();
+}
+
+
+
+uint64_t SIMULATED_USART1_GetNextEventTime(void)
+{
+  uint64_t nextEventNs = transmitter.endNs;
+
+  if(receiver.nextByteNs < nextEventNs) {
+    nextEventNs = receiver.nextByteNs;
+  }
+  if(receiver.idleNs < nextEventNs) {
+    nextEventNs = receiver.idleNs;
+  }
+
+  return nextEventNs;
+}
+
+
+
+/* DMA2 stream 7 was enabled, the transmitter fetches from it if idle. */
+void SIMULATED_USART1_StartTransmission(void)
+{
+  if(transmitter.isBusy == 0 && IsEnabled(TRANSMITTER_ENABLED) != 0) {
+    TransmitNext(SIMULATED_BOARD_GetTime());
+  }
+}
+
+
+
+const simulatedUsart1Statistics_t *SIMULATED_USART1_GetStatistics(void)
+{
+  return &statistics;
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+static void WriteData(uint32_t value)
+{
+  if(IsEnabled(TRANSMITTER_ENABLED) == 0) {
+    return;
+  }
+
+  transmitter.pendingData = (uint8_t)value;
+  transmitter.isDataPending = 1;
+  REGISTER(offsetof(USART_TypeDef, SR)) &= ~USART_SR_TXE;
+  if(transmitter.isBusy == 0) {
+    TransmitNext(SIMULATED_BOARD_GetTime());
+  }
+}
+
+
+
+/* Only while the receiver is on, as the line is not sampled otherwise. */
+static void ReadTerminal(uint64_t timeNs)
+{
+  while(IsEnabled(RECEIVER_ENABLED) != 0 && receiver.count < RX_FIFO_SIZE) {
+    uint32_t tail = (receiver.head + receiver.count) % RX_FIFO_SIZE;
+    uint32_t room = receiver.head + receiver.count < RX_FIFO_SIZE ?
+      RX_FIFO_SIZE - tail : receiver.head - tail;
+    ssize_t readCount = read(terminalFd, &receiver.fifo[tail], room);
+    if(readCount <= 0) {
+      break;
+    }
+    if(receiver.count == 0 && receiver.nextByteNs == SIMULATED_BOARD_NEVER) {
+      receiver.nextByteNs = GetByteEndTime(timeNs);
+    }
+    receiver.count += (uint32_t)readCount;
+  }
+}
+
+
+
+/*
+  The stop bit is in: the byte goes to DMA2 stream 2 with DMAR set, to DR
+  otherwise, and is lost if DR was not read. IDLE follows one byte time
+  after the last byte, and only clears with the next one here, the SR then
+  DR reads of the firmware being invisible to the model.
+*/
+static void ReceiveByte(uint64_t timeNs)
+{
+  uint8_t data = receiver.fifo[receiver.head];
+
+  receiver.head = (receiver.head + 1U) % RX_FIFO_SIZE;
+  --receiver.count;
+  receiver.nextByteNs = receiver.count != 0 ? GetByteEndTime(timeNs) :
+    SIMULATED_BOARD_NEVER;
+  receiver.idleNs = GetByteEndTime(timeNs);
+  ++statistics.rxBytesCount;
+
+  REGISTER(offsetof(USART_TypeDef, SR)) &= ~USART_SR_IDLE;
+  if((REGISTER(offsetof(USART_TypeDef, CR3)) & USART_CR3_DMAR) != 0 &&
+    SIMULATED_DMA2_WritePeripheralData(SIMULATED_DMA2_STREAM_USART1_RX,
+    data) == 0) {
+    return;
+  }
+
+  if((REGISTER(offsetof(USART_TypeDef, SR)) & USART_SR_RXNE) != 0) {
+    REGISTER(offsetof(USART_TypeDef, SR)) |= USART_SR_ORE;
+    ++statistics.rxOverrunsCount;
+    return;
+  }
+  REGISTER(offsetof(USART_TypeDef, DR)) = data;
+  REGISTER(offsetof(USART_TypeDef, SR)) |= USART_SR_RXNE;
+  if((REGISTER(offsetof(USART_TypeDef, CR1)) & USART_CR1_RXNEIE) != 0) {
+    SIMULATED_CORE_RaiseIrq(USART1_IRQn);
+  }
+}
+
+
+
+static void SetIdle(void)
+{
+  receiver.idleNs = SIMULATED_BOARD_NEVER;
+  REGISTER(offsetof(USART_TypeDef, SR)) |= USART_SR_IDLE;
+  if((REGISTER(offsetof(USART_TypeDef, CR1)) & USART_CR1_IDLEIE) != 0) {
+    SIMULATED_CORE_RaiseIrq(USART1_IRQn);
+  }
+}
+
+
+
+/*
+  The shift register is free at timeNs: the next byte comes from DR, or
+  from DMA2 stream 7 with DMAT set. TC is set once nothing is left.
+*/
+static void TransmitNext(uint64_t timeNs)
+{
+  uint32_t data;
+
+  if(transmitter.isDataPending != 0) {
+    data = transmitter.pendingData;
+    transmitter.isDataPending = 0;
+    REGISTER(offsetof(USART_TypeDef, SR)) |= USART_SR_TXE;
+  } else if((REGISTER(offsetof(USART_TypeDef, CR3)) & USART_CR3_DMAT) == 0 ||
+    SIMULATED_DMA2_ReadPeripheralData(SIMULATED_DMA2_STREAM_USART1_TX,
+    &data) != 0) {
+    transmitter.isBusy = 0;
+    transmitter.endNs = SIMULATED_BOARD_NEVER;
+    REGISTER(offsetof(USART_TypeDef, SR)) |= USART_SR_TC;
+    if((REGISTER(offsetof(USART_TypeDef, CR1)) & USART_CR1_TCIE) != 0) {
+      SIMULATED_CORE_RaiseIrq(USART1_IRQn);
+    }
+    return;
+  }
+
+  transmitter.isBusy = 1;
+  transmitter.endNs = GetByteEndTime(timeNs);
+  REGISTER(offsetof(USART_TypeDef, SR)) &= ~USART_SR_TC;
+
+  ++statistics.txBytesCount;
+  if(transmitter.outputCount < TX_OUTPUT_SIZE) {
+    transmitter.output[transmitter.outputCount++] = (uint8_t)data;
+  } else {
+    ++statistics.txDroppedBytesCount;
+  }
+}
+
+
+
+/* Whatever the terminal cannot take is lost, as with no one listening. */
+static void FlushOutput(void)
+{
+  if(transmitter.outputCount == 0) {
+    return;
+  }
+
+  ssize_t writtenCount = terminalFd >= 0 ?
+    write(terminalFd, transmitter.output, transmitter.outputCount) : -1;
+  if(writtenCount < 0) {
+    writtenCount = 0;
+  }
+
+  statistics.txDroppedBytesCount +=
+    transmitter.outputCount - (uint32_t)writtenCount;
+  transmitter.outputCount = 0;
+}
+
+
+
+/*
+  One byte time after timeNs, from BRR and PCLK2 with 16 times
+  oversampling unless the baud rate is fixed.
+*/
+static uint64_t GetByteEndTime(uint64_t timeNs)
+{
+  uint32_t baudRate = fixedBaudRate;
+
+  if(baudRate == 0) {
+    uint32_t divider = REGISTER(offsetof(USART_TypeDef, BRR)) & 0xFFFFU;
+    baudRate = divider != 0 ? SIMULATED_CLOCK_Get()->pclk2Hz / divider : 0;
+  }
+  if(baudRate == 0) {
+    return SIMULATED_BOARD_NEVER;
+  }
+
+  return timeNs +
+    (BITS_PER_BYTE * NANOSECONDS_IN_SECOND + baudRate - 1U) / baudRate;
+}
+
+
+
+static int IsEnabled(uint32_t bits)
+{
+  return (REGISTER(offsetof(USART_TypeDef, CR1)) & bits) == bits;
+}
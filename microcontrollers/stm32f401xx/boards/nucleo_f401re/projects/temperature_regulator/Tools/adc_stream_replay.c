@@ -0,0 +1,98 @@
+#include "adc_oversampling.h"
+
+#include <ctype.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define LINE_LENGTH_MAX 128
+
+#define ADC_CODE_MAX 4095
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+static uint16_t samplesBlock[ADC_OVERSAMPLING_BLOCK_SIZE];
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static int ParseAdcCode(const char *line, uint16_t *adcCode);
+
+
+
+/*****************************************************************************/
+/*                                 MAIN                                      */
+/*****************************************************************************/
+
+/*
+  Feeds a recorded ADC stream through the firmware block reduction and prints
+  one filtered reading per block. Input lines are either bare ADC codes or
+  DataLogs lines ("timestamp ON|OFF adc temperature time").
+*/
+int main(void)
+{
+  char line[LINE_LENGTH_MAX];
+  uint32_t samplesCount = 0;
+  uint32_t blocksCount = 0;
+
+  while(fgets(line, sizeof(line), stdin) != NULL) {
+    uint16_t adcCode;
+    if(ParseAdcCode(line, &adcCode) != 0) {
+      continue;
+    }
+
+    samplesBlock[samplesCount++] = adcCode;
+    if(samplesCount < ADC_OVERSAMPLING_BLOCK_SIZE) {
+      continue;
+    }
+    samplesCount = 0;
+
+    uint32_t filteredReading = ADC_OVERSAMPLING_ReduceBlock(samplesBlock);
+    printf("%" PRIu32 " %" PRIu32 " %.4f\n", blocksCount++, filteredReading,
+      (double)filteredReading / (1U << ADC_OVERSAMPLING_EXTRA_BITS));
+  }
+
+  return EXIT_SUCCESS;
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+static int ParseAdcCode(const char *line, uint16_t *adcCode)
+{
+  unsigned long timestamp;
+  char heaterState[4];
+  unsigned int value;
+  int fieldsCount;
+
+  if(isalpha((unsigned char)line[0])) {
+    fieldsCount = sscanf(line, "%3s %u", heaterState, &value) - 1;
+  } else if(sscanf(line, "%lu %3s %u", &timestamp, heaterState, &value) == 3) {
+    fieldsCount = 1;
+  } else {
+    fieldsCount = sscanf(line, "%u", &value);
+  }
+
+  if(fieldsCount != 1 || value > ADC_CODE_MAX) {
+    return -1;
+  }
+
+  *adcCode = (uint16_t)value;
+  return 0;
+}
@@ -0,0 +1,304 @@
+#include "command_frame.h"
+#include "crc32.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define CRC_CHECKS_COUNT 100000
+#define CRC_CHECK_LENGTH_MAX 64
+
+#define ROUND_TRIPS_COUNT 100000
+
+#define BENCHMARK_FRAMES_COUNT 2000
+#define BENCHMARK_ROUNDS 1000
+#define BENCHMARK_CRC_LENGTH 1024
+#define BENCHMARK_CRC_ROUNDS 20000
+
+/* Reference manual example: 0x12345678 fed after a reset reads 0xDF8A8A2B. */
+#define REFERENCE_WORD 0x12345678UL
+#define REFERENCE_CRC  0xDF8A8A2BUL
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static int CheckCrc(void);
+static int CheckRoundTrips(void);
+static int CheckBitErrors(const commandFrame_t *frame);
+static commandFrameStatus_t DecodeFrame(const uint8_t *encoded,
+  uint32_t length, commandFrame_t *frame);
+static void BuildRandomFrame(commandFrame_t *frame);
+static int AreFramesEqual(const commandFrame_t *a, const commandFrame_t *b);
+static uint32_t CalculateBitwiseCrc(const uint8_t *data, uint32_t length);
+static void RunBenchmark(void);
+static double GetSeconds(void);
+
+
+
+/*****************************************************************************/
+/*                                 MAIN                                      */
+/*****************************************************************************/
+
+/*
+  Checks the software CRC32_Calculate bit by bit against the CRC unit
+  algorithm of the reference manual, checks that random command frames
+  survive COBS encoding and decoding and that every single bit error on the
+  line is rejected, then measures host throughput of the encoder, the
+  decoder and the CRC.
+*/
+int main(void)
+{
+  int failuresCount = 0;
+
+  srand(1);
+
+  failuresCount += CheckCrc();
+  failuresCount += CheckRoundTrips();
+  RunBenchmark();
+
+  return failuresCount == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+static int CheckCrc(void)
+{
+  uint8_t data[CRC_CHECK_LENGTH_MAX];
+  int failuresCount = 0;
+
+  const uint8_t referenceData[] = {
+    (uint8_t)REFERENCE_WORD, (uint8_t)(REFERENCE_WORD >> 8),
+    (uint8_t)(REFERENCE_WORD >> 16), (uint8_t)(REFERENCE_WORD >> 24)
+  };
+  if(CRC32_Calculate(referenceData, sizeof(referenceData)) != REFERENCE_CRC) {
+    fprintf(stderr, "CRC of 0x%08lX is 0x%08lX, expected 0x%08lX\n",
+      REFERENCE_WORD, (unsigned long)CRC32_Calculate(referenceData,
+      sizeof(referenceData)), REFERENCE_CRC);
+    ++failuresCount;
+  }
+
+  for(int check = 0; check < CRC_CHECKS_COUNT; ++check) {
+    uint32_t length = (uint32_t)rand() % (CRC_CHECK_LENGTH_MAX + 1);
+    for(uint32_t byte = 0; byte < length; ++byte) {
+      data[byte] = (uint8_t)rand();
+    }
+    if(CRC32_Calculate(data, length) != CalculateBitwiseCrc(data, length)) {
+      ++failuresCount;
+    }
+  }
+
+  printf("crc                %d lengths checked, %d mismatches\n",
+    CRC_CHECKS_COUNT, failuresCount);
+
+  return failuresCount;
+}
+
+
+
+static int CheckRoundTrips(void)
+{
+  uint8_t encoded[COMMAND_FRAME_ENCODED_SIZE_MAX];
+  commandFrame_t frame;
+  commandFrame_t decodedFrame;
+  int failuresCount = 0;
+  int undetectedErrorsCount = 0;
+
+  for(int trip = 0; trip < ROUND_TRIPS_COUNT; ++trip) {
+    BuildRandomFrame(&frame);
+    uint32_t length = COMMAND_FRAME_Encode(&frame, encoded);
+
+    if(memchr(encoded, COMMAND_FRAME_DELIMITER, length - 1) != NULL ||
+      DecodeFrame(encoded, length, &decodedFrame) != CommandFrame_Received ||
+      AreFramesEqual(&frame, &decodedFrame) == 0) {
+      ++failuresCount;
+    }
+    if(trip % 100 == 0) {
+      undetectedErrorsCount += CheckBitErrors(&frame);
+    }
+  }
+
+  printf("round trip         %d frames, %d failures, %d undetected bit "
+    "errors\n", ROUND_TRIPS_COUNT, failuresCount, undetectedErrorsCount);
+
+  return failuresCount + undetectedErrorsCount;
+}
+
+
+
+/* Flips every bit of the encoded frame except the delimiter. */
+static int CheckBitErrors(const commandFrame_t *frame)
+{
+  uint8_t encoded[COMMAND_FRAME_ENCODED_SIZE_MAX];
+  commandFrame_t decodedFrame;
+  int undetectedErrorsCount = 0;
+
+  uint32_t length = COMMAND_FRAME_Encode(frame, encoded);
+  for(uint32_t bit = 0; bit < 8 * (length - 1); ++bit) {
+    encoded[bit / 8] ^= (uint8_t)(1U << (bit % 8));
+    if(DecodeFrame(encoded, length, &decodedFrame) == CommandFrame_Received) {
+      ++undetectedErrorsCount;
+    }
+    encoded[bit / 8] ^= (uint8_t)(1U << (bit % 8));
+  }
+
+  return undetectedErrorsCount;
+}
+
+
+
+/* Returns the status of the last completed frame in the bytes. */
+static commandFrameStatus_t DecodeFrame(const uint8_t *encoded,
+  uint32_t length, commandFrame_t *frame)
+{
+  commandFrameDecoder_t decoder;
+  commandFrameStatus_t status = CommandFrame_Incomplete;
+
+  COMMAND_FRAME_InitDecoder(&decoder);
+  for(uint32_t byte = 0; byte < length; ++byte) {
+    commandFrameStatus_t byteStatus =
+      COMMAND_FRAME_FeedByte(&decoder, encoded[byte], frame);
+    if(byteStatus != CommandFrame_Incomplete) {
+      status = byteStatus;
+    }
+  }
+
+  return status;
+}
+
+
+
+/* Payloads are dense in zero bytes to exercise the COBS blocks. */
+static void BuildRandomFrame(commandFrame_t *frame)
+{
+  frame->commandId = (uint8_t)rand();
+  frame->payloadLength =
+    (uint8_t)((uint32_t)rand() % (COMMAND_FRAME_PAYLOAD_SIZE_MAX + 1));
+  for(uint32_t byte = 0; byte < frame->payloadLength; ++byte) {
+    frame->payload[byte] = (rand() % 4 == 0) ? 0 : (uint8_t)rand();
+  }
+}
+
+
+
+static int AreFramesEqual(const commandFrame_t *a, const commandFrame_t *b)
+{
+  return a->commandId == b->commandId &&
+    a->payloadLength == b->payloadLength &&
+    memcmp(a->payload, b->payload, a->payloadLength) == 0;
+}
+
+
+
+/*
+  The CRC unit as described in the reference manual: each little-endian
+  word is shifted in from bit 31, the last word padded with zero bytes.
+*/
+static uint32_t CalculateBitwiseCrc(const uint8_t *data, uint32_t length)
+{
+  uint32_t crc = 0xFFFFFFFFUL;
+
+  for(uint32_t offset = 0; offset < length; offset += 4) {
+    uint32_t word = 0;
+    for(uint32_t byte = 0; byte < 4 && offset + byte < length; ++byte) {
+      word |= (uint32_t)data[offset + byte] << (8 * byte);
+    }
+
+    crc ^= word;
+    for(uint32_t bit = 0; bit < 32; ++bit) {
+      if((crc & 0x80000000UL) != 0) {
+        crc = (crc << 1) ^ 0x04C11DB7UL;
+      } else {
+        crc <<= 1;
+      }
+    }
+  }
+
+  return crc;
+}
+
+
+
+static void RunBenchmark(void)
+{
+  static uint8_t encodedFrames[BENCHMARK_FRAMES_COUNT]
+    [COMMAND_FRAME_ENCODED_SIZE_MAX];
+  static uint32_t encodedLengths[BENCHMARK_FRAMES_COUNT];
+  static uint8_t crcData[BENCHMARK_CRC_LENGTH];
+  commandFrame_t frame;
+  commandFrameDecoder_t decoder;
+  volatile uint32_t sink = 0;
+
+  /* Typical command, two payload bytes. */
+  frame.commandId = COMMAND_FRAME_ID_LED2_BLINKS;
+  frame.payloadLength = 2;
+  frame.payload[0] = 3;
+  frame.payload[1] = 0;
+
+  double start = GetSeconds();
+  uint64_t encodedBytesCount = 0;
+  for(int round = 0; round < BENCHMARK_ROUNDS; ++round) {
+    for(size_t index = 0; index < BENCHMARK_FRAMES_COUNT; ++index) {
+      frame.payload[1] = (uint8_t)index;
+      encodedLengths[index] = COMMAND_FRAME_Encode(&frame,
+        encodedFrames[index]);
+      encodedBytesCount += encodedLengths[index];
+    }
+  }
+  double encodeSeconds = GetSeconds() - start;
+
+  COMMAND_FRAME_InitDecoder(&decoder);
+  start = GetSeconds();
+  for(int round = 0; round < BENCHMARK_ROUNDS; ++round) {
+    for(size_t index = 0; index < BENCHMARK_FRAMES_COUNT; ++index) {
+      for(uint32_t byte = 0; byte < encodedLengths[index]; ++byte) {
+        sink += (uint32_t)COMMAND_FRAME_FeedByte(&decoder,
+          encodedFrames[index][byte], &frame);
+      }
+    }
+  }
+  double decodeSeconds = GetSeconds() - start;
+
+  for(size_t byte = 0; byte < sizeof(crcData); ++byte) {
+    crcData[byte] = (uint8_t)rand();
+  }
+  start = GetSeconds();
+  for(int round = 0; round < BENCHMARK_CRC_ROUNDS; ++round) {
+    crcData[0] = (uint8_t)round;
+    sink += CRC32_Calculate(crcData, sizeof(crcData));
+  }
+  double crcSeconds = GetSeconds() - start;
+
+  printf("encode             %.1f ns per frame, %.1f MB/s\n",
+    1e9 * encodeSeconds / (BENCHMARK_FRAMES_COUNT * BENCHMARK_ROUNDS),
+    (double)encodedBytesCount / encodeSeconds / 1e6);
+  printf("decode             %.1f ns per frame, %.1f MB/s\n",
+    1e9 * decodeSeconds / (BENCHMARK_FRAMES_COUNT * BENCHMARK_ROUNDS),
+    (double)encodedBytesCount / decodeSeconds / 1e6);
+  printf("crc32 (software)   %.1f MB/s\n",
+    (double)BENCHMARK_CRC_LENGTH * BENCHMARK_CRC_ROUNDS / crcSeconds / 1e6);
+}
+
+
+
+static double GetSeconds(void)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+
+  return (double)now.tv_sec + 1e-9 * (double)now.tv_nsec;
+}
@@ -0,0 +1,201 @@
+#include "command_frame.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+/*
+  The control settings payload of the regulator: three int32 gains, the
+  derivative filter shift byte and the uint16 relay window.
+*/
+#define CONTROL_SETTINGS_VALUES_COUNT 5
+#define CONTROL_SETTINGS_GAINS_COUNT  3
+#define CONTROL_SETTINGS_PAYLOAD_SIZE 15U
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE STRUCTURES                              */
+/*****************************************************************************/
+
+typedef struct commandName {
+  const char *name;
+  uint8_t commandId;
+}commandName_t;
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+static const commandName_t COMMAND_NAMES[] = {
+  { "led", COMMAND_FRAME_ID_LED2_BLINKS },
+  { "tune", COMMAND_FRAME_ID_AUTOTUNE },
+  { "cpu", COMMAND_FRAME_ID_CPU_REPORT },
+  { "trace", COMMAND_FRAME_ID_TRACE_DUMP },
+  { "flash", COMMAND_FRAME_ID_FLASH_BENCHMARK },
+  { "ctrl", COMMAND_FRAME_ID_CONTROL_SETTINGS }
+};
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static int ParseByte(const char *text, uint8_t *byte);
+static int ParseCommandId(const char *text, uint8_t *commandId);
+static int ParsePayloadBytes(int count, char *texts[], commandFrame_t *frame);
+static int ParseControlSettings(int count, char *texts[],
+  commandFrame_t *frame);
+
+
+
+/*****************************************************************************/
+/*                                 MAIN                                      */
+/*****************************************************************************/
+
+/*
+  Writes one command frame to stdout, led, tune, cpu, trace, flash or a
+  numeric ID followed by the payload bytes. ctrl takes the proportional,
+  integral and derivative gains in the pidSettings_t format, the derivative
+  filter shift and the relay window in ms instead of bytes. The frame
+  starts with a delimiter, which ends any partial frame the device may be
+  holding.
+
+  Usage: command_frame_encoder led 3 2 > /dev/ttyACM0
+         command_frame_encoder ctrl 51200 85 3072000 4 10000 > /dev/ttyACM0
+*/
+int main(int argc, char *argv[])
+{
+  commandFrame_t frame;
+  uint8_t encoded[1 + COMMAND_FRAME_ENCODED_SIZE_MAX];
+
+  if(argc < 2 || ParseCommandId(argv[1], &frame.commandId) != 0) {
+    fprintf(stderr,
+      "usage: %s led|tune|cpu|trace|flash|<id> [payload bytes]\n"
+      "       %s ctrl <kp> <ki> <kd> <filter shift> <window ms>\n",
+      argv[0], argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  int result = frame.commandId == COMMAND_FRAME_ID_CONTROL_SETTINGS ?
+    ParseControlSettings(argc - 2, &argv[2], &frame) :
+    ParsePayloadBytes(argc - 2, &argv[2], &frame);
+  if(result != 0) {
+    return EXIT_FAILURE;
+  }
+
+  encoded[0] = COMMAND_FRAME_DELIMITER;
+  uint32_t length = 1 + COMMAND_FRAME_Encode(&frame, &encoded[1]);
+  fwrite(encoded, 1, length, stdout);
+
+  return EXIT_SUCCESS;
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+static int ParseByte(const char *text, uint8_t *byte)
+{
+  char *end;
+  unsigned long value = strtoul(text, &end, 0);
+
+  if(*text == '\0' || *end != '\0' || value > 0xFF) {
+    return -1;
+  }
+  *byte = (uint8_t)value;
+
+  return 0;
+}
+
+
+
+static int ParseCommandId(const char *text, uint8_t *commandId)
+{
+  for(size_t index = 0; index < sizeof(COMMAND_NAMES) /
+    sizeof(COMMAND_NAMES[0]); ++index) {
+    if(strcmp(text, COMMAND_NAMES[index].name) == 0) {
+      *commandId = COMMAND_NAMES[index].commandId;
+      return 0;
+    }
+  }
+
+  return ParseByte(text, commandId);
+}
+
+
+
+static int ParsePayloadBytes(int count, char *texts[], commandFrame_t *frame)
+{
+  if(count > (int)COMMAND_FRAME_PAYLOAD_SIZE_MAX) {
+    fprintf(stderr, "at most %u payload bytes\n",
+      COMMAND_FRAME_PAYLOAD_SIZE_MAX);
+    return -1;
+  }
+
+  frame->payloadLength = (uint8_t)count;
+  for(int byte = 0; byte < count; ++byte) {
+    if(ParseByte(texts[byte], &frame->payload[byte]) != 0) {
+      fprintf(stderr, "%s is not a byte\n", texts[byte]);
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+
+
+/* Only the encoding is checked here, the device checks the ranges. */
+static int ParseControlSettings(int count, char *texts[],
+  commandFrame_t *frame)
+{
+  int64_t values[CONTROL_SETTINGS_VALUES_COUNT];
+
+  if(count != CONTROL_SETTINGS_VALUES_COUNT) {
+    fprintf(stderr, "ctrl takes %d values\n", CONTROL_SETTINGS_VALUES_COUNT);
+    return -1;
+  }
+
+  for(int index = 0; index < count; ++index) {
+    char *end;
+    values[index] = strtoll(texts[index], &end, 0);
+    if(*texts[index] == '\0' || *end != '\0') {
+      fprintf(stderr, "%s is not a number\n", texts[index]);
+      return -1;
+    }
+  }
+  if(values[0] < INT32_MIN || values[0] > INT32_MAX ||
+    values[1] < INT32_MIN || values[1] > INT32_MAX ||
+    values[2] < INT32_MIN || values[2] > INT32_MAX ||
+    values[3] < 0 || values[3] > UINT8_MAX ||
+    values[4] < 0 || values[4] > UINT16_MAX) {
+    fprintf(stderr, "ctrl value out of its field\n");
+    return -1;
+  }
+
+  uint32_t offset = 0;
+  for(int gain = 0; gain < CONTROL_SETTINGS_GAINS_COUNT; ++gain) {
+    uint32_t value = (uint32_t)(int32_t)values[gain];
+    for(int byte = 0; byte < 4; ++byte) {
+      frame->payload[offset++] = (uint8_t)(value >> (8 * byte));
+    }
+  }
+  frame->payload[offset++] = (uint8_t)values[3];
+  frame->payload[offset++] = (uint8_t)values[4];
+  frame->payload[offset] = (uint8_t)(values[4] >> 8);
+  frame->payloadLength = CONTROL_SETTINGS_PAYLOAD_SIZE;
+
+  return 0;
+}
@@ -0,0 +1,69 @@
+#include "data_log.h"
+#include "thermistor_lookup_table.h"
+
+#include <ctype.h>
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+/*
+  The firmware pads the telemetry fields with NUL characters, they are read
+  as spaces so that the line can be parsed as a C string. Returns -1 at the
+  end of the stream.
+*/
+int DATA_LOG_ReadLine(FILE *stream, char *line, size_t lineSize)
+{
+  size_t length = 0;
+  int character;
+
+  while((character = fgetc(stream)) != EOF && character != '\n') {
+    if(length < lineSize - 1) {
+      line[length++] = character == '\0' ? ' ' : (char)character;
+    }
+  }
+  line[length] = '\0';
+
+  return (character == EOF && length == 0) ? -1 : 0;
+}
+
+
+
+/*
+  Lines are "[host time] ON|OFF adc temperature device time". The host time
+  is used when present, the device clock of some traces was not set. The
+  temperature is recomputed from the ADC code with the firmware lookup
+  table, older traces logged it rounded to whole degrees.
+*/
+int DATA_LOG_ParseLine(const char *line, dataLogSample_t *sample)
+{
+  long hostTime;
+  char heaterState[4];
+  unsigned int adcCode;
+  double loggedTemperature;
+  long deviceTime;
+
+  if(isalpha((unsigned char)line[0])) {
+    if(sscanf(line, "%3s %u %lf %ld", heaterState, &adcCode,
+      &loggedTemperature, &deviceTime) != 4) {
+      return -1;
+    }
+    sample->timeInSeconds = deviceTime;
+  } else {
+    if(sscanf(line, "%ld %3s %u", &hostTime, heaterState, &adcCode) != 3) {
+      return -1;
+    }
+    sample->timeInSeconds = hostTime;
+  }
+
+  if(adcCode >= THERMISTOR_LOOKUP_TABLE_SIZE) {
+    return -1;
+  }
+
+  sample->adcCode = adcCode;
+  sample->temperature = thermistorLookupTable[adcCode];
+  sample->isHeaterOn = heaterState[0] == 'O' && heaterState[1] == 'N';
+  return 0;
+}
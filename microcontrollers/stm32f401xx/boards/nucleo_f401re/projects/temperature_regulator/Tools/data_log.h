@@ -0,0 +1,51 @@
+#ifndef DATA_LOG_H
+#define DATA_LOG_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include <stdint.h>
+#include <stdio.h>
+
+
+
+/*****************************************************************************/
+/*                            PUBLIC DEFINES                                 */
+/*****************************************************************************/
+
+#define DATA_LOG_LINE_LENGTH_MAX 128
+
+
+
+/*****************************************************************************/
+/*                           PUBLIC STRUCTURES                               */
+/*****************************************************************************/
+
+/* temperature uses TEMPERATURE_FRACTIONAL_BITS fractional bits. */
+typedef struct dataLogSample {
+  long timeInSeconds;
+  uint32_t adcCode;
+  int32_t temperature;
+  uint32_t isHeaterOn;
+}dataLogSample_t;
+
+
+
+/*****************************************************************************/
+/*                      PUBLIC FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+int DATA_LOG_ReadLine(FILE *stream, char *line, size_t lineSize);
+int DATA_LOG_ParseLine(const char *line, dataLogSample_t *sample);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* DATA_LOG_H */
@@ -0,0 +1,254 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define OBJECTS_COUNT_MAX 4096
+#define NAME_LENGTH_MAX   96
+#define LINE_LENGTH_MAX   256
+
+#define OBJECT_SIZE_MIN_DEFAULT 32
+
+#define LINKER_SYMBOLS_REQUIRED_MASK 0x7FU
+#define LINKER_SYMBOL_MIN_FREE_RAM_SIZE_MASK 0x80U
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE STRUCTURES                              */
+/*****************************************************************************/
+
+typedef struct ramObject {
+  char name[NAME_LENGTH_MAX];
+  char type;
+  uint32_t size;
+}ramObject_t;
+
+
+
+/*
+  Linker script symbols, only their values matter. _estack is the end of
+  RAM and .data starts at its origin. _Min_Free_Ram_Size, the RAM the link
+  has to leave, is missing from older builds.
+*/
+typedef struct linkerSymbols {
+  uint32_t sdata;
+  uint32_t edata;
+  uint32_t sbss;
+  uint32_t ebss;
+  uint32_t estack;
+  uint32_t minHeapSize;
+  uint32_t minStackSize;
+  uint32_t minFreeRamSize;
+  uint32_t foundMask;
+}linkerSymbols_t;
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+static ramObject_t objects[OBJECTS_COUNT_MAX];
+static uint32_t objectsCount;
+
+static linkerSymbols_t linkerSymbols;
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static void ParseLine(const char *line);
+static void StoreLinkerSymbol(const char *name, uint32_t value);
+static int CompareObjects(const void *first, const void *second);
+static void PrintReport(uint32_t objectSizeMin);
+
+
+
+/*****************************************************************************/
+/*                                 MAIN                                      */
+/*****************************************************************************/
+
+/*
+  Reads the symbol table of the firmware, as written by the post-build step
+  of the STM32CubeIDE project:
+
+    arm-none-eabi-nm -S -td temperature_regulator.elf
+
+  and prints every RAM object of at least -m bytes (32 by default) from the
+  largest down, the .data and .bss totals, the heap and main stack reserved
+  by the linker script, the RAM left and the part of it the link keeps
+  free.
+
+  Usage: ram_budget_report [-m bytes] < temperature_regulator.symbols
+*/
+int main(int argc, char *argv[])
+{
+  uint32_t objectSizeMin = OBJECT_SIZE_MIN_DEFAULT;
+
+  int option;
+  while((option = getopt(argc, argv, "m:")) != -1) {
+    if(option == 'm') {
+      objectSizeMin = (uint32_t)strtoul(optarg, NULL, 10);
+    } else {
+      fprintf(stderr, "usage: %s [-m bytes] < symbols\n", argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  char line[LINE_LENGTH_MAX];
+  while(fgets(line, sizeof(line), stdin) != NULL) {
+    ParseLine(line);
+  }
+
+  if((linkerSymbols.foundMask & LINKER_SYMBOLS_REQUIRED_MASK) !=
+    LINKER_SYMBOLS_REQUIRED_MASK) {
+    fprintf(stderr, "linker script symbols missing, is this nm -S -td "
+      "output of the firmware?\n");
+    return EXIT_FAILURE;
+  }
+
+  qsort(objects, objectsCount, sizeof(objects[0]), CompareObjects);
+  PrintReport(objectSizeMin);
+
+  return EXIT_SUCCESS;
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+/*
+  Lines are "value size type name" for objects and "value type name" for
+  symbols without a size, values in decimal.
+*/
+static void ParseLine(const char *line)
+{
+  char fields[4][NAME_LENGTH_MAX];
+  int fieldsCount = sscanf(line, "%95s %95s %95s %95s", fields[0], fields[1],
+    fields[2], fields[3]);
+
+  if(fieldsCount == 3) {
+    StoreLinkerSymbol(fields[2], (uint32_t)strtoul(fields[0], NULL, 10));
+    return;
+  }
+
+  if(fieldsCount != 4 || strlen(fields[2]) != 1 ||
+    strchr("bBdD", fields[2][0]) == NULL) {
+    return;
+  }
+
+  if(objectsCount == OBJECTS_COUNT_MAX) {
+    fprintf(stderr, "more than %d objects, the rest is ignored\n",
+      OBJECTS_COUNT_MAX);
+    ++objectsCount;
+    return;
+  }
+  if(objectsCount > OBJECTS_COUNT_MAX) {
+    return;
+  }
+
+  ramObject_t *object = &objects[objectsCount++];
+  snprintf(object->name, sizeof(object->name), "%s", fields[3]);
+  object->type = fields[2][0];
+  object->size = (uint32_t)strtoul(fields[1], NULL, 10);
+}
+
+
+
+static void StoreLinkerSymbol(const char *name, uint32_t value)
+{
+  static const char *const NAMES[] = {
+    "_sdata", "_edata", "_sbss", "_ebss", "_estack", "_Min_Heap_Size",
+    "_Min_Stack_Size", "_Min_Free_Ram_Size"
+  };
+  uint32_t *const VALUES[] = {
+    &linkerSymbols.sdata, &linkerSymbols.edata, &linkerSymbols.sbss,
+    &linkerSymbols.ebss, &linkerSymbols.estack, &linkerSymbols.minHeapSize,
+    &linkerSymbols.minStackSize, &linkerSymbols.minFreeRamSize
+  };
+
+  for(uint32_t symbol = 0; symbol < sizeof(NAMES) / sizeof(NAMES[0]);
+    ++symbol) {
+    if(strcmp(name, NAMES[symbol]) == 0) {
+      *VALUES[symbol] = value;
+      linkerSymbols.foundMask |= 1U << symbol;
+    }
+  }
+}
+
+
+
+static int CompareObjects(const void *first, const void *second)
+{
+  const ramObject_t *firstObject = first;
+  const ramObject_t *secondObject = second;
+
+  if(firstObject->size != secondObject->size) {
+    return firstObject->size < secondObject->size ? 1 : -1;
+  }
+  return strcmp(firstObject->name, secondObject->name);
+}
+
+
+
+static void PrintReport(uint32_t objectSizeMin)
+{
+  uint32_t ramSize = linkerSymbols.estack - linkerSymbols.sdata;
+  uint32_t dataSize = linkerSymbols.edata - linkerSymbols.sdata;
+  uint32_t bssSize = linkerSymbols.ebss - linkerSymbols.sbss;
+  uint32_t reservedSize = linkerSymbols.minHeapSize +
+    linkerSymbols.minStackSize;
+  uint32_t usedSize = linkerSymbols.ebss - linkerSymbols.sdata +
+    reservedSize;
+
+  uint32_t listedSize = 0;
+  uint32_t otherSize = 0;
+  uint32_t otherCount = 0;
+
+  printf("%8s  %s\n", "bytes", "object");
+  for(uint32_t object = 0; object < objectsCount &&
+    object < OBJECTS_COUNT_MAX; ++object) {
+    if(objects[object].size < objectSizeMin) {
+      otherSize += objects[object].size;
+      ++otherCount;
+      continue;
+    }
+    printf("%8" PRIu32 "  %s%s\n", objects[object].size,
+      objects[object].name,
+      (objects[object].type == 'd' || objects[object].type == 'D') ?
+      " (.data)" : "");
+    listedSize += objects[object].size;
+  }
+  printf("%8" PRIu32 "  %" PRIu32 " objects below %" PRIu32 " bytes\n",
+    otherSize, otherCount, objectSizeMin);
+
+  printf("\n");
+  printf("%8" PRIu32 "  .data\n", dataSize);
+  printf("%8" PRIu32 "  .bss\n", bssSize);
+  printf("%8" PRIu32 "  heap (_Min_Heap_Size)\n", linkerSymbols.minHeapSize);
+  printf("%8" PRIu32 "  main stack (_Min_Stack_Size)\n",
+    linkerSymbols.minStackSize);
+  uint32_t symbolsSize = listedSize + otherSize;
+  printf("%8" PRIu32 "  alignment and objects without symbols\n",
+    dataSize + bssSize > symbolsSize ? dataSize + bssSize - symbolsSize : 0);
+  printf("%8" PRIu32 "  used of %" PRIu32 " (%" PRIu32 ".%" PRIu32 "%%)\n",
+    usedSize, ramSize, usedSize * 100U / ramSize,
+    (usedSize * 1000U / ramSize) % 10U);
+  printf("%8" PRIu32 "  free\n", ramSize - usedSize);
+  if((linkerSymbols.foundMask & LINKER_SYMBOL_MIN_FREE_RAM_SIZE_MASK) != 0) {
+    printf("%8" PRIu32 "  free kept by the link (_Min_Free_Ram_Size)\n",
+      linkerSymbols.minFreeRamSize);
+  }
+}
@@ -0,0 +1,285 @@
+#include "adc_oversampling.h"
+#include "data_log.h"
+#include "relay_window.h"
+#include "simulated_adc.h"
+#include "step_response.h"
+#include "temperature_control.h"
+#include "thermal_plant.h"
+#include "thermistor_lookup_table.h"
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+/*
+  Plant fitted with thermal_plant_fit to TemperatureSetPoint_50C (heater on
+  for the whole trace), dead time from the relay oscillation of
+  TemperatureTestMeasurement_v2.
+*/
+#define AMBIENT_TEMPERATURE_DEFAULT 22.0
+#define HEATER_GAIN_DEFAULT         23.5
+#define TIME_CONSTANT_DEFAULT       1300.0
+#define DEAD_TIME_DEFAULT           15.0
+
+#define SET_POINT_DEFAULT 35.0
+#define HOURS_DEFAULT 4.0
+#define SETTLING_BAND_DEFAULT 0.5
+
+/* Noise of single conversions in ADC codes, seen on the bench recordings. */
+#define ADC_NOISE_DEFAULT 2.0
+
+/* Firmware timing: one filtered reading per second, relay edges in ms. */
+#define READING_PERIOD_MS 1000
+#define PLANT_STEP_MS 10
+
+#define MILLISECONDS_IN_SECOND 1000
+#define SECONDS_IN_HOUR 3600
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE STRUCTURES                              */
+/*****************************************************************************/
+
+typedef struct simulationSettings {
+  thermalPlantParameters_t plant;
+  double setPoint;
+  double hours;
+  double settlingBand;
+  double adcNoise;
+  uint32_t relayWindowMs;
+  int32_t proportionalGain;
+  int32_t integralGain;
+  int32_t derivativeGain;
+  uint32_t isPidOverridden;
+  const char *traceFileName;
+}simulationSettings_t;
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+static thermalPlant_t plant;
+static temperatureControl_t temperatureControl;
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static int ParseArguments(int argc, char *argv[],
+                          simulationSettings_t *settings);
+static void PrintUsage(const char *programName);
+
+
+
+/*****************************************************************************/
+/*                                 MAIN                                      */
+/*****************************************************************************/
+
+/*
+  Runs the firmware control step (temperature_control.c) and relay window
+  timing (relay_window.c) against a first order lag plus dead time plant.
+  Every second 256 noisy ADC conversions of the plant temperature go through
+  the firmware oversampling, the resulting duty switches the relay at the
+  start of every window. Prints the step response metrics and the relay
+  switch count, optionally writes a DataLogs trace.
+*/
+int main(int argc, char *argv[])
+{
+  simulationSettings_t settings = {
+    .plant = {
+      .ambientTemperature  = AMBIENT_TEMPERATURE_DEFAULT,
+      .heaterGain          = HEATER_GAIN_DEFAULT,
+      .timeConstantSeconds = TIME_CONSTANT_DEFAULT,
+      .deadTimeSeconds     = DEAD_TIME_DEFAULT
+    },
+    .setPoint = SET_POINT_DEFAULT,
+    .hours = HOURS_DEFAULT,
+    .settlingBand = SETTLING_BAND_DEFAULT,
+    .adcNoise = ADC_NOISE_DEFAULT,
+    .relayWindowMs = RELAY_WINDOW_MS_DEFAULT
+  };
+  if(ParseArguments(argc, argv, &settings) != 0) {
+    PrintUsage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  if(THERMAL_PLANT_Init(&plant, &settings.plant,
+    (double)PLANT_STEP_MS / MILLISECONDS_IN_SECOND,
+    settings.plant.ambientTemperature) != 0) {
+    fprintf(stderr, "dead time too long\n");
+    return EXIT_FAILURE;
+  }
+
+  TEMPERATURE_CONTROL_Init(&temperatureControl,
+    (int32_t)lround(settings.setPoint * TEMPERATURE_FROM_DEGREES(1)),
+    READING_PERIOD_MS);
+  if(settings.isPidOverridden != 0) {
+    pidSettings_t pidSettings = temperatureControl.pid.settings;
+    pidSettings.proportionalGain = settings.proportionalGain;
+    pidSettings.integralGain = settings.integralGain;
+    pidSettings.derivativeGain = settings.derivativeGain;
+    PID_CONTROLLER_SetSettings(&temperatureControl.pid, &pidSettings);
+  }
+
+  size_t readingsCount = (size_t)(settings.hours * SECONDS_IN_HOUR);
+  dataLogSample_t *samples = calloc(readingsCount, sizeof(*samples));
+  if(samples == NULL || readingsCount == 0) {
+    fprintf(stderr, "no readings to simulate\n");
+    return EXIT_FAILURE;
+  }
+
+  FILE *traceFile = NULL;
+  if(settings.traceFileName != NULL) {
+    traceFile = fopen(settings.traceFileName, "w");
+    if(traceFile == NULL) {
+      perror(settings.traceFileName);
+      return EXIT_FAILURE;
+    }
+  }
+
+  clock_t startClock = clock();
+  uint32_t heaterDuty = 0;
+  uint32_t pulseTimeMs = 0;
+  uint32_t isRelayOn = 0;
+  uint32_t relaySwitchesCount = 0;
+  uint32_t timeMs = 0;
+
+  for(size_t reading = 0; reading < readingsCount; ++reading) {
+    for(uint32_t step = 0; step < READING_PERIOD_MS / PLANT_STEP_MS; ++step) {
+      uint32_t windowTimeMs = timeMs % settings.relayWindowMs;
+      if(windowTimeMs == 0) {
+        pulseTimeMs = RELAY_WINDOW_CalculatePulseTime(settings.relayWindowMs,
+          heaterDuty);
+      }
+
+      uint32_t isRelayOnNow = windowTimeMs < pulseTimeMs;
+      relaySwitchesCount += isRelayOnNow != isRelayOn;
+      isRelayOn = isRelayOnNow;
+
+      THERMAL_PLANT_Step(&plant, isRelayOn != 0 ? 1.0 : 0.0);
+      timeMs += PLANT_STEP_MS;
+    }
+
+    uint32_t filteredReading =
+      SIMULATED_ADC_ConvertBlock(plant.temperature, settings.adcNoise);
+    if(TEMPERATURE_CONTROL_IsReadingValid(filteredReading) == 0) {
+      PID_CONTROLLER_Reset(&temperatureControl.pid);
+      heaterDuty = 0;
+      pulseTimeMs = 0;
+    } else {
+      heaterDuty = (uint32_t)TEMPERATURE_CONTROL_Update(&temperatureControl,
+        filteredReading);
+    }
+
+    dataLogSample_t *sample = &samples[reading];
+    sample->timeInSeconds = (long)(timeMs / MILLISECONDS_IN_SECOND);
+    sample->adcCode = ADC_OVERSAMPLING_TO_ADC_CODE(filteredReading);
+    sample->temperature = temperatureControl.temperature;
+    sample->isHeaterOn = isRelayOn;
+
+    if(traceFile != NULL) {
+      fprintf(traceFile, "%ld %s %" PRIu32 " %.1f %ld\n",
+        sample->timeInSeconds, isRelayOn != 0 ? "ON" : "OFF", sample->adcCode,
+        (double)sample->temperature / TEMPERATURE_FROM_DEGREES(1),
+        sample->timeInSeconds);
+    }
+  }
+
+  double elapsedSeconds = (double)(clock() - startClock) / CLOCKS_PER_SEC;
+
+  printf("plant              ambient %.2f C, gain %.2f C, time constant "
+    "%.0f s, dead time %.0f s\n", settings.plant.ambientTemperature,
+    settings.plant.heaterGain, settings.plant.timeConstantSeconds,
+    settings.plant.deadTimeSeconds);
+  const pidSettings_t *pidSettings = &temperatureControl.pid.settings;
+  printf("controller         KP %" PRId32 " KI %" PRId32 " KD %" PRId32
+    ", window %" PRIu32 " ms\n", pidSettings->proportionalGain,
+    pidSettings->integralGain, pidSettings->derivativeGain,
+    settings.relayWindowMs);
+  STEP_RESPONSE_PrintMetrics(samples, readingsCount, settings.setPoint,
+    settings.settlingBand);
+  printf("relay switches     %" PRIu32 " (%.1f per hour)\n",
+    relaySwitchesCount, relaySwitchesCount / settings.hours);
+  printf("simulated          %.2f h in %.2f s\n", settings.hours,
+    elapsedSeconds);
+
+  if(traceFile != NULL) {
+    fclose(traceFile);
+  }
+  free(samples);
+
+  return EXIT_SUCCESS;
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+static int ParseArguments(int argc, char *argv[],
+                          simulationSettings_t *settings)
+{
+  int option;
+  uint32_t pidGainsCount = 0;
+
+  while((option = getopt(argc, argv, "s:h:b:a:g:t:d:w:n:P:I:D:o:")) != -1) {
+    switch(option) {
+      case 's': settings->setPoint = atof(optarg); break;
+      case 'h': settings->hours = atof(optarg); break;
+      case 'b': settings->settlingBand = atof(optarg); break;
+      case 'a': settings->plant.ambientTemperature = atof(optarg); break;
+      case 'g': settings->plant.heaterGain = atof(optarg); break;
+      case 't': settings->plant.timeConstantSeconds = atof(optarg); break;
+      case 'd': settings->plant.deadTimeSeconds = atof(optarg); break;
+      case 'w': settings->relayWindowMs = (uint32_t)atoi(optarg); break;
+      case 'n': settings->adcNoise = atof(optarg); break;
+      case 'P': settings->proportionalGain = atoi(optarg); ++pidGainsCount;
+        break;
+      case 'I': settings->integralGain = atoi(optarg); ++pidGainsCount; break;
+      case 'D': settings->derivativeGain = atoi(optarg); ++pidGainsCount;
+        break;
+      case 'o': settings->traceFileName = optarg; break;
+      default: return -1;
+    }
+  }
+
+  /* Gains come as a set, the way the autotuner reports them. */
+  if(pidGainsCount != 0 && pidGainsCount != 3) {
+    return -1;
+  }
+  settings->isPidOverridden = pidGainsCount != 0;
+
+  if(settings->relayWindowMs < PLANT_STEP_MS ||
+    settings->plant.timeConstantSeconds <= 0.0 || settings->hours <= 0.0) {
+    return -1;
+  }
+
+  return 0;
+}
+
+
+
+static void PrintUsage(const char *programName)
+{
+  fprintf(stderr,
+    "usage: %s [-s set point] [-h hours] [-b settling band]\n"
+    "       [-a ambient] [-g heater gain] [-t time constant s] "
+    "[-d dead time s]\n"
+    "       [-w relay window ms] [-n ADC noise codes]\n"
+    "       [-P KP -I KI -D KD] [-o trace.txt]\n", programName);
+}
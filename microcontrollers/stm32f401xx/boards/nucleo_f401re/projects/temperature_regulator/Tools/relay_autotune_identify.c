@@ -0,0 +1,126 @@
+#include "data_log.h"
+#include "relay_autotuner.h"
+#include "relay_window.h"
+#include "thermistor_lookup_table.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+/* Hysteresis of the on/off controller the DataLogs were recorded with. */
+#define HYSTERESIS_DEFAULT 0.25
+
+#define CYCLES_COUNT_DEFAULT 4
+
+#define MILLISECONDS_IN_SECOND 1000
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static void PrintResults(const relayAutotunerResults_t *results);
+static double ToDegrees(int32_t fixedPointValue);
+
+
+
+/*****************************************************************************/
+/*                                 MAIN                                      */
+/*****************************************************************************/
+
+/*
+  Runs the firmware relay autotuner identification (relay_autotuner.c) on a
+  recorded DataLogs trace. The relay states are taken from the trace, so any
+  on/off regulated recording around a set point is a relay experiment.
+
+  Usage: relay_autotune_identify <set point> [hysteresis] [cycles] < trace.txt
+*/
+int main(int argc, char *argv[])
+{
+  if(argc < 2) {
+    fprintf(stderr, "usage: %s <set point> [hysteresis] [cycles] "
+      "< trace.txt\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  relayAutotunerSettings_t settings = {
+    .setPoint = (int32_t)(atof(argv[1]) * TEMPERATURE_FROM_DEGREES(1)),
+    .hysteresis = (int32_t)((argc > 2 ? atof(argv[2]) : HYSTERESIS_DEFAULT) *
+      TEMPERATURE_FROM_DEGREES(1)),
+    .relayAmplitude = RELAY_WINDOW_DUTY_MAX / 2,
+    .cyclesCount = argc > 3 ? (uint32_t)atoi(argv[3]) : CYCLES_COUNT_DEFAULT,
+    .timeoutMs = UINT32_MAX,
+    .derivativeFilterShift = 0
+  };
+
+  relayAutotuner_t tuner;
+  relayAutotunerStatus_t status = RelayAutotuner_Running;
+  char line[DATA_LOG_LINE_LENGTH_MAX];
+  dataLogSample_t sample;
+  long startTime = -1;
+
+  while(status == RelayAutotuner_Running &&
+    DATA_LOG_ReadLine(stdin, line, sizeof(line)) == 0) {
+    if(DATA_LOG_ParseLine(line, &sample) != 0) {
+      continue;
+    }
+    if(startTime < 0) {
+      startTime = sample.timeInSeconds;
+      RELAY_AUTOTUNER_Init(&tuner, &settings, 0);
+    }
+
+    uint32_t timeMs =
+      (uint32_t)(sample.timeInSeconds - startTime) * MILLISECONDS_IN_SECOND;
+    status = RELAY_AUTOTUNER_Observe(&tuner, timeMs, sample.temperature,
+      sample.isHeaterOn);
+  }
+
+  if(status != RelayAutotuner_Finished) {
+    fprintf(stderr, "trace ended after %" PRIu32 " of %" PRIu32
+      " relay cycles\n", startTime < 0 ? 0 : tuner.measuredCyclesCount,
+      settings.cyclesCount);
+    return EXIT_FAILURE;
+  }
+
+  relayAutotunerResults_t results;
+  RELAY_AUTOTUNER_GetResults(&tuner, &results);
+  PrintResults(&results);
+
+  return EXIT_SUCCESS;
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+static void PrintResults(const relayAutotunerResults_t *results)
+{
+  printf("oscillation amplitude  %.3f C\n",
+    ToDegrees(results->oscillationAmplitude));
+  printf("ultimate period        %.1f s\n",
+    (double)results->ultimatePeriodMs / MILLISECONDS_IN_SECOND);
+  printf("ultimate gain          %.1f per mille / C\n",
+    ToDegrees(results->ultimateGain));
+  printf("proportional gain      %.1f per mille / C\n",
+    ToDegrees(results->pid.proportionalGain));
+  printf("integral gain          %.4f per mille / (C s)\n",
+    ToDegrees(results->pid.integralGain));
+  printf("derivative gain        %.1f per mille s / C\n",
+    ToDegrees(results->pid.derivativeGain));
+}
+
+
+
+static double ToDegrees(int32_t fixedPointValue)
+{
+  return (double)fixedPointValue / (1 << PID_CONTROLLER_FRACTIONAL_BITS);
+}
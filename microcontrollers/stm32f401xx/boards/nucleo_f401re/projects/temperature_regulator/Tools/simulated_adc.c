@@ -0,0 +1,121 @@
+#include "simulated_adc.h"
+
+#include "adc_oversampling.h"
+#include "thermistor_lookup_table.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define ADC_CODE_MAX 4095
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+static uint16_t samplesBlock[ADC_OVERSAMPLING_BLOCK_SIZE];
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static double TemperatureToAdcCode(double temperature);
+static double GaussianNoise(void);
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+/* One oversampling block of noisy conversions, reduced like the firmware. */
+uint32_t SIMULATED_ADC_ConvertBlock(double temperature, double adcNoise)
+{
+  for(uint32_t sample = 0; sample < ADC_OVERSAMPLING_BLOCK_SIZE; ++sample) {
+    samplesBlock[sample] = SIMULATED_ADC_Convert(temperature, adcNoise);
+  }
+
+  return ADC_OVERSAMPLING_ReduceBlock(samplesBlock);
+}
+
+
+
+/* A single conversion of the thermistor input at temperature. */
+uint16_t SIMULATED_ADC_Convert(double temperature, double adcNoise)
+{
+  double noisyCode = floor(TemperatureToAdcCode(temperature) +
+    adcNoise * GaussianNoise() + 0.5);
+
+  if(noisyCode < 0.0) {
+    noisyCode = 0.0;
+  } else if(noisyCode > ADC_CODE_MAX) {
+    noisyCode = ADC_CODE_MAX;
+  }
+
+  return (uint16_t)noisyCode;
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+/*
+  Inverse of the firmware lookup table, interpolated between the codes.
+  Entries grow with the code, temperatures past the valid range map just
+  outside it so the out of range handling gets exercised.
+*/
+static double TemperatureToAdcCode(double temperature)
+{
+  int32_t fixedPointTemperature =
+    (int32_t)lround(temperature * TEMPERATURE_FROM_DEGREES(1));
+
+  if(fixedPointTemperature < thermistorLookupTable[ADC_MEASUREMENT_MIN]) {
+    return ADC_MEASUREMENT_MIN - 1;
+  }
+  if(fixedPointTemperature >= thermistorLookupTable[ADC_MEASUREMENT_MAX]) {
+    return ADC_MEASUREMENT_MAX + 1;
+  }
+
+  uint32_t lowCode = ADC_MEASUREMENT_MIN;
+  uint32_t highCode = ADC_MEASUREMENT_MAX;
+  while(highCode - lowCode > 1) {
+    uint32_t middleCode = (lowCode + highCode) / 2;
+    if(thermistorLookupTable[middleCode] <= fixedPointTemperature) {
+      lowCode = middleCode;
+    } else {
+      highCode = middleCode;
+    }
+  }
+
+  double lowTemperature = thermistorLookupTable[lowCode];
+  double highTemperature = thermistorLookupTable[highCode];
+  double fraction = highTemperature > lowTemperature ?
+    (temperature * TEMPERATURE_FROM_DEGREES(1) - lowTemperature) /
+    (highTemperature - lowTemperature) : 0.0;
+
+  return lowCode + fraction;
+}
+
+
+
+/* Box-Muller, fixed seed of rand() so runs are repeatable. */
+static double GaussianNoise(void)
+{
+  const double pi = 3.14159265358979323846;
+
+  double uniform1 = (rand() + 1.0) / (RAND_MAX + 2.0);
+  double uniform2 = (rand() + 1.0) / (RAND_MAX + 2.0);
+
+  return sqrt(-2.0 * log(uniform1)) * cos(2.0 * pi * uniform2);
+}
@@ -0,0 +1,28 @@
+#ifndef SIMULATED_ADC_H
+#define SIMULATED_ADC_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/*                      PUBLIC FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+uint32_t SIMULATED_ADC_ConvertBlock(double temperature, double adcNoise);
+uint16_t SIMULATED_ADC_Convert(double temperature, double adcNoise);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* SIMULATED_ADC_H */
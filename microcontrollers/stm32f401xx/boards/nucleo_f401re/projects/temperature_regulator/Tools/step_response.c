@@ -0,0 +1,116 @@
+#include "step_response.h"
+#include "thermistor_lookup_table.h"
+
+#include <stdio.h>
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+/* Steady state statistics are taken over the last quarter of the trace. */
+#define STEADY_STATE_FRACTION_DIVISOR 4
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static double ToDegrees(int32_t temperature);
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+/*
+  Prints the rise time, peak overshoot, settling time within the band around
+  the set point and the steady state oscillation over the last quarter of
+  the samples, which have to be in time order.
+*/
+void STEP_RESPONSE_PrintMetrics(const dataLogSample_t *samples,
+  size_t samplesCount, double setPoint, double settlingBand)
+{
+  long startTime = samples[0].timeInSeconds;
+  long riseTime = -1;
+  long peakTime = -1;
+  double peakTemperature = ToDegrees(samples[0].temperature);
+  long settlingTime = -1;
+  size_t heaterOnCount = 0;
+
+  for(size_t sample = 0; sample < samplesCount; ++sample) {
+    const dataLogSample_t *current = &samples[sample];
+    double temperature = ToDegrees(current->temperature);
+
+    if(riseTime < 0 && temperature >= setPoint) {
+      riseTime = current->timeInSeconds - startTime;
+    }
+    if(riseTime >= 0 && temperature > peakTemperature) {
+      peakTemperature = temperature;
+      peakTime = current->timeInSeconds - startTime;
+    }
+    if(temperature < setPoint - settlingBand ||
+      temperature > setPoint + settlingBand) {
+      settlingTime = -1;
+    } else if(settlingTime < 0) {
+      settlingTime = current->timeInSeconds - startTime;
+    }
+    heaterOnCount += current->isHeaterOn;
+  }
+
+  size_t steadyStateStart =
+    samplesCount - samplesCount / STEADY_STATE_FRACTION_DIVISOR;
+  double steadyStateMin = ToDegrees(samples[steadyStateStart].temperature);
+  double steadyStateMax = steadyStateMin;
+  double steadyStateSum = 0.0;
+  for(size_t sample = steadyStateStart; sample < samplesCount; ++sample) {
+    double temperature = ToDegrees(samples[sample].temperature);
+    if(temperature < steadyStateMin) {
+      steadyStateMin = temperature;
+    }
+    if(temperature > steadyStateMax) {
+      steadyStateMax = temperature;
+    }
+    steadyStateSum += temperature;
+  }
+
+  printf("samples            %zu over %ld s\n", samplesCount,
+    samples[samplesCount - 1].timeInSeconds - startTime);
+  printf("initial            %.2f C\n", ToDegrees(samples[0].temperature));
+  printf("heater on          %.1f %%\n",
+    100.0 * (double)heaterOnCount / (double)samplesCount);
+
+  if(riseTime < 0) {
+    printf("rise time          set point %.2f C not reached\n", setPoint);
+  } else {
+    printf("rise time          %ld s\n", riseTime);
+    printf("peak overshoot     %.2f C at %ld s\n",
+      peakTemperature - setPoint, peakTime);
+  }
+
+  if(settlingTime < 0) {
+    printf("settling time      not settled within +-%.2f C\n", settlingBand);
+  } else {
+    printf("settling time      %ld s (+-%.2f C)\n", settlingTime,
+      settlingBand);
+  }
+
+  printf("steady state       mean %.2f C, min %.2f C, max %.2f C, "
+    "peak to peak %.2f C\n",
+    steadyStateSum / (double)(samplesCount - steadyStateStart),
+    steadyStateMin, steadyStateMax, steadyStateMax - steadyStateMin);
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+static double ToDegrees(int32_t temperature)
+{
+  return (double)temperature / TEMPERATURE_FROM_DEGREES(1);
+}
@@ -0,0 +1,30 @@
+#ifndef STEP_RESPONSE_H
+#define STEP_RESPONSE_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include "data_log.h"
+
+#include <stddef.h>
+
+
+
+/*****************************************************************************/
+/*                      PUBLIC FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+void STEP_RESPONSE_PrintMetrics(const dataLogSample_t *samples,
+  size_t samplesCount, double setPoint, double settlingBand);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* STEP_RESPONSE_H */
@@ -0,0 +1,66 @@
+#include "data_log.h"
+#include "step_response.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define SAMPLES_COUNT_MAX 65536
+
+#define SETTLING_BAND_DEFAULT 0.5
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+static dataLogSample_t samples[SAMPLES_COUNT_MAX];
+
+
+
+/*****************************************************************************/
+/*                                 MAIN                                      */
+/*****************************************************************************/
+
+/*
+  Reads a DataLogs trace from stdin and prints the rise time, peak overshoot,
+  settling time and steady state oscillation around the given set point.
+
+  Usage: step_response_metrics <set point> [settling band] < trace.txt
+*/
+int main(int argc, char *argv[])
+{
+  if(argc < 2) {
+    fprintf(stderr, "usage: %s <set point> [settling band] < trace.txt\n",
+      argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  double setPoint = atof(argv[1]);
+  double settlingBand = argc > 2 ? atof(argv[2]) : SETTLING_BAND_DEFAULT;
+
+  char line[DATA_LOG_LINE_LENGTH_MAX];
+  size_t samplesCount = 0;
+  while(samplesCount < SAMPLES_COUNT_MAX &&
+    DATA_LOG_ReadLine(stdin, line, sizeof(line)) == 0) {
+    if(DATA_LOG_ParseLine(line, &samples[samplesCount]) == 0) {
+      ++samplesCount;
+    }
+  }
+
+  if(samplesCount == 0) {
+    fprintf(stderr, "no samples\n");
+    return EXIT_FAILURE;
+  }
+
+  STEP_RESPONSE_PrintMetrics(samples, samplesCount, setPoint, settlingBand);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,406 @@
+#include "pid_controller.h"
+#include "telemetry_frame.h"
+#include "thermistor_lookup_table.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define TEMPERATURE_DECIMAL_SCALE 10
+
+#define MILLISECONDS_IN_SECOND 1000U
+#define HZ_IN_MHZ 1000000U
+#define CENTI_MICROSECONDS_IN_SECOND 100000000U
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+static uint8_t frame[TELEMETRY_FRAME_SIZE_MAX];
+static size_t frameBytesCount;
+static size_t frameSize;
+
+static int isHostTimePrinted;
+
+static unsigned long framesCount;
+static unsigned long samplesCount;
+static unsigned long rejectedFramesCount;
+static unsigned long lostSamplesCount;
+static unsigned long skippedBytesCount;
+static uint16_t expectedSequence;
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static void ProcessByte(uint8_t byte);
+static void ProcessFrame(void);
+static void RejectFrame(void);
+static void PrintMessage(const telemetryMessage_t *message);
+static void PrintSample(const telemetrySample_t *sample);
+static void PrintAutotune(const telemetryAutotune_t *autotune);
+static void PrintTraceRecords(const telemetryTraceRecords_t *trace);
+static void PrintSampling(const telemetrySampling_t *sampling);
+static void PrintCommandStatistics(
+  const telemetryCommandStatistics_t *command);
+static void PrintMicroseconds(const char *label, uint32_t cycles,
+  uint32_t cyclesPerSecond);
+static void PrintHostTime(void);
+
+
+
+/*****************************************************************************/
+/*                                 MAIN                                      */
+/*****************************************************************************/
+
+/*
+  Reads the USART1 byte stream of the regulator from stdin and prints every
+  frame as the text line the firmware used to send. Readings become
+  "ON|OFF adc temperature time", so the DataLogs tools keep working, the
+  reports (benchmarks, autotune, faults, statistics, trace dumps) and the
+  command echoes get their former lines too. With -t every line starts
+  with the host time, the way the DataLogs were recorded.
+
+  Usage: telemetry_decoder [-t] < /dev/ttyACM0
+*/
+int main(int argc, char *argv[])
+{
+  int option;
+  while((option = getopt(argc, argv, "t")) != -1) {
+    if(option == 't') {
+      isHostTimePrinted = 1;
+    } else {
+      fprintf(stderr, "usage: %s [-t] < stream\n", argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  int byte;
+  while((byte = getchar()) != EOF) {
+    ProcessByte((uint8_t)byte);
+  }
+
+  fprintf(stderr, "frames %lu, readings %lu, rejected %lu, lost readings "
+    "%lu, skipped bytes %lu\n", framesCount, samplesCount,
+    rejectedFramesCount, lostSamplesCount, skippedBytesCount);
+
+  return EXIT_SUCCESS;
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+/* The size of a frame is known once its header is in. */
+static void ProcessByte(uint8_t byte)
+{
+  if(frameBytesCount == 0 && byte != TELEMETRY_FRAME_SYNC_BYTE) {
+    ++skippedBytesCount;
+    return;
+  }
+
+  frame[frameBytesCount++] = byte;
+  if(frameBytesCount == TELEMETRY_FRAME_HEADER_SIZE) {
+    frameSize = TELEMETRY_FRAME_GetSize(frame);
+    if(frameSize == 0) {
+      RejectFrame();
+      return;
+    }
+  }
+  if(frameBytesCount > TELEMETRY_FRAME_HEADER_SIZE &&
+    frameBytesCount == frameSize) {
+    ProcessFrame();
+  }
+}
+
+
+
+static void ProcessFrame(void)
+{
+  telemetryMessage_t message;
+
+  if(TELEMETRY_FRAME_Decode(frame, (uint32_t)frameSize, &message) != 0) {
+    RejectFrame();
+    return;
+  }
+  frameBytesCount = 0;
+  ++framesCount;
+
+  PrintMessage(&message);
+}
+
+
+
+/*
+  A sync byte inside a frame lost in part, or a corrupted frame, is not a
+  frame: the bytes after the sync byte are scanned again, so the decoder
+  falls back in step with the next real frame.
+*/
+static void RejectFrame(void)
+{
+  uint8_t rejectedFrame[TELEMETRY_FRAME_SIZE_MAX];
+  size_t rejectedBytesCount = frameBytesCount;
+
+  memcpy(rejectedFrame, frame, rejectedBytesCount);
+  frameBytesCount = 0;
+  ++rejectedFramesCount;
+  ++skippedBytesCount;
+
+  for(size_t byte = 1; byte < rejectedBytesCount; ++byte) {
+    ProcessByte(rejectedFrame[byte]);
+  }
+}
+
+
+
+/* Same lines, rounding and formatting as the firmware used to send. */
+static void PrintMessage(const telemetryMessage_t *message)
+{
+  if(message->type == TelemetryFrame_Reading) {
+    PrintSample(&message->sample);
+    return;
+  }
+
+  PrintHostTime();
+  switch(message->type) {
+    case TelemetryFrame_Fault:
+      printf("FAULT %s %" PRIu32 "\n",
+        message->fault.fault == TelemetryFault_AdcWatchdog ?
+        "ADC_WATCHDOG" : "UNKNOWN", message->fault.timeInSeconds);
+      break;
+    case TelemetryFrame_ConversionBenchmark:
+      printf("CYCLES FIXED %" PRIu32 " FLOAT %" PRIu32 " FPU %u LAZY %u\n",
+        message->conversionBenchmark.fixedPointCyclesPerSample,
+        message->conversionBenchmark.floatCyclesPerSample,
+        message->conversionBenchmark.isHardwareFpuUsed,
+        message->conversionBenchmark.isLazyStackingEnabled);
+      break;
+    case TelemetryFrame_Autotune:
+      PrintAutotune(&message->autotune);
+      break;
+    case TelemetryFrame_LowPower:
+      printf("SLEEP %u.%u WAKE %" PRIu32 "\n",
+        message->lowPower.sleepPerMille / 10,
+        message->lowPower.sleepPerMille % 10,
+        message->lowPower.wakeupsCount);
+      break;
+    case TelemetryFrame_Clock:
+      printf("CLOCK %" PRIu32 "MHz SWITCH %" PRIu32 " BUSY %u.%u\n",
+        message->clock.frequencyHz / HZ_IN_MHZ, message->clock.switchesCount,
+        message->clock.busyPerMille / 10, message->clock.busyPerMille % 10);
+      break;
+    case TelemetryFrame_CpuTask:
+      printf("CPU %-15.15s %3u.%u%% %7" PRIu32 "us\n", message->cpuTask.name,
+        message->cpuTask.cpuPerMille / 10, message->cpuTask.cpuPerMille % 10,
+        message->cpuTask.maxActivationUs);
+      break;
+    case TelemetryFrame_FlashBenchmark:
+      printf("FLASH %" PRIu32 "MHz WS%u OFF %" PRIu32 ".%02" PRIu32 " ON %"
+        PRIu32 ".%02" PRIu32 "\n",
+        message->flashBenchmark.frequencyHz / HZ_IN_MHZ,
+        message->flashBenchmark.waitStatesCount,
+        message->flashBenchmark.acceleratorOffCentiCycles / 100,
+        message->flashBenchmark.acceleratorOffCentiCycles % 100,
+        message->flashBenchmark.acceleratorOnCentiCycles / 100,
+        message->flashBenchmark.acceleratorOnCentiCycles % 100);
+      break;
+    case TelemetryFrame_CommandEcho:
+      printf("%s%s %" PRIu32 "\n", message->commandEcho.name,
+        message->commandEcho.isRejected != 0 ? " REJECTED" : "",
+        message->commandEcho.timeInSeconds);
+      break;
+    case TelemetryFrame_TraceHeader:
+      printf("TRACE %" PRIu32 " %" PRIu32 " %" PRIu32 "\n",
+        message->traceHeader.recordsCount,
+        message->traceHeader.overwrittenCount,
+        message->traceHeader.cyclesPerSecond);
+      break;
+    case TelemetryFrame_TraceTask:
+      printf("TASK %u %s\n", message->traceName.number,
+        message->traceName.name);
+      break;
+    case TelemetryFrame_TraceQueue:
+      printf("QUEUE %u %s\n", message->traceName.number,
+        message->traceName.name);
+      break;
+    case TelemetryFrame_TraceRecords:
+      PrintTraceRecords(&message->traceRecords);
+      break;
+    case TelemetryFrame_TraceEnd:
+      printf("TRACE END\n");
+      break;
+    case TelemetryFrame_Sampling:
+      PrintSampling(&message->sampling);
+      break;
+    case TelemetryFrame_CommandStatistics:
+      PrintCommandStatistics(&message->commandStatistics);
+      break;
+    case TelemetryFrame_RxStatistics:
+      printf("RX FRAMES %" PRIu32 " FORMAT %" PRIu32 " CRC %" PRIu32
+        " UNKNOWN %" PRIu32 " OVERRUNS %" PRIu32 " LOST %" PRIu32
+        " MAXPENDING %" PRIu32 "\n",
+        message->rxStatistics.receivedFramesCount,
+        message->rxStatistics.formatErrorsCount,
+        message->rxStatistics.crcErrorsCount,
+        message->rxStatistics.unknownCommandsCount,
+        message->rxStatistics.overrunsCount,
+        message->rxStatistics.lostBytesCount,
+        message->rxStatistics.maxPendingBytesCount);
+      break;
+    case TelemetryFrame_TxStatistics:
+      printf("TX QUEUED %" PRIu32 " OVERFLOW %" PRIu32 " DROPPED %" PRIu32
+        " TRANSFERS %" PRIu32 " MAXQUEUED %" PRIu32 "\n",
+        message->txStatistics.queuedFramesCount,
+        message->txStatistics.overflowFramesCount,
+        message->txStatistics.droppedFramesCount,
+        message->txStatistics.transfersCount,
+        message->txStatistics.maxQueuedBytesCount);
+      break;
+    default:
+      printf("UNKNOWN FRAME %d\n", (int)message->type);
+      break;
+  }
+}
+
+
+
+static void PrintSample(const telemetrySample_t *sample)
+{
+  const int32_t roundingOffset = TEMPERATURE_FROM_DEGREES(1) / 2;
+  int32_t scaledTemperature = (sample->temperature *
+    TEMPERATURE_DECIMAL_SCALE + roundingOffset) >> TEMPERATURE_FRACTIONAL_BITS;
+
+  if(samplesCount != 0) {
+    lostSamplesCount += (uint16_t)(sample->sequence - expectedSequence);
+  }
+  expectedSequence = (uint16_t)(sample->sequence + 1);
+  ++samplesCount;
+
+  PrintHostTime();
+  printf("%s %" PRIu16 " %d.%d %" PRIu32 "\n",
+    (sample->flags & TELEMETRY_FRAME_FLAG_HEATER_ON) != 0 ? "ON" : "OFF",
+    sample->adcCode, (int)(scaledTemperature / TEMPERATURE_DECIMAL_SCALE),
+    abs((int)(scaledTemperature % TEMPERATURE_DECIMAL_SCALE)),
+    sample->timeInSeconds);
+}
+
+
+
+/*
+  "TUNE KU <per mille/C> TU <s>" followed by the derived gains in the
+  fixed-point format of pidSettings_t, "TUNE KP <n> KI <n> KD <n>", or
+  "TUNE FAILED".
+*/
+static void PrintAutotune(const telemetryAutotune_t *autotune)
+{
+  const int32_t roundingOffset = 1 << (PID_CONTROLLER_FRACTIONAL_BITS - 1);
+
+  if(autotune->isFinished == 0) {
+    printf("TUNE FAILED\n");
+    return;
+  }
+
+  printf("TUNE KU %" PRId32 " TU %" PRIu32 "\n",
+    (autotune->ultimateGain + roundingOffset) >>
+    PID_CONTROLLER_FRACTIONAL_BITS,
+    autotune->ultimatePeriodMs / MILLISECONDS_IN_SECOND);
+  PrintHostTime();
+  printf("TUNE KP %" PRId32 " KI %" PRId32 " KD %" PRId32 "\n",
+    autotune->proportionalGain, autotune->integralGain,
+    autotune->derivativeGain);
+}
+
+
+
+/* "TR" and 16 hex digits per record, the format trace_timeline reads. */
+static void PrintTraceRecords(const telemetryTraceRecords_t *trace)
+{
+  printf("TR");
+  for(uint32_t record = 0; record < trace->recordsCount; ++record) {
+    printf(" %08" PRIX32 "%02X%02X%04X", trace->records[record].cycles,
+      trace->records[record].event, trace->records[record].object,
+      trace->records[record].data);
+  }
+  printf("\n");
+}
+
+
+
+/*
+  "SAMPLING <readings> PERIOD <us> LAST <us> MIN <us> MAX <us> JITTER <us>",
+  the expected period first, then the measured ones.
+*/
+static void PrintSampling(const telemetrySampling_t *sampling)
+{
+  printf("SAMPLING %" PRIu32, sampling->readingsCount);
+  PrintMicroseconds("PERIOD", sampling->expectedPeriodCycles,
+    sampling->cyclesPerSecond);
+  PrintMicroseconds("LAST", sampling->lastPeriodCycles,
+    sampling->cyclesPerSecond);
+  PrintMicroseconds("MIN", sampling->minPeriodCycles,
+    sampling->cyclesPerSecond);
+  PrintMicroseconds("MAX", sampling->maxPeriodCycles,
+    sampling->cyclesPerSecond);
+  PrintMicroseconds("JITTER", sampling->maxJitterCycles,
+    sampling->cyclesPerSecond);
+  printf("\n");
+}
+
+
+
+/*
+  "COMMAND <name> DISPATCHED <n> REJECTED <n> DROPPED <n> LATENCY <us>
+  MAX <us>".
+*/
+static void PrintCommandStatistics(
+  const telemetryCommandStatistics_t *command)
+{
+  printf("COMMAND %s DISPATCHED %" PRIu32 " REJECTED %" PRIu32 " DROPPED %"
+    PRIu32, command->name, command->dispatchedCount, command->rejectedCount,
+    command->droppedCount);
+  PrintMicroseconds("LATENCY", command->lastLatencyCycles,
+    command->cyclesPerSecond);
+  PrintMicroseconds("MAX", command->maxLatencyCycles,
+    command->cyclesPerSecond);
+  printf("\n");
+}
+
+
+
+/* Cycles as microseconds with two decimals, one cycle is 12 ns at 84 MHz. */
+static void PrintMicroseconds(const char *label, uint32_t cycles,
+  uint32_t cyclesPerSecond)
+{
+  uint64_t centiMicroseconds = 0;
+  if(cyclesPerSecond != 0) {
+    centiMicroseconds = ((uint64_t)cycles * CENTI_MICROSECONDS_IN_SECOND +
+      cyclesPerSecond / 2) / cyclesPerSecond;
+  }
+
+  printf(" %s %" PRIu64 ".%02u", label, centiMicroseconds / 100,
+    (unsigned)(centiMicroseconds % 100));
+}
+
+
+
+static void PrintHostTime(void)
+{
+  if(isHostTimePrinted != 0) {
+    printf("%ld ", (long)time(NULL));
+  }
+}
@@ -0,0 +1,192 @@
+#include "adc_oversampling.h"
+#include "temperature_conversion.h"
+#include "thermistor_lookup_table.h"
+#include "thermistor_reference.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define FIRST_READING (ADC_MEASUREMENT_MIN << ADC_OVERSAMPLING_EXTRA_BITS)
+#define LAST_READING  (ADC_MEASUREMENT_MAX << ADC_OVERSAMPLING_EXTRA_BITS)
+
+#define TEMPERATURE_LSB (1.0 / TEMPERATURE_FROM_DEGREES(1))
+
+/* Rounding of the table to the nearest Q7.8 value. */
+#define MAX_ALLOWED_CODE_DIFFERENCE (0.5 * TEMPERATURE_LSB)
+
+#define BENCHMARK_ROUNDS 2000
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static int CheckAccuracy(void);
+static void RunBenchmark(void);
+static double GetSeconds(void);
+static uint64_t GetCycleCount(void);
+
+
+
+/*****************************************************************************/
+/*                                 MAIN                                      */
+/*****************************************************************************/
+
+/*
+  Compares the fixed-point conversion of the firmware (lookup table and
+  interpolation on the oversampling fractional bits) with the float chain
+  the regulator ran before, over the valid ADC range, then measures both on
+  the host per sample. Cycles are read from the time stamp counter where
+  the host has one.
+*/
+int main(void)
+{
+  int failuresCount = CheckAccuracy();
+  RunBenchmark();
+
+  return failuresCount == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+/*
+  Whole ADC codes must match the float chain up to the Q7.8 rounding. The
+  float chain has no answer between codes, readings with fractional bits
+  are compared with its value linearly interpolated between the two codes.
+*/
+static int CheckAccuracy(void)
+{
+  int failuresCount = 0;
+  double maxCodeDifference = 0.0;
+  double maxReadingDifference = 0.0;
+  double readingDifferencesSum = 0.0;
+  uint32_t readingsCount = 0;
+
+  for(uint32_t reading = FIRST_READING; reading <= LAST_READING; ++reading) {
+    uint32_t adcCode = ADC_OVERSAMPLING_TO_ADC_CODE(reading);
+    double fraction = (double)(reading - (adcCode <<
+      ADC_OVERSAMPLING_EXTRA_BITS)) / (1U << ADC_OVERSAMPLING_EXTRA_BITS);
+
+    double lowerTemperature =
+      THERMISTOR_REFERENCE_AdcCodeToTemperature(adcCode);
+    double referenceTemperature = lowerTemperature;
+    if(fraction > 0.0) {
+      double upperTemperature =
+        THERMISTOR_REFERENCE_AdcCodeToTemperature(adcCode + 1);
+      referenceTemperature += (upperTemperature - lowerTemperature) * fraction;
+    }
+
+    double temperature =
+      TEMPERATURE_CONVERSION_ReadingToTemperature(reading) * TEMPERATURE_LSB;
+    double difference = fabs(temperature - referenceTemperature);
+
+    if(fraction == 0.0) {
+      if(difference > MAX_ALLOWED_CODE_DIFFERENCE) {
+        fprintf(stderr, "ADC code %u: fixed-point %.4f, float %.4f\n",
+          (unsigned)adcCode, temperature, referenceTemperature);
+        ++failuresCount;
+      }
+      if(difference > maxCodeDifference) {
+        maxCodeDifference = difference;
+      }
+    }
+    if(difference > maxReadingDifference) {
+      maxReadingDifference = difference;
+    }
+    readingDifferencesSum += difference;
+    ++readingsCount;
+  }
+
+  printf("whole codes        max difference %.4f degree, %d mismatches\n",
+    maxCodeDifference, failuresCount);
+  printf("all readings       max difference %.4f degree, mean %.4f degree\n",
+    maxReadingDifference, readingDifferencesSum / readingsCount);
+
+  return failuresCount;
+}
+
+
+
+/*
+  The float chain only takes whole codes, it gets the code of each reading.
+  Both loops go over the same readings in the same order.
+*/
+static void RunBenchmark(void)
+{
+  const uint32_t samplesCount =
+    (uint32_t)BENCHMARK_ROUNDS * (LAST_READING - FIRST_READING + 1);
+  volatile int32_t fixedPointSink = 0;
+  volatile float floatSink = 0.0f;
+
+  double start = GetSeconds();
+  uint64_t startCycleCount = GetCycleCount();
+  for(int round = 0; round < BENCHMARK_ROUNDS; ++round) {
+    for(uint32_t reading = FIRST_READING; reading <= LAST_READING;
+      ++reading) {
+      fixedPointSink = TEMPERATURE_CONVERSION_ReadingToTemperature(reading);
+    }
+  }
+  uint64_t fixedPointCycles = GetCycleCount() - startCycleCount;
+  double fixedPointSeconds = GetSeconds() - start;
+
+  start = GetSeconds();
+  startCycleCount = GetCycleCount();
+  for(int round = 0; round < BENCHMARK_ROUNDS; ++round) {
+    for(uint32_t reading = FIRST_READING; reading <= LAST_READING;
+      ++reading) {
+      floatSink = THERMISTOR_REFERENCE_AdcCodeToTemperature(
+        ADC_OVERSAMPLING_TO_ADC_CODE(reading));
+    }
+  }
+  uint64_t floatCycles = GetCycleCount() - startCycleCount;
+  double floatSeconds = GetSeconds() - start;
+
+  (void)fixedPointSink;
+  (void)floatSink;
+
+  printf("fixed-point        %.2f ns, %.1f cycles per sample\n",
+    1e9 * fixedPointSeconds / samplesCount,
+    (double)fixedPointCycles / samplesCount);
+  printf("float chain        %.2f ns, %.1f cycles per sample\n",
+    1e9 * floatSeconds / samplesCount, (double)floatCycles / samplesCount);
+}
+
+
+
+static double GetSeconds(void)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+
+  return (double)now.tv_sec + 1e-9 * (double)now.tv_nsec;
+}
+
+
+
+/* Zero on hosts without a time stamp counter, only the times are printed. */
+static uint64_t GetCycleCount(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
@@ -0,0 +1,59 @@
+#include "thermal_plant.h"
+
+#include <math.h>
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+/*
+  The heater is assumed off for the whole dead time before the start.
+  Returns -1 if the dead time does not fit the history at this step.
+*/
+int THERMAL_PLANT_Init(thermalPlant_t *plant,
+  const thermalPlantParameters_t *parameters, double stepSeconds,
+  double initialTemperature)
+{
+  size_t delayStepsCount =
+    (size_t)(parameters->deadTimeSeconds / stepSeconds + 0.5);
+  if(delayStepsCount >= THERMAL_PLANT_DELAY_STEPS_MAX) {
+    return -1;
+  }
+
+  plant->parameters = *parameters;
+  plant->temperature = initialTemperature;
+  plant->stepFactor =
+    1.0 - exp(-stepSeconds / parameters->timeConstantSeconds);
+  plant->delayStepsCount = delayStepsCount;
+  plant->delayIndex = 0;
+  for(size_t step = 0; step <= delayStepsCount; ++step) {
+    plant->heaterPowerHistory[step] = 0.0f;
+  }
+
+  return 0;
+}
+
+
+
+/*
+  Advances the plant by one step with the heater power held over the step
+  and returns the new temperature. The lag is discretized exactly, so the
+  step only has to resolve the relay edges, not the time constant.
+*/
+double THERMAL_PLANT_Step(thermalPlant_t *plant, double heaterPower)
+{
+  plant->heaterPowerHistory[plant->delayIndex] = (float)heaterPower;
+  plant->delayIndex = plant->delayIndex < plant->delayStepsCount ?
+    plant->delayIndex + 1 : 0;
+  double delayedHeaterPower = plant->heaterPowerHistory[plant->delayIndex];
+
+  const thermalPlantParameters_t *parameters = &plant->parameters;
+  double targetTemperature = parameters->ambientTemperature +
+    parameters->heaterGain * delayedHeaterPower;
+  plant->temperature +=
+    plant->stepFactor * (targetTemperature - plant->temperature);
+
+  return plant->temperature;
+}
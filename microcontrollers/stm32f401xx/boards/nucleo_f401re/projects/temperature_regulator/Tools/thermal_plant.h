@@ -0,0 +1,67 @@
+#ifndef THERMAL_PLANT_H
+#define THERMAL_PLANT_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include <stddef.h>
+
+
+
+/*****************************************************************************/
+/*                            PUBLIC DEFINES                                 */
+/*****************************************************************************/
+
+/* Dead time of 600 s at the 10 ms simulation step. */
+#define THERMAL_PLANT_DELAY_STEPS_MAX 60000
+
+
+
+/*****************************************************************************/
+/*                           PUBLIC STRUCTURES                               */
+/*****************************************************************************/
+
+/*
+  First order lag plus dead time: the oven settles at ambientTemperature +
+  heaterGain * heater power, power being 0.0 (off) to 1.0 (always on).
+*/
+typedef struct thermalPlantParameters {
+  double ambientTemperature;
+  double heaterGain;
+  double timeConstantSeconds;
+  double deadTimeSeconds;
+}thermalPlantParameters_t;
+
+
+
+typedef struct thermalPlant {
+  thermalPlantParameters_t parameters;
+  double temperature;
+  double stepFactor;
+  size_t delayStepsCount;
+  size_t delayIndex;
+  float heaterPowerHistory[THERMAL_PLANT_DELAY_STEPS_MAX];
+}thermalPlant_t;
+
+
+
+/*****************************************************************************/
+/*                      PUBLIC FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+int THERMAL_PLANT_Init(thermalPlant_t *plant,
+  const thermalPlantParameters_t *parameters, double stepSeconds,
+  double initialTemperature);
+double THERMAL_PLANT_Step(thermalPlant_t *plant, double heaterPower);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* THERMAL_PLANT_H */
@@ -0,0 +1,279 @@
+#include "data_log.h"
+#include "thermal_plant.h"
+#include "thermistor_lookup_table.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define SAMPLES_COUNT_MAX 65536
+#define SECONDS_COUNT_MAX (4 * SAMPLES_COUNT_MAX)
+
+#define DEAD_TIME_MAX_SECONDS 600
+#define DEAD_TIME_STEP_SECONDS 5
+
+#define TIME_CONSTANT_MIN_SECONDS 60.0
+#define TIME_CONSTANT_MAX_SECONDS 20000.0
+#define TIME_CONSTANTS_COUNT 120
+
+/* Ambient temperature and heater gain. */
+#define FIT_UNKNOWNS_COUNT 2
+
+#define STEP_SECONDS 1.0
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE STRUCTURES                              */
+/*****************************************************************************/
+
+typedef struct plantFit {
+  thermalPlantParameters_t parameters;
+  double rmsError;
+}plantFit_t;
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+static dataLogSample_t samples[SAMPLES_COUNT_MAX];
+static size_t samplesCount;
+
+/* Relay state and logged temperature for every second of the trace. */
+static float heaterPower[SECONDS_COUNT_MAX];
+static float loggedTemperature[SECONDS_COUNT_MAX];
+static unsigned char isTemperatureLogged[SECONDS_COUNT_MAX];
+static size_t secondsCount;
+
+static thermalPlant_t plant;
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static int ReadTrace(void);
+static int FitForDelays(double deadTimeSeconds, double timeConstantSeconds,
+                        plantFit_t *fit);
+static int SolveLinearSystem(
+  double matrix[FIT_UNKNOWNS_COUNT][FIT_UNKNOWNS_COUNT],
+  double vector[FIT_UNKNOWNS_COUNT]);
+
+
+
+/*****************************************************************************/
+/*                                 MAIN                                      */
+/*****************************************************************************/
+
+/*
+  Fits a first order lag plus dead time plant (thermal_plant.c) to a DataLogs
+  trace read from stdin. Dead time and time constant are searched on a grid,
+  for each pair the ambient temperature and heater gain follow from linear
+  least squares against the logged relay states. Traces have to start from a
+  cold oven: with the heater on all the time the ambient temperature cannot
+  be told apart from the initial one, so the two are taken as equal.
+*/
+int main(void)
+{
+  if(ReadTrace() != 0) {
+    fprintf(stderr, "no samples\n");
+    return EXIT_FAILURE;
+  }
+
+  plantFit_t bestFit = { .rmsError = INFINITY };
+  double timeConstantRatio = pow(TIME_CONSTANT_MAX_SECONDS /
+    TIME_CONSTANT_MIN_SECONDS, 1.0 / (TIME_CONSTANTS_COUNT - 1));
+
+  for(int deadTime = 0; deadTime <= DEAD_TIME_MAX_SECONDS;
+    deadTime += DEAD_TIME_STEP_SECONDS) {
+    double timeConstant = TIME_CONSTANT_MIN_SECONDS;
+    for(int index = 0; index < TIME_CONSTANTS_COUNT; ++index) {
+      plantFit_t fit;
+      if(FitForDelays(deadTime, timeConstant, &fit) == 0 &&
+        fit.rmsError < bestFit.rmsError) {
+        bestFit = fit;
+      }
+      timeConstant *= timeConstantRatio;
+    }
+  }
+
+  if(isinf(bestFit.rmsError)) {
+    fprintf(stderr, "no fit\n");
+    return EXIT_FAILURE;
+  }
+
+  printf("samples            %zu over %zu s\n", samplesCount, secondsCount);
+  printf("ambient            %.2f C\n", bestFit.parameters.ambientTemperature);
+  printf("heater gain        %.2f C\n", bestFit.parameters.heaterGain);
+  printf("time constant      %.0f s\n",
+    bestFit.parameters.timeConstantSeconds);
+  printf("dead time          %.0f s\n", bestFit.parameters.deadTimeSeconds);
+  printf("rms error          %.3f C\n", bestFit.rmsError);
+
+  return EXIT_SUCCESS;
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+/* Holds every logged relay state until the next logged sample. */
+static int ReadTrace(void)
+{
+  char line[DATA_LOG_LINE_LENGTH_MAX];
+  while(samplesCount < SAMPLES_COUNT_MAX &&
+    DATA_LOG_ReadLine(stdin, line, sizeof(line)) == 0) {
+    if(DATA_LOG_ParseLine(line, &samples[samplesCount]) == 0) {
+      ++samplesCount;
+    }
+  }
+  if(samplesCount == 0) {
+    return -1;
+  }
+
+  long startTime = samples[0].timeInSeconds;
+  size_t sample = 0;
+  for(secondsCount = 0; secondsCount < SECONDS_COUNT_MAX; ++secondsCount) {
+    long time = startTime + (long)secondsCount;
+    while(sample + 1 < samplesCount &&
+      samples[sample + 1].timeInSeconds <= time) {
+      ++sample;
+    }
+
+    heaterPower[secondsCount] = samples[sample].isHeaterOn != 0 ? 1.0f : 0.0f;
+    isTemperatureLogged[secondsCount] = samples[sample].timeInSeconds == time;
+    loggedTemperature[secondsCount] = (float)samples[sample].temperature /
+      TEMPERATURE_FROM_DEGREES(1);
+
+    if(sample + 1 == samplesCount && samples[sample].timeInSeconds <= time) {
+      ++secondsCount;
+      break;
+    }
+  }
+
+  return 0;
+}
+
+
+
+/*
+  Starting at ambient, the plant is linear in the ambient temperature and
+  the heater gain: T(k) = Ta + K * y(k), y being the response of a unit gain
+  plant to the logged relay states.
+*/
+static int FitForDelays(double deadTimeSeconds, double timeConstantSeconds,
+                        plantFit_t *fit)
+{
+  thermalPlantParameters_t unitParameters = {
+    .ambientTemperature = 0.0,
+    .heaterGain = 1.0,
+    .timeConstantSeconds = timeConstantSeconds,
+    .deadTimeSeconds = deadTimeSeconds
+  };
+  if(THERMAL_PLANT_Init(&plant, &unitParameters, STEP_SECONDS, 0.0) != 0) {
+    return -1;
+  }
+
+  double matrix[FIT_UNKNOWNS_COUNT][FIT_UNKNOWNS_COUNT] = { { 0.0 } };
+  double vector[FIT_UNKNOWNS_COUNT] = { 0.0 };
+  double unitResponse = 0.0;
+  size_t fittedCount = 0;
+
+  for(size_t second = 0; second < secondsCount; ++second) {
+    if(isTemperatureLogged[second] != 0) {
+      double basis[FIT_UNKNOWNS_COUNT] = {
+        1.0, unitResponse
+      };
+      for(int row = 0; row < FIT_UNKNOWNS_COUNT; ++row) {
+        for(int column = 0; column < FIT_UNKNOWNS_COUNT; ++column) {
+          matrix[row][column] += basis[row] * basis[column];
+        }
+        vector[row] += basis[row] * loggedTemperature[second];
+      }
+      ++fittedCount;
+    }
+
+    unitResponse = THERMAL_PLANT_Step(&plant, heaterPower[second]);
+  }
+
+  if(SolveLinearSystem(matrix, vector) != 0) {
+    return -1;
+  }
+
+  fit->parameters = unitParameters;
+  fit->parameters.ambientTemperature = vector[0];
+  fit->parameters.heaterGain = vector[1];
+
+  /* The residual comes from running the fitted plant itself. */
+  THERMAL_PLANT_Init(&plant, &fit->parameters, STEP_SECONDS,
+    fit->parameters.ambientTemperature);
+  double errorsSum = 0.0;
+  double temperature = fit->parameters.ambientTemperature;
+  for(size_t second = 0; second < secondsCount; ++second) {
+    if(isTemperatureLogged[second] != 0) {
+      double error = temperature - loggedTemperature[second];
+      errorsSum += error * error;
+    }
+    temperature = THERMAL_PLANT_Step(&plant, heaterPower[second]);
+  }
+  fit->rmsError = sqrt(errorsSum / (double)fittedCount);
+
+  return 0;
+}
+
+
+
+/* Gaussian elimination with partial pivoting, the solution replaces vector. */
+static int SolveLinearSystem(
+  double matrix[FIT_UNKNOWNS_COUNT][FIT_UNKNOWNS_COUNT],
+  double vector[FIT_UNKNOWNS_COUNT])
+{
+  for(int pivot = 0; pivot < FIT_UNKNOWNS_COUNT; ++pivot) {
+    int bestRow = pivot;
+    for(int row = pivot + 1; row < FIT_UNKNOWNS_COUNT; ++row) {
+      if(fabs(matrix[row][pivot]) > fabs(matrix[bestRow][pivot])) {
+        bestRow = row;
+      }
+    }
+    if(fabs(matrix[bestRow][pivot]) < 1e-12) {
+      return -1;
+    }
+
+    for(int column = 0; column < FIT_UNKNOWNS_COUNT; ++column) {
+      double swapped = matrix[pivot][column];
+      matrix[pivot][column] = matrix[bestRow][column];
+      matrix[bestRow][column] = swapped;
+    }
+    double swapped = vector[pivot];
+    vector[pivot] = vector[bestRow];
+    vector[bestRow] = swapped;
+
+    for(int row = pivot + 1; row < FIT_UNKNOWNS_COUNT; ++row) {
+      double factor = matrix[row][pivot] / matrix[pivot][pivot];
+      for(int column = pivot; column < FIT_UNKNOWNS_COUNT; ++column) {
+        matrix[row][column] -= factor * matrix[pivot][column];
+      }
+      vector[row] -= factor * vector[pivot];
+    }
+  }
+
+  for(int row = FIT_UNKNOWNS_COUNT - 1; row >= 0; --row) {
+    for(int column = row + 1; column < FIT_UNKNOWNS_COUNT; ++column) {
+      vector[row] -= matrix[row][column] * vector[column];
+    }
+    vector[row] /= matrix[row][row];
+  }
+
+  return 0;
+}
@@ -0,0 +1,161 @@
+#include "thermistor_lookup_table.h"
+#include "thermistor_reference.h"
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define ENTRIES_PER_LINE 8
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+static int16_t lookupTable[THERMISTOR_LOOKUP_TABLE_SIZE];
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static int16_t ConvertAdcCode(uint32_t adcCode);
+static uint32_t ClampAdcMeasurement(uint32_t adcMeasurement);
+static int CheckCommittedLookupTable(void);
+static void PrintLookupTable(void);
+
+
+
+/*****************************************************************************/
+/*                                 MAIN                                      */
+/*****************************************************************************/
+
+/*
+  Builds the ADC code to temperature table with the resistance, table search
+  and interpolation chain the regulator used to run for every sample,
+  rounded to the nearest Q7.8 value, and prints the table source to stdout.
+  With -c it prints nothing and instead checks the committed table linked
+  in (Components/Src/thermistor_lookup_table.c) code by code against the
+  chain, failing on any entry that differs.
+*/
+int main(int argc, char *argv[])
+{
+  int isCheckRequested = 0;
+  int option;
+
+  while((option = getopt(argc, argv, "c")) != -1) {
+    if(option == 'c') {
+      isCheckRequested = 1;
+    } else {
+      fprintf(stderr, "usage: %s [-c]\n", argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  if(isCheckRequested != 0) {
+    return CheckCommittedLookupTable() == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+
+  for(uint32_t adcCode = 0; adcCode < THERMISTOR_LOOKUP_TABLE_SIZE; ++adcCode) {
+    lookupTable[adcCode] = ConvertAdcCode(adcCode);
+  }
+
+  PrintLookupTable();
+
+  return EXIT_SUCCESS;
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+/*
+  Codes outside the valid range never reached the chain, the regulator
+  switched the heater off instead. They get the value of the nearest valid
+  code.
+*/
+static int16_t ConvertAdcCode(uint32_t adcCode)
+{
+  float temperature = THERMISTOR_REFERENCE_AdcCodeToTemperature(
+    ClampAdcMeasurement(adcCode));
+  return (int16_t)lroundf(temperature * TEMPERATURE_FROM_DEGREES(1));
+}
+
+
+
+static uint32_t ClampAdcMeasurement(uint32_t adcMeasurement)
+{
+  if(adcMeasurement < ADC_MEASUREMENT_MIN) {
+    return ADC_MEASUREMENT_MIN;
+  } else if(adcMeasurement > ADC_MEASUREMENT_MAX) {
+    return ADC_MEASUREMENT_MAX;
+  } else {
+    return adcMeasurement;
+  }
+}
+
+
+
+static int CheckCommittedLookupTable(void)
+{
+  int mismatchesCount = 0;
+  float maxDifference = 0.0f;
+
+  for(uint32_t adcCode = 0; adcCode < THERMISTOR_LOOKUP_TABLE_SIZE; ++adcCode) {
+    int16_t expectedEntry = ConvertAdcCode(adcCode);
+    float referenceTemperature = THERMISTOR_REFERENCE_AdcCodeToTemperature(
+      ClampAdcMeasurement(adcCode));
+    float tableTemperature =
+      (float)thermistorLookupTable[adcCode] / TEMPERATURE_FROM_DEGREES(1);
+    float difference = fabsf(referenceTemperature - tableTemperature);
+
+    if(thermistorLookupTable[adcCode] != expectedEntry) {
+      fprintf(stderr, "ADC code %" PRIu32 ": table %d (%.4f), reference "
+        "%.4f\n", adcCode, thermistorLookupTable[adcCode], tableTemperature,
+        referenceTemperature);
+      ++mismatchesCount;
+    }
+    if(difference > maxDifference) {
+      maxDifference = difference;
+    }
+  }
+
+  fprintf(stderr, "Committed table against float chain: %d of %d codes "
+    "differ, max difference %.4f\n", mismatchesCount,
+    THERMISTOR_LOOKUP_TABLE_SIZE, maxDifference);
+
+  return mismatchesCount;
+}
+
+
+
+static void PrintLookupTable(void)
+{
+  printf("/*\n"
+         "  Generated by Tools/thermistor_lookup_table_generator.c.\n"
+         "  Do not edit by hand, regenerate instead.\n"
+         "*/\n\n"
+         "#include \"thermistor_lookup_table.h\"\n\n\n\n"
+         "const int16_t thermistorLookupTable[THERMISTOR_LOOKUP_TABLE_SIZE] = {");
+
+  for(uint32_t adcCode = 0; adcCode < THERMISTOR_LOOKUP_TABLE_SIZE; ++adcCode) {
+    if(adcCode % ENTRIES_PER_LINE == 0) {
+      printf("\n ");
+    }
+    printf(" %5d,", lookupTable[adcCode]);
+  }
+
+  printf("\n};\n");
+}
@@ -0,0 +1,167 @@
+#include "thermistor_reference.h"
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define TEMPERATURE_COUNT 156
+#define THERMISTOR_RESISTANCE_COUNT TEMPERATURE_COUNT
+
+
+
+/*****************************************************************************/
+/*                           REFERENCE TABLES                                */
+/*****************************************************************************/
+
+static const uint32_t thermistorResistanceTable[THERMISTOR_RESISTANCE_COUNT]= {
+ 193500, 181461, 170268, 159850, 150146,
+ 141100, 132659, 124779, 117418, 110537,
+ 104101,  98079,  92440,  87159,  82210,
+  77571,  73219,  69137,  65305,  61707,
+  58328,  55153,  52169,  49363,  46724,
+  44241,  41904,  39704,  37633,  35681,
+  33800,  32108,  30474,  28932,  27477,
+  26104,  24807,  23583,  22426,  21333,
+  20300,  19322,  18398,  17523,  16695,
+  15912,  15169,  14466,  13799,  13167,
+  12568,  11999,  11460,  10948,  10461,
+  10000,   9561,   9144,   8747,   8370,
+   8011,   7670,   7345,   7036,   6741,
+   6461,   6193,   5938,   5695,   5464,
+   5242,   5031,   4830,   4638,   4454,
+   4279,   4111,   3951,   3797,   3651,
+   3511,   3377,   3248,   3126,   3008,
+   2896,   2788,   2684,   2585,   2490,
+   2400,   2312,   2229,   2148,   2071,
+   1997,   1927,   1858,   1793,   1730,
+   1670,   1612,   1556,   1503,   1451,
+   1402,   1354,   1309,   1265,   1222,
+   1181,   1142,   1104,   1068,   1033,
+   1000,    967,    936,    906,    877,
+    849,    822,    796,    771,    747,
+    723,    701,    679,    658,    638,
+    600,    600,    582,    564,    548,
+    531,    516,    500,    486,    472,
+    458,    445,    432,    419,    407,
+    396,    385,    374,    364,    353,
+    344,    334,    325,    316,    308,
+    300
+};
+
+static const int temperatureTable[TEMPERATURE_COUNT] = {
+  -30, -29, -28, -27, -26,
+  -25, -24, -23, -22, -21,
+  -20, -19, -18, -17, -16,
+  -15, -14, -13, -12, -11,
+  -10,  -9,  -8,  -7,  -6,
+   -5,  -4,  -3,  -2,  -1,
+    0,   1,   2,   3,   4,
+    5,   6,   7,   8,   9,
+   10,  11,  12,  13,  14,
+   15,  16,  17,  18,  19,
+   20,  21,  22,  23,  24,
+   25,  26,  27,  28,  29,
+   30,  31,  32,  33,  34,
+   35,  36,  37,  38,  39,
+   40,  41,  42,  43,  44,
+   45,  46,  47,  48,  49,
+   50,  51,  52,  53,  54,
+   55,  56,  57,  58,  59,
+   60,  61,  62,  63,  64,
+   65,  66,  67,  68,  69,
+   70,  71,  72,  73,  74,
+   75,  76,  77,  78,  79,
+   80,  81,  82,  83,  84,
+   85,  86,  87,  88,  89,
+   90,  91,  92,  93,  94,
+   95,  96,  97,  98,  99,
+  100, 101, 102, 103, 104,
+  105, 106, 107, 108, 109,
+  110, 111, 112, 113, 114,
+  115, 116, 117, 118, 119,
+  120, 121, 122, 123, 124,
+  125
+};
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static uint32_t CalculateThermistorResistance(uint32_t adcMeasurement);
+static float FindTemperature(uint32_t thermistorResistance);
+static uint32_t FindTableIndex(uint32_t thermistorResistance);
+
+
+
+/*****************************************************************************/
+/*                     PUBLIC FUNCTIONS DEFINITIONS                          */
+/*****************************************************************************/
+
+/*
+  The conversion the regulator ran for every sample before the lookup table
+  (Components/Src/adc_temperature_regulator.c of the baseline commit), for
+  ADC codes in [ADC_MEASUREMENT_MIN, ADC_MEASUREMENT_MAX].
+*/
+float THERMISTOR_REFERENCE_AdcCodeToTemperature(uint32_t adcMeasurement)
+{
+  uint32_t thermistorResistance = CalculateThermistorResistance(adcMeasurement);
+  return FindTemperature(thermistorResistance);
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+/* Copied verbatim from the baseline, do not change. */
+static uint32_t CalculateThermistorResistance(uint32_t adcMeasurement)
+{
+  const float adcResolution = 4095.0f;
+  const float resistanceOfVoltageDividerResistor = 10000.0f;
+
+  uint32_t thermistorResistance = resistanceOfVoltageDividerResistor *
+    (adcResolution/adcMeasurement - 1.0f);
+  return thermistorResistance;
+}
+
+
+
+static float FindTemperature(uint32_t thermistorResistance)
+{
+  uint32_t tableIndex = FindTableIndex(thermistorResistance);
+  uint32_t referenceResistance = thermistorResistanceTable[tableIndex];
+  int referenceTemperature = temperatureTable[tableIndex];
+
+  const uint32_t interpolationStepsCount = 10;
+  uint32_t interpolationStep = (thermistorResistanceTable[tableIndex] -
+    thermistorResistanceTable[tableIndex + 1]) / interpolationStepsCount;
+
+  uint32_t step;
+  for(step = 1; step <= interpolationStepsCount; ++step) {
+    referenceResistance -= interpolationStep;
+    if(referenceResistance <= thermistorResistance) {
+      break;
+    }
+  } 
+  
+  return referenceTemperature + 0.1*step;
+}
+
+
+
+static uint32_t FindTableIndex(uint32_t thermistorResistance)
+{
+  uint32_t tableIndex;
+  for(tableIndex = 0; tableIndex < THERMISTOR_RESISTANCE_COUNT; ++tableIndex) {
+    if(thermistorResistance >= thermistorResistanceTable[tableIndex + 1]) {
+      break;
+    }
+  }
+
+  return tableIndex;
+}
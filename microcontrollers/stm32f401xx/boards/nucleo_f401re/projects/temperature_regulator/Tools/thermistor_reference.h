@@ -0,0 +1,27 @@
+#ifndef THERMISTOR_REFERENCE_H
+#define THERMISTOR_REFERENCE_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+
+#include <stdint.h>
+
+
+
+/*****************************************************************************/
+/*                      PUBLIC FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+float THERMISTOR_REFERENCE_AdcCodeToTemperature(uint32_t adcMeasurement);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* THERMISTOR_REFERENCE_H */
@@ -0,0 +1,594 @@
+#include "trace_recorder.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+
+
+/*****************************************************************************/
+/*                            PRIVATE DEFINES                                */
+/*****************************************************************************/
+
+#define LINE_LENGTH_MAX 256
+#define NAME_LENGTH_MAX 32
+
+/* Task, queue and exception numbers are one byte in the records. */
+#define OBJECTS_COUNT 256
+
+/* ISR tracks follow the task tracks in the viewer. */
+#define ISR_THREAD_ID_OFFSET 1000
+
+#define ISR_NESTING_MAX 16
+
+/* Bucket 0 is below 1 us, bucket n from 2^(n-1) us up to 2^n us. */
+#define HISTOGRAM_BUCKETS_COUNT 24
+
+#define MICROSECONDS_IN_SECOND 1000000.0
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE STRUCTURES                              */
+/*****************************************************************************/
+
+typedef struct traceDump {
+  uint32_t cyclesPerSecond;
+  uint32_t overwrittenCount;
+  uint32_t expectedCount;
+  uint32_t recordsCount;
+  traceRecord_t *records;
+  char taskNames[OBJECTS_COUNT][NAME_LENGTH_MAX];
+  char queueNames[OBJECTS_COUNT][NAME_LENGTH_MAX];
+}traceDump_t;
+
+
+
+typedef struct histogram {
+  uint32_t counts[HISTOGRAM_BUCKETS_COUNT];
+  uint32_t samplesCount;
+  double sumUs;
+  double minUs;
+  double maxUs;
+}histogram_t;
+
+
+
+typedef struct isrEntry {
+  uint32_t exceptionNumber;
+  double enterUs;
+}isrEntry_t;
+
+
+
+/*****************************************************************************/
+/*                           PRIVATE VARIABLES                               */
+/*****************************************************************************/
+
+static const struct {
+  uint32_t exceptionNumber;
+  const char *name;
+}EXCEPTION_NAMES[] = {
+  { 19, "RTC_WKUP" },
+  { 34, "ADC" },
+  { 45, "TIM3" },
+  { 53, "USART1" },
+  { 72, "DMA2_Stream0" },
+  { 74, "DMA2_Stream2" },
+  { 86, "DMA2_Stream7" }
+};
+
+static traceDump_t dump;
+
+static histogram_t activationHistograms[OBJECTS_COUNT];
+static histogram_t wakeLatencyHistograms[OBJECTS_COUNT];
+static histogram_t isrHistograms[OBJECTS_COUNT];
+
+static uint32_t isTaskSeen[OBJECTS_COUNT];
+static uint32_t isIsrSeen[OBJECTS_COUNT];
+
+static int isFirstEvent = 1;
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS PROTOTYPES                          */
+/*****************************************************************************/
+
+static int ReadDump(FILE *input, uint32_t dumpIndex);
+static int ParseLine(const char *line, uint32_t *isDumpOpen);
+static void ParseRecords(const char *text);
+static void WriteTimeline(void);
+static double GetFirstCyclesPerUs(void);
+static void WriteMetadata(void);
+static const char *GetTaskName(uint32_t taskNumber);
+static const char *GetQueueName(uint32_t queueNumber);
+static const char *GetExceptionName(uint32_t exceptionNumber);
+static const char *GetEventName(uint32_t event);
+static void BeginEvent(void);
+static void AddSample(histogram_t *histogram, double us);
+static void PrintHistograms(void);
+static void PrintHistogram(const char *name, const char *kind,
+  const histogram_t *histogram);
+
+
+
+/*****************************************************************************/
+/*                                 MAIN                                      */
+/*****************************************************************************/
+
+/*
+  Reads the USART1 stream as text lines, the output of telemetry_decoder,
+  picks the last complete trace dump, or the -d one counting from 1, and
+  writes it to stdout in the Trace Event Format of chrome://tracing and
+  Perfetto: one track per task with its activations, one per interrupt
+  with the handler runs, instant events for notifications and queue
+  operations and a counter per queue. On stderr go the histograms of the
+  task activations, of the wake latency of the tasks (from the task
+  notification that ends a blocking wait to the switch in) and of the
+  interrupt handler durations.
+
+  Usage: trace_timeline [-d dump] < decoded.txt > trace.json
+*/
+int main(int argc, char *argv[])
+{
+  uint32_t dumpIndex = 0;
+
+  int option;
+  while((option = getopt(argc, argv, "d:")) != -1) {
+    if(option == 'd' && atoi(optarg) > 0) {
+      dumpIndex = (uint32_t)atoi(optarg);
+    } else {
+      fprintf(stderr, "usage: %s [-d dump] < decoded.txt\n", argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  if(ReadDump(stdin, dumpIndex) != 0) {
+    fprintf(stderr, "no complete trace dump found\n");
+    return EXIT_FAILURE;
+  }
+  if(dump.recordsCount != dump.expectedCount) {
+    fprintf(stderr, "%" PRIu32 " of %" PRIu32 " records received\n",
+      dump.recordsCount, dump.expectedCount);
+  }
+  if(dump.overwrittenCount != 0) {
+    fprintf(stderr, "%" PRIu32 " older records were overwritten\n",
+      dump.overwrittenCount);
+  }
+
+  WriteTimeline();
+  PrintHistograms();
+  free(dump.records);
+
+  return EXIT_SUCCESS;
+}
+
+
+
+/*****************************************************************************/
+/*                     PRIVATE FUNCTIONS DEFINITIONS                         */
+/*****************************************************************************/
+
+/* Every dump is parsed, the one asked for is kept. */
+static int ReadDump(FILE *input, uint32_t dumpIndex)
+{
+  char line[LINE_LENGTH_MAX];
+  uint32_t isDumpOpen = 0;
+  uint32_t completeDumpsCount = 0;
+  traceDump_t kept;
+  memset(&kept, 0, sizeof(kept));
+
+  while(fgets(line, sizeof(line), input) != NULL) {
+    if(ParseLine(line, &isDumpOpen) == 0 || isDumpOpen != 0) {
+      continue;
+    }
+
+    ++completeDumpsCount;
+    if(dumpIndex == 0 || completeDumpsCount == dumpIndex) {
+      free(kept.records);
+      kept = dump;
+    } else {
+      free(dump.records);
+    }
+    memset(&dump, 0, sizeof(dump));
+  }
+
+  free(dump.records);
+  dump = kept;
+
+  if(completeDumpsCount == 0 ||
+    (dumpIndex != 0 && completeDumpsCount < dumpIndex)) {
+    return -1;
+  }
+
+  return 0;
+}
+
+
+
+/*
+  Returns 1 when the line ends a dump. Lines may start with the host time
+  of telemetry_decoder -t, the keywords are searched for.
+*/
+static int ParseLine(const char *line, uint32_t *isDumpOpen)
+{
+  const char *text;
+  uint32_t number;
+  char name[NAME_LENGTH_MAX];
+
+  if(strstr(line, "TRACE END") != NULL) {
+    if(*isDumpOpen == 0) {
+      return 0;
+    }
+    *isDumpOpen = 0;
+    return 1;
+  }
+
+  if((text = strstr(line, "TRACE ")) != NULL) {
+    free(dump.records);
+    memset(&dump, 0, sizeof(dump));
+    if(sscanf(text, "TRACE %" SCNu32 " %" SCNu32 " %" SCNu32,
+      &dump.expectedCount, &dump.overwrittenCount,
+      &dump.cyclesPerSecond) == 3 && dump.cyclesPerSecond != 0) {
+      dump.records = calloc(dump.expectedCount + 1U, sizeof(traceRecord_t));
+      *isDumpOpen = dump.records != NULL;
+    }
+    return 0;
+  }
+
+  if(*isDumpOpen == 0) {
+    return 0;
+  }
+
+  if((text = strstr(line, "TASK ")) != NULL &&
+    sscanf(text, "TASK %" SCNu32 " %31s", &number, name) == 2) {
+    snprintf(dump.taskNames[number % OBJECTS_COUNT], NAME_LENGTH_MAX, "%s",
+      name);
+  } else if((text = strstr(line, "QUEUE ")) != NULL &&
+    sscanf(text, "QUEUE %" SCNu32 " %31s", &number, name) == 2) {
+    snprintf(dump.queueNames[number % OBJECTS_COUNT], NAME_LENGTH_MAX, "%s",
+      name);
+  } else if((text = strstr(line, "TR ")) != NULL) {
+    ParseRecords(&text[2]);
+  }
+
+  return 0;
+}
+
+
+
+static void ParseRecords(const char *text)
+{
+  char digits[TRACE_RECORDER_RECORD_HEX_DIGITS + 1];
+  int consumed;
+
+  while(sscanf(text, " %16[0-9A-Fa-f]%n", digits, &consumed) == 1) {
+    text += consumed;
+    if(strlen(digits) != TRACE_RECORDER_RECORD_HEX_DIGITS ||
+      dump.recordsCount == dump.expectedCount) {
+      continue;
+    }
+
+    uint64_t value = strtoull(digits, NULL, 16);
+    traceRecord_t *record = &dump.records[dump.recordsCount++];
+    record->cycles = (uint32_t)(value >> 32);
+    record->event = (uint8_t)(value >> 24);
+    record->object = (uint8_t)(value >> 16);
+    record->data = (uint16_t)value;
+  }
+}
+
+
+
+/*
+  Cycle counts are unwrapped, records closer than 2^32 cycles apart (51 s
+  at 84 MHz) keep their order. The task switched in last runs until the
+  next switch, time spent in interrupt handlers included. Cycles are turned
+  into time at the core clock of the clock profile they were counted at.
+*/
+static void WriteTimeline(void)
+{
+  double cyclesPerUs = GetFirstCyclesPerUs();
+  uint32_t previousCycles = dump.recordsCount != 0 ?
+    dump.records[0].cycles : 0;
+
+  uint32_t runningTask = 0;
+  double switchedInUs = 0.0;
+  uint32_t isWaiting[OBJECTS_COUNT] = { 0 };
+  double notifiedUs[OBJECTS_COUNT] = { 0 };
+  uint32_t isNotified[OBJECTS_COUNT] = { 0 };
+  isrEntry_t isrStack[ISR_NESTING_MAX];
+  uint32_t isrDepth = 0;
+  double us = 0.0;
+
+  printf("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+  for(uint32_t index = 0; index < dump.recordsCount; ++index) {
+    const traceRecord_t *record = &dump.records[index];
+    us += (double)(uint32_t)(record->cycles - previousCycles) / cyclesPerUs;
+    previousCycles = record->cycles;
+
+    uint32_t object = record->object;
+    uint32_t contextThread = isrDepth != 0 ?
+      ISR_THREAD_ID_OFFSET + isrStack[isrDepth - 1].exceptionNumber :
+      runningTask;
+
+    switch(record->event) {
+      case TraceEvent_TaskSwitchedIn:
+        if(runningTask != 0) {
+          BeginEvent();
+          printf("{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%" PRIu32
+            ",\"ts\":%.3f,\"dur\":%.3f}", GetTaskName(runningTask),
+            runningTask, switchedInUs, us - switchedInUs);
+          AddSample(&activationHistograms[runningTask], us - switchedInUs);
+        }
+        if(isNotified[object] != 0) {
+          AddSample(&wakeLatencyHistograms[object], us - notifiedUs[object]);
+          isNotified[object] = 0;
+        }
+        isWaiting[object] = 0;
+        isTaskSeen[object] = 1;
+        runningTask = object;
+        switchedInUs = us;
+        break;
+
+      case TraceEvent_TaskNotify:
+        if(isWaiting[object] != 0 && isNotified[object] == 0) {
+          isNotified[object] = 1;
+          notifiedUs[object] = us;
+        }
+        BeginEvent();
+        printf("{\"name\":\"notify %s\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,"
+          "\"tid\":%" PRIu32 ",\"ts\":%.3f}", GetTaskName(object),
+          contextThread, us);
+        break;
+
+      case TraceEvent_TaskNotifyWaitBlock:
+        isWaiting[object] = 1;
+        BeginEvent();
+        printf("{\"name\":\"wait\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,"
+          "\"tid\":%" PRIu32 ",\"ts\":%.3f}", object, us);
+        break;
+
+      case TraceEvent_QueueSend:
+      case TraceEvent_QueueSendFailed:
+      case TraceEvent_QueueSendBlock:
+      case TraceEvent_QueueReceive:
+      case TraceEvent_QueueReceiveFailed:
+      case TraceEvent_QueueReceiveBlock: {
+        /* The record holds the count before the operation. */
+        int32_t messages = record->data;
+        if(record->event == TraceEvent_QueueSend) {
+          ++messages;
+        } else if(record->event == TraceEvent_QueueReceive) {
+          --messages;
+        }
+        BeginEvent();
+        printf("{\"name\":\"%s %s\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,"
+          "\"tid\":%" PRIu32 ",\"ts\":%.3f}", GetEventName(record->event),
+          GetQueueName(object), contextThread, us);
+        BeginEvent();
+        printf("{\"name\":\"%s\",\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,"
+          "\"args\":{\"messages\":%" PRId32 "}}", GetQueueName(object), us,
+          messages);
+        break;
+      }
+
+      case TraceEvent_IsrEnter:
+        if(isrDepth < ISR_NESTING_MAX) {
+          isrStack[isrDepth].exceptionNumber = object;
+          isrStack[isrDepth].enterUs = us;
+          ++isrDepth;
+        }
+        break;
+
+      case TraceEvent_IsrExit:
+        if(isrDepth != 0 && isrStack[isrDepth - 1].exceptionNumber == object) {
+          --isrDepth;
+          double durationUs = us - isrStack[isrDepth].enterUs;
+          BeginEvent();
+          printf("{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%" PRIu32
+            ",\"ts\":%.3f,\"dur\":%.3f}", GetExceptionName(object),
+            ISR_THREAD_ID_OFFSET + object, isrStack[isrDepth].enterUs,
+            durationUs);
+          AddSample(&isrHistograms[object], durationUs);
+          isIsrSeen[object] = 1;
+        }
+        break;
+
+      case TraceEvent_ClockSwitch:
+        if(record->data != 0) {
+          cyclesPerUs = record->data;
+        }
+        BeginEvent();
+        printf("{\"name\":\"clock %" PRIu32 " MHz\",\"ph\":\"i\","
+          "\"s\":\"g\",\"pid\":1,\"ts\":%.3f}", (uint32_t)record->data,
+          us);
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  if(runningTask != 0 && us > switchedInUs) {
+    BeginEvent();
+    printf("{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%" PRIu32
+      ",\"ts\":%.3f,\"dur\":%.3f}", GetTaskName(runningTask), runningTask,
+      switchedInUs, us - switchedInUs);
+  }
+
+  WriteMetadata();
+  printf("\n]}\n");
+}
+
+
+
+/*
+  The records before the first clock switch were counted at the clock it
+  switched from, without switch at the clock given in the dump header.
+*/
+static double GetFirstCyclesPerUs(void)
+{
+  for(uint32_t index = 0; index < dump.recordsCount; ++index) {
+    const traceRecord_t *record = &dump.records[index];
+    if(record->event == TraceEvent_ClockSwitch && record->object != 0) {
+      return record->object;
+    }
+  }
+
+  return dump.cyclesPerSecond / MICROSECONDS_IN_SECOND;
+}
+
+
+
+static void WriteMetadata(void)
+{
+  BeginEvent();
+  printf("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,"
+    "\"args\":{\"name\":\"temperature_regulator\"}}");
+
+  for(uint32_t number = 0; number < OBJECTS_COUNT; ++number) {
+    if(isTaskSeen[number] != 0) {
+      BeginEvent();
+      printf("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%"
+        PRIu32 ",\"args\":{\"name\":\"%s\"}}", number, GetTaskName(number));
+    }
+    if(isIsrSeen[number] != 0) {
+      BeginEvent();
+      printf("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%"
+        PRIu32 ",\"args\":{\"name\":\"ISR %s\"}}",
+        ISR_THREAD_ID_OFFSET + number, GetExceptionName(number));
+    }
+  }
+}
+
+
+
+static const char *GetTaskName(uint32_t taskNumber)
+{
+  static char unnamed[NAME_LENGTH_MAX];
+
+  if(dump.taskNames[taskNumber][0] != '\0') {
+    return dump.taskNames[taskNumber];
+  }
+  snprintf(unnamed, sizeof(unnamed), "task %" PRIu32, taskNumber);
+  return unnamed;
+}
+
+
+
+/* Queue 0 stands for the queues created after the recorder table was full. */
+static const char *GetQueueName(uint32_t queueNumber)
+{
+  static char unnamed[NAME_LENGTH_MAX];
+
+  if(dump.queueNames[queueNumber][0] != '\0') {
+    return dump.queueNames[queueNumber];
+  }
+  snprintf(unnamed, sizeof(unnamed), "queue %" PRIu32, queueNumber);
+  return unnamed;
+}
+
+
+
+static const char *GetExceptionName(uint32_t exceptionNumber)
+{
+  static char unnamed[NAME_LENGTH_MAX];
+
+  for(size_t entry = 0;
+    entry < sizeof(EXCEPTION_NAMES) / sizeof(EXCEPTION_NAMES[0]); ++entry) {
+    if(EXCEPTION_NAMES[entry].exceptionNumber == exceptionNumber) {
+      return EXCEPTION_NAMES[entry].name;
+    }
+  }
+  snprintf(unnamed, sizeof(unnamed), "IRQ %" PRIu32, exceptionNumber - 16U);
+  return unnamed;
+}
+
+
+
+static const char *GetEventName(uint32_t event)
+{
+  switch(event) {
+    case TraceEvent_QueueSend: return "send";
+    case TraceEvent_QueueSendFailed: return "send failed";
+    case TraceEvent_QueueSendBlock: return "send blocked";
+    case TraceEvent_QueueReceive: return "receive";
+    case TraceEvent_QueueReceiveFailed: return "receive failed";
+    case TraceEvent_QueueReceiveBlock: return "receive blocked";
+    default: return "event";
+  }
+}
+
+
+
+static void BeginEvent(void)
+{
+  if(isFirstEvent == 0) {
+    printf(",\n");
+  }
+  isFirstEvent = 0;
+}
+
+
+
+static void AddSample(histogram_t *histogram, double us)
+{
+  uint32_t bucket = 0;
+  while(bucket < HISTOGRAM_BUCKETS_COUNT - 1 && us >= (double)(1UL << bucket)) {
+    ++bucket;
+  }
+
+  ++histogram->counts[bucket];
+  if(histogram->samplesCount == 0 || us < histogram->minUs) {
+    histogram->minUs = us;
+  }
+  if(histogram->samplesCount == 0 || us > histogram->maxUs) {
+    histogram->maxUs = us;
+  }
+  histogram->sumUs += us;
+  ++histogram->samplesCount;
+}
+
+
+
+static void PrintHistograms(void)
+{
+  for(uint32_t number = 0; number < OBJECTS_COUNT; ++number) {
+    PrintHistogram(GetTaskName(number), "activation",
+      &activationHistograms[number]);
+    PrintHistogram(GetTaskName(number), "wake latency",
+      &wakeLatencyHistograms[number]);
+  }
+  for(uint32_t number = 0; number < OBJECTS_COUNT; ++number) {
+    PrintHistogram(GetExceptionName(number), "handler",
+      &isrHistograms[number]);
+  }
+}
+
+
+
+static void PrintHistogram(const char *name, const char *kind,
+  const histogram_t *histogram)
+{
+  if(histogram->samplesCount == 0) {
+    return;
+  }
+
+  fprintf(stderr, "%s %s: %" PRIu32 " samples, min %.1f us, mean %.1f us, "
+    "max %.1f us\n", name, kind, histogram->samplesCount, histogram->minUs,
+    histogram->sumUs / histogram->samplesCount, histogram->maxUs);
+
+  for(uint32_t bucket = 0; bucket < HISTOGRAM_BUCKETS_COUNT; ++bucket) {
+    if(histogram->counts[bucket] == 0) {
+      continue;
+    }
+    unsigned long low = bucket == 0 ? 0 : 1UL << (bucket - 1);
+    fprintf(stderr, "  %8lu - %8lu us %8" PRIu32 "\n", low, 1UL << bucket,
+      histogram->counts[bucket]);
+  }
+}
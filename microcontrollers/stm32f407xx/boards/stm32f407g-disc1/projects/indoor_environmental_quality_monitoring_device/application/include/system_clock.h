@@ -31,7 +31,8 @@
 
 /**
  * @brief   Initialize clock source (e.g. HSI or PLL), system clock (HCLK),
- *          AHB prescaler, APB1 prescaler, APB2 prescaler and Flash latency.
+ *          AHB prescaler, APB1 prescaler, APB2 prescaler, Flash latency and
+ *          Flash prefetch, instruction and data caches.
  *
  * @param   None.
  *
@@ -27,6 +27,14 @@ extern uint32_t SystemCoreClock;
 
 
 
+/*****************************************************************************/
+/* PRIVATE FUNCTIONS PROTOTYPES */
+/*****************************************************************************/
+
+static void system_clock_flash_init(uint32_t flash_latency);
+
+
+
 /*****************************************************************************/
 /* PUBLIC FUNCTIONS DEFINITIONS */
 /*****************************************************************************/
@@ -39,7 +47,7 @@ void system_clock_init(void)
         ;
     }
 
-    LL_FLASH_SetLatency(LL_FLASH_LATENCY_5);
+    system_clock_flash_init(LL_FLASH_LATENCY_5);
 
     LL_RCC_PLL_ConfigDomain_SYS(LL_RCC_PLLSOURCE_HSE, LL_RCC_PLLM_DIV_8, 336,
         LL_RCC_PLLP_DIV_2);
@@ -63,7 +71,7 @@ void system_clock_init(void)
         ;
     }
 
-    LL_FLASH_SetLatency(LL_FLASH_LATENCY_1);
+    system_clock_flash_init(LL_FLASH_LATENCY_0);
 
     LL_RCC_SetAHBPrescaler(LL_RCC_SYSCLK_DIV_1);
     LL_RCC_SetSysClkSource(LL_RCC_SYS_CLKSOURCE_HSI);
@@ -77,3 +85,34 @@ void system_clock_init(void)
     SystemCoreClock = 16000000;
 }
 
+
+
+/*****************************************************************************/
+/* PRIVATE FUNCTIONS DEFINITIONS */
+/*****************************************************************************/
+
+/*
+ * Wait states for VDD from 2.7 V to 3.6 V: none up to 30 MHz, one more
+ * every 30 MHz above, five at 168 MHz. They are set before the clock is
+ * raised, and the ART accelerator (prefetch, instruction and data caches)
+ * hides most of them. The caches are reset while disabled.
+ */
+static void system_clock_flash_init(uint32_t flash_latency)
+{
+    LL_FLASH_SetLatency(flash_latency);
+    while (LL_FLASH_GetLatency() != flash_latency) {
+        ;
+    }
+
+    LL_FLASH_DisableInstCache();
+    LL_FLASH_DisableDataCache();
+    LL_FLASH_EnableInstCacheReset();
+    LL_FLASH_DisableInstCacheReset();
+    LL_FLASH_EnableDataCacheReset();
+    LL_FLASH_DisableDataCacheReset();
+
+    LL_FLASH_EnablePrefetch();
+    LL_FLASH_EnableInstCache();
+    LL_FLASH_EnableDataCache();
+}
+